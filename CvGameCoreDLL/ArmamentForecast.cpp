@@ -6,6 +6,7 @@
 #include "MilitaryAnalyst.h"
 #include "WarEvalParameters.h"
 #include "WarAndPeaceReport.h"
+#include "InvasionGraph.h" // advc.003ab
 #include "CvGamePlay.h"
 #include "AI_Defines.h"
 #include "CvMap.h"
@@ -29,15 +30,8 @@ ArmamentForecast::ArmamentForecast(PlayerTypes civId, MilitaryAnalyst& m,
 	report.log("Armament forecast for *%s*",
 			report.leaderName(civId));
 	WarEvalParameters& params = m.evaluationParameters();
-	/* The current production rate. It's probably going to increase a bit
-	   over the planning interval, but not much since the forecast doesn't
-	   reach far into the future; ignore that increase. */
-	double productionEstimate = GET_PLAYER(civId).estimateYieldRate(YIELD_PRODUCTION);
-	/* A very rough estimate of hurry hammers. Would be nicer to base this on
-	   the actual hurry effect, e.g., for Slavery, per-use production divided
-	   by anger duration. */
-	if(wpai.canHurry())
-		productionEstimate += 3 * GET_PLAYER(civId).getNumCities();
+	// advc.003ab: Same for all scenarios; computed by SimulationSnapshot.
+	double productionEstimate = m.getSnapshot().getProductionEstimate(civId);
 	/* Civs will often change civics when war is declared. For now, the AI makes
 	   no effort to anticipate this. Will have to adapt once it happens. */
 	report.log("Production per turn: %d",  ::round(productionEstimate));
@@ -48,7 +42,7 @@ ArmamentForecast::ArmamentForecast(PlayerTypes civId, MilitaryAnalyst& m,
 	// Express upgrades in terms of differences in production costs
 	double prodFromUpgrades = 0;
 	if(!noUpgrading)
-		prodFromUpgrades = productionFromUpgrades();
+		prodFromUpgrades = m.getSnapshot().getProductionFromUpgrades(civId, report); // advc.003ab
 	if(prodFromUpgrades > 0.01)
 		report.log("Production from upgrades: %d", ::round(prodFromUpgrades));
 
@@ -537,60 +531,6 @@ char const* ArmamentForecast::strIntensity(Intensity in) {
 	}
 }
 
-double ArmamentForecast::productionFromUpgrades() {
-
-	/* Going through all the units and checking for possible upgrades would be
-	   somewhat expensive and complicated: Which upgrades would be prioritized
-	   if upgrading them all is too costly?
-	   Failed attempt: Predict the power of a fully upgraded army based on
-	   unit counts and typical units -- the resulting power value turned out to
-	   be a poor estimate of an army's upgrade potential.
-	   Actual approach: Rely on CvPlayerAI::AI_updateGoldToUpgradeAllUnits,
-	   convert the result into hammers, and (later) the hammers into power. */
-	CvPlayerAI& civ = GET_PLAYER(civId);
-	double r = civ.AI_getGoldToUpgradeAllUnits();
-	if(r > 0.01)
-		report.log("Total gold needed for upgrades: %d", ::round(r));
-	/* 'civ' may not have the funds to make all the upgrades in the
-	   medium term. Think of a human player keeping stacks of Warriors around,
-	   or a vassal receiving tech quickly from its master.
-	   Spend at most incomeTurns turns worth of income on upgrades. The subtrahend
-	   will be 0 during anarchy -- not a big problem I think. */
-	double const incomeTurns = 4;
-	double income = civ.estimateYieldRate(YIELD_COMMERCE, 3) -
-			civ.calculateInflatedCosts();
-	double incomeBound = incomeTurns * income;
-	// Also take into account current gold stockpile
-	int iGold = civ.getGold();
-	incomeBound = std::max((2 * incomeBound + iGold) / 3, (2 * iGold + incomeBound) / 3);
-	if(incomeBound < r)
-		report.log("Upgrades bounded by income (%d gpt)", ::round(income));
-	r = std::min(incomeBound, r);
-	// An approximate inversion of CvUnit::upgradePrice
-	double upgrCostPerProd = GC.getDefineINT("UNIT_UPGRADE_COST_PER_PRODUCTION");
-	r /= upgrCostPerProd;
-	/* The base upgrade cost is paid per unit, but CvPlayerAI doesn't track
-	   how many units need an upgrade. Assuming a mean training cost difference
-	   of 30 hammers, one can look at the base cost as a multiplicative modifier. */
-	double typicalGoldForProdDiff = upgrCostPerProd * 30;
-	double baseCostModifier = typicalGoldForProdDiff / (typicalGoldForProdDiff +
-			GC.getDefineINT("BASE_UNIT_UPGRADE_COST"));
-	r *= baseCostModifier;
-	if(!civ.isHuman()) {
-		CvHandicapInfo& gameHandicap = GC.getHandicapInfo(GC.getGameINLINE().
-				getHandicapType());
-		double aiUpgradeFactor = gameHandicap.getAIUnitUpgradePercent();
-		// advc.250d: The per-era modifier no longer applies to upgrade cost
-			// + gameHandicap.getAIPerEraModifier() * civ.getCurrentEra();
-		aiUpgradeFactor /= 100.0;
-		/* Shouldn't draw conclusions from AI_getGoldToUpgradeAllUnits when
-		   AI upgrades are (modded to be) free or almost free. */
-		if(aiUpgradeFactor > 0.1)
-			r /= aiUpgradeFactor;
-	}
-	return std::max(0.0, r);
-}
-
 CvArea* ArmamentForecast::getCapitalArea(PlayerTypes civId) const {
 
 	if(civId == NO_PLAYER)
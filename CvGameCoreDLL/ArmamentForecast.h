@@ -55,13 +55,13 @@ private:
 		FULL,
 	};
 	static char const* strIntensity(Intensity in);
-	// Both directly increase the power values in 'military'
+	// Directly increases the power values in 'military'
 	 void predictArmament(int turnsBuildUp, double perTurnProduction,
 			/* additionalProduction: Currently, that unit upgrades converted
 			   into production. */
 			double additionalProduction, Intensity intensity, bool defensive,
 			bool navalArmament);
-	 double productionFromUpgrades();
+	 // advc.003ab: productionFromUpgrades moved to SimulationSnapshot
 	/* The Area AI differentiates between continents, the forecast doesn't
 	   (perhaps should in the future).
 	   Only considers the Area AI for the continent where the capital is --
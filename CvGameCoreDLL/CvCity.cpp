@@ -13,6 +13,8 @@
 #include "CvEventReporter.h"
 #include "CvBugOptions.h" // advc.060
 #include "CvInitCore.h" // advc.001: Needed for bugfix in getCityBillboardSizeIconColors
+#include "TurnTimer.h" // advc.003s
+#include "WarAndPeaceAI.h" // advc.003z
 #include "BetterBTSAI.h" // BETTER_BTS_AI_MOD, AI logging, 10/02/09, jdog5000
 #include "CvDLLEngineIFaceBase.h"
 #include "CvDLLPythonIFaceBase.h"
@@ -174,9 +176,9 @@ void CvCity::init(int iID, PlayerTypes eOwner, int iX, int iY, bool bBumpUnits,
 	m_iOccupationTimer = iOccupationTimer;
 	updateCultureLevel(false);
 
-	if (pPlot->getCulture(getOwnerINLINE()) < GC.getDefineINT("FREE_CITY_CULTURE"))
+	if (pPlot->getCulture(getOwnerINLINE()) < GC.getDefineINT(CvGlobals::FREE_CITY_CULTURE))
 	{
-		pPlot->setCulture(getOwnerINLINE(), GC.getDefineINT("FREE_CITY_CULTURE"), bBumpUnits, false);
+		pPlot->setCulture(getOwnerINLINE(), GC.getDefineINT(CvGlobals::FREE_CITY_CULTURE), bBumpUnits, false);
 	}
 	pPlot->setOwner(getOwnerINLINE(), bBumpUnits, false);
 	pPlot->setPlotCity(this);
@@ -187,9 +189,9 @@ void CvCity::init(int iID, PlayerTypes eOwner, int iX, int iY, bool bBumpUnits,
 
 		if (pAdjacentPlot != NULL)
 		{
-			if (pAdjacentPlot->getCulture(getOwnerINLINE()) < GC.getDefineINT("FREE_CITY_ADJACENT_CULTURE"))
+			if (pAdjacentPlot->getCulture(getOwnerINLINE()) < GC.getDefineINT(CvGlobals::FREE_CITY_ADJACENT_CULTURE))
 			{
-				pAdjacentPlot->setCulture(getOwnerINLINE(), GC.getDefineINT("FREE_CITY_ADJACENT_CULTURE"),
+				pAdjacentPlot->setCulture(getOwnerINLINE(), GC.getDefineINT(CvGlobals::FREE_CITY_ADJACENT_CULTURE),
 						// advc.003b: Updated in the next line in any case
 						false/*was bBumpUnits*/, false);
 			}
@@ -201,7 +203,7 @@ void CvCity::init(int iID, PlayerTypes eOwner, int iX, int iY, bool bBumpUnits,
 	{
 		if (GET_TEAM(getTeam()).isVassal((TeamTypes)iI))
 		{
-			pPlot->changeAdjacentSight((TeamTypes)iI, GC.getDefineINT("PLOT_VISIBILITY_RANGE"), true, NULL, false);
+			pPlot->changeAdjacentSight((TeamTypes)iI, GC.getDefineINT(CvGlobals::PLOT_VISIBILITY_RANGE), true, NULL, false);
 		}
 	}
 
@@ -263,7 +265,7 @@ void CvCity::init(int iID, PlayerTypes eOwner, int iX, int iY, bool bBumpUnits,
 		// advc.004b: No functional change, just needed the same thing elsewhere
 		initialPopulation());
 
-	changeAirUnitCapacity(GC.getDefineINT("CITY_AIR_UNIT_CAPACITY"));
+	changeAirUnitCapacity(GC.getDefineINT(CvGlobals::CITY_AIR_UNIT_CAPACITY));
 
 	updateFreshWaterHealth();
 	updateFeatureHealth();
@@ -297,7 +299,7 @@ void CvCity::init(int iID, PlayerTypes eOwner, int iX, int iY, bool bBumpUnits,
 
 			if (!isHuman() /* advc.250b: */ && !g.isOption(GAMEOPTION_SPAH))
 			{
-				changeOverflowProduction(GC.getDefineINT("INITIAL_AI_CITY_PRODUCTION"), 0);
+				changeOverflowProduction(GC.getDefineINT(CvGlobals::INITIAL_AI_CITY_PRODUCTION), 0);
 			} // <advc.124g>
 			if(isHuman() && eOwner == g.getActivePlayer() &&
 					kOwner.getCurrentResearch() == NO_TECH)
@@ -656,9 +658,9 @@ void CvCity::reset(int iID, PlayerTypes eOwner, int iX, int iY, bool bConstructo
 			m_pabWorkingPlot[iI] = false;
 		}
 
-		FAssertMsg((0 < GC.getDefineINT("MAX_TRADE_ROUTES")),  "GC.getMAX_TRADE_ROUTES() is not greater than zero but an array is being allocated in CvCity::reset");
-		m_paTradeCities = new IDInfo[GC.getDefineINT("MAX_TRADE_ROUTES")];
-		for (iI = 0; iI < GC.getDefineINT("MAX_TRADE_ROUTES"); iI++)
+		FAssertMsg((0 < GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES)),  "GC.getMAX_TRADE_ROUTES() is not greater than zero but an array is being allocated in CvCity::reset");
+		m_paTradeCities = new IDInfo[GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES)];
+		for (iI = 0; iI < GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES); iI++)
 		{
 			m_paTradeCities[iI].reset();
 		}
@@ -776,7 +778,7 @@ void CvCity::kill(bool bUpdatePlotGroups)
 
 	// UNOFFICIAL_PATCH, replace floodplains after city is removed, 03/04/10, jdog5000: START
 	if (pPlot->getBonusType() == NO_BONUS
-			&& GC.getDefineINT("FLOODPLAIN_AFTER_RAZE") > 0) // advc.129b
+			&& GC.getDefineINT(CvGlobals::FLOODPLAIN_AFTER_RAZE) > 0) // advc.129b
 	{
 		for (int iJ = 0; iJ < GC.getNumFeatureInfos(); iJ++)
 		{
@@ -840,7 +842,7 @@ void CvCity::kill(bool bUpdatePlotGroups)
 	{
 		if (GET_TEAM(GET_PLAYER(eOwner).getTeam()).isVassal((TeamTypes)iI))
 		{
-			pPlot->changeAdjacentSight((TeamTypes)iI, GC.getDefineINT("PLOT_VISIBILITY_RANGE"), false, NULL, false);
+			pPlot->changeAdjacentSight((TeamTypes)iI, GC.getDefineINT(CvGlobals::PLOT_VISIBILITY_RANGE), false, NULL, false);
 		}
 	}
 
@@ -848,7 +850,7 @@ void CvCity::kill(bool bUpdatePlotGroups)
 	{
 		if (abEspionageVisibility[iI])
 		{
-			pPlot->changeAdjacentSight((TeamTypes)iI, GC.getDefineINT("PLOT_VISIBILITY_RANGE"), false, NULL, false);
+			pPlot->changeAdjacentSight((TeamTypes)iI, GC.getDefineINT(CvGlobals::PLOT_VISIBILITY_RANGE), false, NULL, false);
 		}
 	}
 
@@ -880,6 +882,7 @@ void CvCity::kill(bool bUpdatePlotGroups)
 void CvCity::doTurn()  // advc.003: some style changes
 {
 	PROFILE("CvCity::doTurn()");
+	TurnTimer::Scope kTurnTimer(TurnTimer::CITY_DO_TURN); // advc.003s
 
 	int iI=-1;
 
@@ -984,9 +987,8 @@ void CvCity::doTurn()  // advc.003: some style changes
 
 	if (isOccupation() || (angryPopulation() > 0) || (healthRate() < 0))
 		setWeLoveTheKingDay(false);
-	else if (getPopulation() >= GC.getDefineINT("WE_LOVE_THE_KING_POPULATION_MIN_POPULATION") &&
-			GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(
-			"WE_LOVE_THE_KING_RAND"), "Do We Love The King?") < getPopulation())
+	else if (getPopulation() >= GC.getDefineINT(CvGlobals::WE_LOVE_THE_KING_POPULATION_MIN_POPULATION) &&
+			GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(CvGlobals::WE_LOVE_THE_KING_RAND), "Do We Love The King?") < getPopulation())
 		setWeLoveTheKingDay(true);
 	else setWeLoveTheKingDay(false);
 
@@ -1066,7 +1068,7 @@ void CvCity::doRevolt() {
 	PlayerTypes eCulturalOwner = calculateCulturalOwner();
 	// <advc.099c>
 	PlayerTypes eOwnerIgnRange = eCulturalOwner;
-	if(GC.getDefineINT("REVOLTS_IGNORE_CULTURE_RANGE") > 0)
+	if(GC.getDefineINT(CvGlobals::REVOLTS_IGNORE_CULTURE_RANGE) > 0)
 		eOwnerIgnRange = plot()->calculateCulturalOwner(true);
 	// If not within culture range, can revolt but not flip 
 	bool bCanFlip = (eOwnerIgnRange == eCulturalOwner);
@@ -1093,8 +1095,8 @@ void CvCity::doRevolt() {
 	** Changed number of revolt turns to not depend on iCityStrength,
 	** because iCityStrength can be huge. */
 	/* original bts code
-	pCity->changeOccupationTimer(GC.getDefineINT("BASE_REVOLT_OCCUPATION_TURNS")
-	+ ((iCityStrength * GC.getDefineINT("REVOLT_OCCUPATION_TURNS_PERCENT")) /
+	pCity->changeOccupationTimer(GC.getDefineINT(CvGlobals::BASE_REVOLT_OCCUPATION_TURNS)
+	+ ((iCityStrength * GC.getDefineINT(CvGlobals::REVOLT_OCCUPATION_TURNS_PERCENT)) /
 	100));*/
 	// <advc.023>
 	/*  Removed factor 2 from the second summand. K-Mod 1.45 changelog said:
@@ -1105,7 +1107,7 @@ void CvCity::doRevolt() {
 		This is just what I need now that the occupation timer decreases
 		probabilistically, but it wasn't committed to the K-Mod repository;
 		so I'm adding it here. */
-	int iTurnsOccupation = GC.getDefineINT("BASE_REVOLT_OCCUPATION_TURNS")
+	int iTurnsOccupation = GC.getDefineINT(CvGlobals::BASE_REVOLT_OCCUPATION_TURNS)
 			+ getNumRevolts(eCulturalOwner); // </advc.023>
 	// K-Mod end
 	changeNumRevolts(eCulturalOwner, 1);
@@ -1826,12 +1828,12 @@ bool CvCity::isWorldWondersMaxed() const
 		return false;
 	}
 
-	if (GC.getDefineINT("MAX_WORLD_WONDERS_PER_CITY") == -1)
+	if (GC.getDefineINT(CvGlobals::MAX_WORLD_WONDERS_PER_CITY) == -1)
 	{
 		return false;
 	}
 
-	if (getNumWorldWonders() >= GC.getDefineINT("MAX_WORLD_WONDERS_PER_CITY"))
+	if (getNumWorldWonders() >= GC.getDefineINT(CvGlobals::MAX_WORLD_WONDERS_PER_CITY))
 	{
 		return true;
 	}
@@ -1847,12 +1849,12 @@ bool CvCity::isTeamWondersMaxed() const
 		return false;
 	}
 
-	if (GC.getDefineINT("MAX_TEAM_WONDERS_PER_CITY") == -1)
+	if (GC.getDefineINT(CvGlobals::MAX_TEAM_WONDERS_PER_CITY) == -1)
 	{
 		return false;
 	}
 
-	if (getNumTeamWonders() >= GC.getDefineINT("MAX_TEAM_WONDERS_PER_CITY"))
+	if (getNumTeamWonders() >= GC.getDefineINT(CvGlobals::MAX_TEAM_WONDERS_PER_CITY))
 	{
 		return true;
 	}
@@ -1868,7 +1870,7 @@ bool CvCity::isNationalWondersMaxed() const
 		return false;
 	return (iLeft == 0);
 	// Moved into getNumNationalWondersLeft
-	/*int iMaxNumWonders = (GC.getGameINLINE().isOption(GAMEOPTION_ONE_CITY_CHALLENGE) && isHuman()) ? GC.getDefineINT("MAX_NATIONAL_WONDERS_PER_CITY_FOR_OCC") : GC.getDefineINT("MAX_NATIONAL_WONDERS_PER_CITY");
+	/*int iMaxNumWonders = (GC.getGameINLINE().isOption(GAMEOPTION_ONE_CITY_CHALLENGE) && isHuman()) ? GC.getDefineINT(CvGlobals::MAX_NATIONAL_WONDERS_PER_CITY_FOR_OCC) : GC.getDefineINT(CvGlobals::MAX_NATIONAL_WONDERS_PER_CITY);
 	if(iMaxNumWonders == -1) return false;
 	if(getNumNationalWonders() >= iMaxNumWonders) return true;
 	return false;*/
@@ -1878,8 +1880,8 @@ int CvCity::getNumNationalWondersLeft() const {
 
 	int iMaxNumWonders = (GC.getGameINLINE().isOption(
 			GAMEOPTION_ONE_CITY_CHALLENGE) && isHuman()) ?
-			GC.getDefineINT("MAX_NATIONAL_WONDERS_PER_CITY_FOR_OCC") :
-			GC.getDefineINT("MAX_NATIONAL_WONDERS_PER_CITY");
+			GC.getDefineINT(CvGlobals::MAX_NATIONAL_WONDERS_PER_CITY_FOR_OCC) :
+			GC.getDefineINT(CvGlobals::MAX_NATIONAL_WONDERS_PER_CITY);
 	if(iMaxNumWonders < 0)
 		return -1;
 	return std::max(0, iMaxNumWonders - getNumNationalWonders());
@@ -1893,12 +1895,12 @@ bool CvCity::isBuildingsMaxed() const
 		return false;
 	}
 
-	if (GC.getDefineINT("MAX_BUILDINGS_PER_CITY") == -1)
+	if (GC.getDefineINT(CvGlobals::MAX_BUILDINGS_PER_CITY) == -1)
 	{
 		return false;
 	}
 
-	if (getNumBuildings() >= GC.getDefineINT("MAX_BUILDINGS_PER_CITY"))
+	if (getNumBuildings() >= GC.getDefineINT(CvGlobals::MAX_BUILDINGS_PER_CITY))
 	{
 		return true;
 	}
@@ -3634,12 +3636,12 @@ int CvCity::getConscriptPopulation() const
 		return 0;
 	}
 
-	if (GC.getDefineINT("CONSCRIPT_POPULATION_PER_COST") == 0)
+	if (GC.getDefineINT(CvGlobals::CONSCRIPT_POPULATION_PER_COST) == 0)
 	{
 		return 0;
 	}
 
-	return std::max(1, ((GC.getUnitInfo(eConscriptUnit).getProductionCost()) / GC.getDefineINT("CONSCRIPT_POPULATION_PER_COST")));
+	return std::max(1, ((GC.getUnitInfo(eConscriptUnit).getProductionCost()) / GC.getDefineINT(CvGlobals::CONSCRIPT_POPULATION_PER_COST)));
 }
 
 
@@ -3647,7 +3649,7 @@ int CvCity::conscriptMinCityPopulation() const
 {
 	int iPopulation;
 
-	iPopulation = GC.getDefineINT("CONSCRIPT_MIN_CITY_POPULATION");
+	iPopulation = GC.getDefineINT(CvGlobals::CONSCRIPT_MIN_CITY_POPULATION);
 
 	iPopulation += getConscriptPopulation();
 
@@ -3657,7 +3659,7 @@ int CvCity::conscriptMinCityPopulation() const
 
 int CvCity::flatConscriptAngerLength() const
 {
-	int iAnger = GC.getDefineINT("CONSCRIPT_ANGER_DIVISOR");
+	int iAnger = GC.getDefineINT(CvGlobals::CONSCRIPT_ANGER_DIVISOR);
 
 	iAnger *= GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getHurryConscriptAngerPercent();
 	iAnger /= 100;
@@ -3693,7 +3695,7 @@ bool CvCity::canConscript() const
 		return false;
 	}
 
-	if (plot()->calculateTeamCulturePercent(getTeam()) < GC.getDefineINT("CONSCRIPT_MIN_CULTURE_PERCENT"))
+	if (plot()->calculateTeamCulturePercent(getTeam()) < GC.getDefineINT(CvGlobals::CONSCRIPT_MIN_CULTURE_PERCENT))
 	{
 		return false;
 	}
@@ -4355,11 +4357,11 @@ int CvCity::getOvercrowdingPercentAnger(int iExtra) const
 
 int CvCity::getNoMilitaryPercentAnger() const
 {
-	if(GC.getDefineINT("DEMAND_BETTER_PROTECTION") <= 0) // advc.500b
+	if(GC.getDefineINT(CvGlobals::DEMAND_BETTER_PROTECTION) <= 0) // advc.500b
 	{
 		int iAnger = 0;
 		if (getMilitaryHappinessUnits() == 0)
-			iAnger += GC.getDefineINT("NO_MILITARY_PERCENT_ANGER");
+			iAnger += GC.getDefineINT(CvGlobals::NO_MILITARY_PERCENT_ANGER);
 		return iAnger; // <advc.500b>
 	}
 	double actualGarrStr = garrisonStrength();
@@ -4369,7 +4371,7 @@ int CvCity::getNoMilitaryPercentAnger() const
 	/* Currently (as per vanilla) 334, meaning 33.4% of the population get angry.
 	   The caller adds up all the anger percentages (actually permillages)
 	   before rounding, so rounding shouldn't be a concern in this function. */
-	int iMaxAnger = GC.getDefineINT("NO_MILITARY_PERCENT_ANGER");
+	int iMaxAnger = GC.getDefineINT(CvGlobals::NO_MILITARY_PERCENT_ANGER);
 	return iMaxAnger - (int)(iMaxAnger * actualGarrStr / targetGarrStr);
 	// </advc.500b>
 }
@@ -4383,8 +4385,8 @@ int CvCity::getCulturePercentAnger() const
 
 	int iAngryCulture = 0;
 	// <advc.099>
-	int const iAngerModCB = GC.getDefineINT("CLOSED_BORDERS_CULTURE_ANGER_MODIFIER");
-	int const iAngerModWar = GC.getDefineINT("AT_WAR_CULTURE_ANGER_MODIFIER");
+	int const iAngerModCB = GC.getDefineINT(CvGlobals::CLOSED_BORDERS_CULTURE_ANGER_MODIFIER);
+	int const iAngerModWar = GC.getDefineINT(CvGlobals::AT_WAR_CULTURE_ANGER_MODIFIER);
 	for(int iI = 0; iI < MAX_PLAYERS; iI++) {
 		CvPlayer const& kRival = GET_PLAYER((PlayerTypes)iI);
 		if(!kRival.isEverAlive() || kRival.getTeam() == getTeam())
@@ -4408,7 +4410,7 @@ int CvCity::getCulturePercentAnger() const
 		iCulture /= 100;
 		iAngryCulture += iCulture;
 	} // </advc.099>
-	return (GC.getDefineINT("CULTURE_PERCENT_ANGER") * iAngryCulture) / iTotalCulture;
+	return (GC.getDefineINT(CvGlobals::CULTURE_PERCENT_ANGER) * iAngryCulture) / iTotalCulture;
 }
 
 // <advc.104>
@@ -4437,7 +4439,7 @@ double CvCity::getReligionPercentAnger(PlayerTypes ePlayer) const {
 		return 0;
 	double sameFaithCityRatio = kPlayer.getHasReligionCount(eReligion) / (double)g.getNumCities();
 	// normally 800
-	double angerFactor = GC.getDefineINT("RELIGION_PERCENT_ANGER") /
+	double angerFactor = GC.getDefineINT(CvGlobals::RELIGION_PERCENT_ANGER) /
 			(double)getReligionCount();
 	return sameFaithCityRatio * angerFactor;
 } // </advc.104>
@@ -4449,7 +4451,7 @@ int CvCity::getHurryPercentAnger(int iExtra) const
 
 	return ((((((getHurryAngerTimer() - 1) /
 			flatHurryAngerLength()) + 1) *
-			GC.getDefineINT("HURRY_POP_ANGER") *
+			GC.getDefineINT(CvGlobals::HURRY_POP_ANGER) *
 			GC.getPERCENT_ANGER_DIVISOR()) /
 			std::max(1, getPopulation() + iExtra)) + 1);
 }
@@ -4462,7 +4464,7 @@ int CvCity::getConscriptPercentAnger(int iExtra) const
 
 	return ((((((getConscriptAngerTimer() - 1) /
 			flatConscriptAngerLength()) + 1) *
-			GC.getDefineINT("CONSCRIPT_POP_ANGER") *
+			GC.getDefineINT(CvGlobals::CONSCRIPT_POP_ANGER) *
 			GC.getPERCENT_ANGER_DIVISOR()) /
 			std::max(1, getPopulation() + iExtra)) + 1);
 }
@@ -4474,7 +4476,7 @@ int CvCity::getDefyResolutionPercentAnger(int iExtra) const
 
 	return ((((((getDefyResolutionAngerTimer() - 1) /
 			flatDefyResolutionAngerLength()) + 1) *
-			GC.getDefineINT("DEFY_RESOLUTION_POP_ANGER") *
+			GC.getDefineINT(CvGlobals::DEFY_RESOLUTION_POP_ANGER) *
 			GC.getPERCENT_ANGER_DIVISOR()) /
 			std::max(1, getPopulation() + iExtra)) + 1);
 }
@@ -4512,7 +4514,7 @@ int CvCity::getVassalHappiness() const
 		if (GET_TEAM((TeamTypes)i).isVassal(getTeam())
 				&& !GET_TEAM((TeamTypes)i).isCapitulated()) // advc.142
 		{
-			iHappy += GC.getDefineINT("VASSAL_HAPPINESS");
+			iHappy += GC.getDefineINT(CvGlobals::VASSAL_HAPPINESS);
 			break; // advc.142
 		}
 	}
@@ -4522,13 +4524,13 @@ int CvCity::getVassalHappiness() const
 int CvCity::getVassalUnhappiness() const
 {	// <advc.003b> Replacing the BtS code below
 	if(GET_TEAM(getTeam()).isAVassal())
-		return GC.getDefineINT("VASSAL_HAPPINESS");
+		return GC.getDefineINT(CvGlobals::VASSAL_HAPPINESS);
 	return 0; // </advc.003b>
 	/*int iUnhappy = 0;
 	for (int i = 0; i < MAX_TEAMS; i++) {
 		if (getTeam() != i) {
 			if (GET_TEAM(getTeam()).isVassal((TeamTypes)i))
-				iUnhappy += GC.getDefineINT("VASSAL_HAPPINESS");
+				iUnhappy += GC.getDefineINT(CvGlobals::VASSAL_HAPPINESS);
 		}
 	}
 	return iUnhappy;*/
@@ -4605,7 +4607,7 @@ int CvCity::happyLevel() const
 
 	if (getHappinessTimer() > 0)
 	{
-		iHappiness += GC.getDefineINT("TEMP_HAPPY");
+		iHappiness += GC.getDefineINT(CvGlobals::TEMP_HAPPY);
 	}
 
 
@@ -5046,7 +5048,7 @@ int CvCity::hurryProduction(HurryTypes eHurry) const
 
 int CvCity::flatHurryAngerLength() const
 {
-	int iAnger = GC.getDefineINT("HURRY_ANGER_DIVISOR");
+	int iAnger = GC.getDefineINT(CvGlobals::HURRY_ANGER_DIVISOR);
 	iAnger *= GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getHurryConscriptAngerPercent();
 	iAnger /= 100;
 	iAnger *= std::max(0, 100 + getHurryAngerModifier());
@@ -5140,12 +5142,12 @@ int CvCity::cultureStrength(PlayerTypes ePlayer) const
 		strength += 10; // </advc.101>
 	/*  K-Mod, 7/jan/11, karadoc
 		changed so that culture strength asymptotes as the attacking culture approaches 100% */
-	//iStrength *= std::max(0, (GC.getDefineINT("REVOLT_TOTAL_CULTURE_MODIFIER") * (plot()->getCulture(ePlayer) - plot()->getCulture(getOwnerINLINE()))) / (plot()->getCulture(getOwnerINLINE()) + 1) + 100); //  K-Mod end
+	//iStrength *= std::max(0, (GC.getDefineINT(CvGlobals::REVOLT_TOTAL_CULTURE_MODIFIER) * (plot()->getCulture(ePlayer) - plot()->getCulture(getOwnerINLINE()))) / (plot()->getCulture(getOwnerINLINE()) + 1) + 100); //  K-Mod end
 	// <advc.101> Restored BtS formula; now using floating point operations
 	strength *= std::max(0.0, 1 +
 			/*  Don't like the multiplicative interaction between this and the
 				grievances; now added it to the grievances. */
-			//(GC.getDefineINT("REVOLT_TOTAL_CULTURE_MODIFIER") *
+			//(GC.getDefineINT(CvGlobals::REVOLT_TOTAL_CULTURE_MODIFIER) *
 			(plot()->getCulture(ePlayer) - plot()->getCulture(getOwnerINLINE())) /
 			(double)plot()->getCulture(ePlayer));
 	// New: Reduce strength if far less culture than some third party
@@ -5180,7 +5182,7 @@ int CvCity::cultureStrength(PlayerTypes ePlayer) const
 	double grievanceModifier = 0;
 	/*  100 in BtS XML; I've increased it to 200 to keep pace with K-Mod's
 		changes to culture spread */
-	grievanceModifier += -1 + (GC.getDefineINT("REVOLT_TOTAL_CULTURE_MODIFIER") / 100.0);
+	grievanceModifier += -1 + (GC.getDefineINT(CvGlobals::REVOLT_TOTAL_CULTURE_MODIFIER) / 100.0);
 	CvPlayer const& kRevoltPlayer = GET_PLAYER(ePlayer);
 	if(bReligionSuppressed || (kRevoltPlayer.isAlive() &&
 			(!GET_TEAM(kRevoltPlayer.getTeam()).isCapitulated() ||
@@ -5189,8 +5191,8 @@ int CvCity::cultureStrength(PlayerTypes ePlayer) const
 			isHasReligion(kRevoltPlayer.getStateReligion()))) {
 		// </advc.099c>
 		// advc.101: Replacing the code below
-		grievanceModifier += GC.getDefineINT("REVOLT_OFFENSE_STATE_RELIGION_MODIFIER") / 100.0;
-		//iStrength *= std::max(0, (GC.getDefineINT("REVOLT_OFFENSE_STATE_RELIGION_MODIFIER") + 100));
+		grievanceModifier += GC.getDefineINT(CvGlobals::REVOLT_OFFENSE_STATE_RELIGION_MODIFIER) / 100.0;
+		//iStrength *= std::max(0, (GC.getDefineINT(CvGlobals::REVOLT_OFFENSE_STATE_RELIGION_MODIFIER) + 100));
 		//iStrength /= 100;
 	}
 	if(eOwnerStateReligion != NO_RELIGION && isHasReligion(eOwnerStateReligion)) {
@@ -5199,13 +5201,13 @@ int CvCity::cultureStrength(PlayerTypes ePlayer) const
 			cancelling out when both applied (multiplication by 100+100 and then
 			by 100-50). I'm changing the values in XML so that they cancel out
 			when added up. */
-		grievanceModifier += GC.getDefineINT("REVOLT_DEFENSE_STATE_RELIGION_MODIFIER") / 100.0;
-		//iStrength *= std::max(0, (GC.getDefineINT("REVOLT_DEFENSE_STATE_RELIGION_MODIFIER") + 100));
+		grievanceModifier += GC.getDefineINT(CvGlobals::REVOLT_DEFENSE_STATE_RELIGION_MODIFIER) / 100.0;
+		//iStrength *= std::max(0, (GC.getDefineINT(CvGlobals::REVOLT_DEFENSE_STATE_RELIGION_MODIFIER) + 100));
 		//iStrength /= 100;
 	} /* No state religion is still better than some oppressive state religion that
 		 the city doesn't share. */
 	if(eOwnerStateReligion == NO_RELIGION) {
-		grievanceModifier += GC.getDefineINT("REVOLT_DEFENSE_STATE_RELIGION_MODIFIER")
+		grievanceModifier += GC.getDefineINT(CvGlobals::REVOLT_DEFENSE_STATE_RELIGION_MODIFIER)
 				/ 100.0;
 	} // <advc.099c>
 	if(getHurryAngerTimer() > 0)
@@ -5579,6 +5581,7 @@ void CvCity::setPopulation(int iNewValue)
 	if (iOldPopulation != iNewValue)
 	{
 		m_iPopulation = iNewValue;
+		getWPAI.invalidateTurnCache(); // advc.003z
 
 		FAssert(getPopulation() >= 0);
 
@@ -5743,7 +5746,7 @@ int CvCity::getTotalGreatPeopleRateModifier() const
 
 	if (GET_PLAYER(getOwnerINLINE()).isGoldenAge())
 	{
-		iModifier += GC.getDefineINT("GOLDEN_AGE_GREAT_PEOPLE_MODIFIER");
+		iModifier += GC.getDefineINT(CvGlobals::GOLDEN_AGE_GREAT_PEOPLE_MODIFIER);
 	}
 
 	return std::max(0, (iModifier + 100));
@@ -6263,13 +6266,13 @@ void CvCity::updateFreshWaterHealth()
 
 	if (plot()->isFreshWater())
 	{
-		if (GC.getDefineINT("FRESH_WATER_HEALTH_CHANGE") > 0)
+		if (GC.getDefineINT(CvGlobals::FRESH_WATER_HEALTH_CHANGE) > 0)
 		{
-			iNewGoodHealth += GC.getDefineINT("FRESH_WATER_HEALTH_CHANGE");
+			iNewGoodHealth += GC.getDefineINT(CvGlobals::FRESH_WATER_HEALTH_CHANGE);
 		}
 		else
 		{
-			iNewBadHealth += GC.getDefineINT("FRESH_WATER_HEALTH_CHANGE");
+			iNewBadHealth += GC.getDefineINT(CvGlobals::FRESH_WATER_HEALTH_CHANGE);
 		}
 	}
 
@@ -6549,7 +6552,7 @@ void CvCity::updatePowerHealth()
 
 	if (isPower())
 	{
-		int iPowerHealth = GC.getDefineINT("POWER_HEALTH_CHANGE");
+		int iPowerHealth = GC.getDefineINT(CvGlobals::POWER_HEALTH_CHANGE);
 		if (iPowerHealth > 0)
 		{
 			iNewGoodHealth += iPowerHealth;
@@ -6562,7 +6565,7 @@ void CvCity::updatePowerHealth()
 
 	if (isDirtyPower())
 	{
-		int iDirtyPowerHealth = GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE");
+		int iDirtyPowerHealth = GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE);
 		if (iDirtyPowerHealth > 0)
 		{
 			iNewGoodHealth += iDirtyPowerHealth;
@@ -6941,11 +6944,11 @@ int CvCity::getAdditionalHealthByBuilding(BuildingTypes eBuilding, int& iGood, i
 		// adding power
 		if (!isPower())
 		{
-			addGoodOrBad(GC.getDefineINT("POWER_HEALTH_CHANGE"), iGood, iBad);
+			addGoodOrBad(GC.getDefineINT(CvGlobals::POWER_HEALTH_CHANGE), iGood, iBad);
 
 			// adding dirty power
 			if (kBuilding.isDirtyPower())
-				addGoodOrBad(GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE"), iGood, iBad);
+				addGoodOrBad(GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE), iGood, iBad);
 		} /* advc.001h: Count change from dirty to clean only if we already have
 			 the resource (i.e. Uranium) */
 		else if(ePowBonus == NO_BONUS || hasBonus(ePowBonus))
@@ -6953,7 +6956,7 @@ int CvCity::getAdditionalHealthByBuilding(BuildingTypes eBuilding, int& iGood, i
 			// replacing dirty power with clean power
 			if (isDirtyPower() && !kBuilding.isDirtyPower())
 			{
-				subtractGoodOrBad(GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE"), iGood, iBad);
+				subtractGoodOrBad(GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE), iGood, iBad);
 			}
 		}
 	}
@@ -7330,7 +7333,7 @@ void CvCity::changeDefyResolutionAngerTimer(int iChange)
 
 int CvCity::flatDefyResolutionAngerLength() const
 {
-	int iAnger = GC.getDefineINT("DEFY_RESOLUTION_ANGER_DIVISOR");
+	int iAnger = GC.getDefineINT(CvGlobals::DEFY_RESOLUTION_ANGER_DIVISOR);
 
 	iAnger *= GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getHurryConscriptAngerPercent();
 	iAnger /= 100;
@@ -7747,7 +7750,7 @@ void CvCity::changeAirModifier(int iChange)
 
 int CvCity::getAirUnitCapacity(TeamTypes eTeam) const
 {
-	return (getTeam() == eTeam ? m_iAirUnitCapacity : GC.getDefineINT("CITY_AIR_UNIT_CAPACITY"));
+	return (getTeam() == eTeam ? m_iAirUnitCapacity : GC.getDefineINT(CvGlobals::CITY_AIR_UNIT_CAPACITY));
 }
 
 void CvCity::changeAirUnitCapacity(int iChange)
@@ -8941,14 +8944,14 @@ int CvCity::totalTradeModifier(CvCity* pOtherCity) const
 
 	if (isConnectedToCapital())
 	{
-		iModifier += GC.getDefineINT("CAPITAL_TRADE_MODIFIER");
+		iModifier += GC.getDefineINT(CvGlobals::CAPITAL_TRADE_MODIFIER);
 	}
 
 	if (NULL != pOtherCity)
 	{
 		if (area() != pOtherCity->area())
 		{
-			iModifier += GC.getDefineINT("OVERSEAS_TRADE_MODIFIER");
+			iModifier += GC.getDefineINT(CvGlobals::OVERSEAS_TRADE_MODIFIER);
 		}
 
 		if (getTeam() != pOtherCity->getTeam())
@@ -8964,7 +8967,7 @@ int CvCity::totalTradeModifier(CvCity* pOtherCity) const
 
 int CvCity::getPopulationTradeModifier() const
 {
-	return std::max(0, (getPopulation() + GC.getDefineINT("OUR_POPULATION_TRADE_MODIFIER_OFFSET")) * GC.getDefineINT("OUR_POPULATION_TRADE_MODIFIER"));
+	return std::max(0, (getPopulation() + GC.getDefineINT(CvGlobals::OUR_POPULATION_TRADE_MODIFIER_OFFSET)) * GC.getDefineINT(CvGlobals::OUR_POPULATION_TRADE_MODIFIER));
 }
 
 int CvCity::getPeaceTradeModifier(TeamTypes eTeam) const
@@ -8977,21 +8980,21 @@ int CvCity::getPeaceTradeModifier(TeamTypes eTeam) const
 		return 0;
 	}
 
-	int iPeaceTurns = std::min(GC.getDefineINT("FOREIGN_TRADE_FULL_CREDIT_PEACE_TURNS"), GET_TEAM(getTeam()).AI_getAtPeaceCounter(eTeam));
+	int iPeaceTurns = std::min(GC.getDefineINT(CvGlobals::FOREIGN_TRADE_FULL_CREDIT_PEACE_TURNS), GET_TEAM(getTeam()).AI_getAtPeaceCounter(eTeam));
 
 	if (GC.getGameINLINE().getElapsedGameTurns() <= iPeaceTurns)
 	{
-		return GC.getDefineINT("FOREIGN_TRADE_MODIFIER");
+		return GC.getDefineINT(CvGlobals::FOREIGN_TRADE_MODIFIER);
 	}
 
-	return ((GC.getDefineINT("FOREIGN_TRADE_MODIFIER") * iPeaceTurns) / std::max(1, GC.getDefineINT("FOREIGN_TRADE_FULL_CREDIT_PEACE_TURNS")));
+	return ((GC.getDefineINT(CvGlobals::FOREIGN_TRADE_MODIFIER) * iPeaceTurns) / std::max(1, GC.getDefineINT(CvGlobals::FOREIGN_TRADE_FULL_CREDIT_PEACE_TURNS)));
 }
 
 int CvCity::getBaseTradeProfit(CvCity* pCity) const
 {
-	int iProfit = std::min(pCity->getPopulation() * GC.getDefineINT("THEIR_POPULATION_TRADE_PERCENT"), plotDistance(getX_INLINE(), getY_INLINE(), pCity->getX_INLINE(), pCity->getY_INLINE()) * GC.getWorldInfo(GC.getMapINLINE().getWorldSize()).getTradeProfitPercent());
+	int iProfit = std::min(pCity->getPopulation() * GC.getDefineINT(CvGlobals::THEIR_POPULATION_TRADE_PERCENT), plotDistance(getX_INLINE(), getY_INLINE(), pCity->getX_INLINE(), pCity->getY_INLINE()) * GC.getWorldInfo(GC.getMapINLINE().getWorldSize()).getTradeProfitPercent());
 
-	iProfit *= GC.getDefineINT("TRADE_PROFIT_PERCENT");
+	iProfit *= GC.getDefineINT(CvGlobals::TRADE_PROFIT_PERCENT);
 	iProfit /= 100;
 
 	iProfit = std::max(100, iProfit);
@@ -10058,7 +10061,7 @@ double CvCity::revoltProbability(bool bIgnoreWar,
 	if(eCulturalOwner == NO_PLAYER || TEAMID(eCulturalOwner) == getTeam()
 			// <advc.099c> Barbarian revolts
 			|| (eCulturalOwner == BARBARIAN_PLAYER &&
-			GC.getDefineINT("BARBS_REVOLT") <= 0) ||
+			GC.getDefineINT(CvGlobals::BARBS_REVOLT) <= 0) ||
 			(GET_PLAYER(getOwnerINLINE()).getCurrentEra() <= 0 &&
 			g.gameTurn() - getGameTurnFounded() <
 			(10 * GC.getGameSpeedInfo(g.getGameSpeedType()).
@@ -10104,7 +10107,7 @@ double CvCity::probabilityOccupationDecrement() const {
 			return 0;
 	}
 	double r = std::pow(1 - revoltProbability(true, false, true),
-			GC.getDefineINT("OCCUPATION_COUNTDOWN_EXPONENT"));
+			GC.getDefineINT(CvGlobals::OCCUPATION_COUNTDOWN_EXPONENT));
 	// Don't use probabilities that are too small to be displayed
 	if(r < 0.001)
 		return 0;
@@ -10261,7 +10264,7 @@ double CvCity::getRevoltTestProbability() const // advc.101: Changed return type
 	iBestModifier = range(iBestModifier, 0, 100);
 
 	return std::min(1.0, // advc.101: Upper bound used to be handled by the caller
-			((GC.getDefineINT("REVOLT_TEST_PROB") * (100 - iBestModifier)) / 100.0)
+			((GC.getDefineINT(CvGlobals::REVOLT_TEST_PROB) * (100 - iBestModifier)) / 100.0)
 			// advc.101: Speed scaling as in K-Mod
 			/ GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).
 			getVictoryDelayPercent());
@@ -11006,9 +11009,9 @@ void CvCity::alterSpecialistCount(SpecialistTypes eIndex, int iChange)
 				{
 					changeSpecialistCount(eIndex, -1);
 
-					if ((eIndex != GC.getDefineINT("DEFAULT_SPECIALIST")) && (GC.getDefineINT("DEFAULT_SPECIALIST") != NO_SPECIALIST))
+					if ((eIndex != GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST)) && (GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST) != NO_SPECIALIST))
 					{
-						changeSpecialistCount(((SpecialistTypes)GC.getDefineINT("DEFAULT_SPECIALIST")), 1);
+						changeSpecialistCount(((SpecialistTypes)GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST)), 1);
 					}
 					else if (extraFreeSpecialists() > 0)
 					{
@@ -11062,7 +11065,7 @@ int CvCity::getMaxSpecialistCount(SpecialistTypes eIndex) const
 
 bool CvCity::isSpecialistValid(SpecialistTypes eIndex, int iExtra) const
 {
-	return (((getSpecialistCount(eIndex) + iExtra) <= getMaxSpecialistCount(eIndex)) || GET_PLAYER(getOwnerINLINE()).isSpecialistValid(eIndex) || (eIndex == GC.getDefineINT("DEFAULT_SPECIALIST")));
+	return (((getSpecialistCount(eIndex) + iExtra) <= getMaxSpecialistCount(eIndex)) || GET_PLAYER(getOwnerINLINE()).isSpecialistValid(eIndex) || (eIndex == GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST)));
 }
 
 
@@ -11438,9 +11441,9 @@ void CvCity::alterWorkingPlot(int iIndex)
 				{
 					setWorkingPlot(iIndex, false);
 
-					if (GC.getDefineINT("DEFAULT_SPECIALIST") != NO_SPECIALIST)
+					if (GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST) != NO_SPECIALIST)
 					{
-						changeSpecialistCount(((SpecialistTypes)GC.getDefineINT("DEFAULT_SPECIALIST")), 1);
+						changeSpecialistCount(((SpecialistTypes)GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST)), 1);
 					}
 					else
 					{
@@ -11770,9 +11773,8 @@ void CvCity::setHasReligion(ReligionTypes eIndex, bool bNewValue, bool bAnnounce
 	setInfoDirty(true);
 	// <advc.106e>
 	int iOwnerEra = kOwner.getCurrentEra();
-	int iEraThresh = GC.getDefineINT("STOP_RELIGION_SPREAD_ANNOUNCE_ERA");
-	bool bAnnounceStateReligionSpread = (GC.getDefineINT(
-			"ANNOUNCE_STATE_RELIGION_SPREAD") > 0);
+	int iEraThresh = GC.getDefineINT(CvGlobals::STOP_RELIGION_SPREAD_ANNOUNCE_ERA);
+	bool bAnnounceStateReligionSpread = (GC.getDefineINT(CvGlobals::ANNOUNCE_STATE_RELIGION_SPREAD) > 0);
 	// </advc.106e>
 	if (isHasReligion(eIndex))
 	{
@@ -11876,7 +11878,7 @@ int CvCity::getReligionGrip(ReligionTypes eReligion) const
 
 	if (isHasReligion(eReligion))
 	{
-		int iTempScore = GC.getDefineINT("RELIGION_INFLUENCE_POPULATION_WEIGHT") * getPopulation();
+		int iTempScore = GC.getDefineINT(CvGlobals::RELIGION_INFLUENCE_POPULATION_WEIGHT) * getPopulation();
 		// <advc.099c> Try to satisfy foreign pop
 		if(revoltProbability(true, false, true) > 0) {
 			PlayerTypes cultOwner = calculateCulturalOwner();
@@ -11886,7 +11888,7 @@ int CvCity::getReligionGrip(ReligionTypes eReligion) const
 		iScore += iTempScore; // </advc.099c>
 		if (GET_PLAYER(getOwnerINLINE()).getStateReligion() == eReligion)
 		{
-			iScore += GC.getDefineINT("RELIGION_INFLUENCE_STATE_RELIGION_WEIGHT");
+			iScore += GC.getDefineINT(CvGlobals::RELIGION_INFLUENCE_STATE_RELIGION_WEIGHT);
 		}
 	}
 
@@ -11894,7 +11896,7 @@ int CvCity::getReligionGrip(ReligionTypes eReligion) const
 	{
 		if (GC.getBuildingInfo((BuildingTypes)iI).getPrereqReligion() == eReligion)
 		{
-			iScore += GC.getDefineINT("RELIGION_INFLUENCE_BUILDING_WEIGHT") * getNumActiveBuilding((BuildingTypes)iI);
+			iScore += GC.getDefineINT(CvGlobals::RELIGION_INFLUENCE_BUILDING_WEIGHT) * getNumActiveBuilding((BuildingTypes)iI);
 		}
 	}
 
@@ -11902,16 +11904,16 @@ int CvCity::getReligionGrip(ReligionTypes eReligion) const
 	if (pHolyCity && isConnectedTo(pHolyCity))
 	{
 		if (pHolyCity->hasShrine(eReligion))
-			iScore += GC.getDefineINT("RELIGION_INFLUENCE_SHRINE_WEIGHT");
+			iScore += GC.getDefineINT(CvGlobals::RELIGION_INFLUENCE_SHRINE_WEIGHT);
 
 		int iDistance = plotDistance(getX_INLINE(), getY_INLINE(), pHolyCity->getX_INLINE(), pHolyCity->getY_INLINE());
-		iScore += GC.getDefineINT("RELIGION_INFLUENCE_DISTANCE_WEIGHT") * (GC.getMapINLINE().maxPlotDistance() - iDistance) / GC.getMapINLINE().maxPlotDistance();
+		iScore += GC.getDefineINT(CvGlobals::RELIGION_INFLUENCE_DISTANCE_WEIGHT) * (GC.getMapINLINE().maxPlotDistance() - iDistance) / GC.getMapINLINE().maxPlotDistance();
 	}
 
 	int iCurrentTurn = GC.getGame().getGameTurn();
 	int iTurnFounded = GC.getGame().getReligionGameTurnFounded(eReligion);
-	int iTimeScale = GC.getDefineINT("RELIGION_INFLUENCE_TIME_SCALE")*GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getVictoryDelayPercent()/100;
-	iScore += GC.getDefineINT("RELIGION_INFLUENCE_TIME_WEIGHT") * (iTurnFounded + iTimeScale) / (iCurrentTurn + iTimeScale);
+	int iTimeScale = GC.getDefineINT(CvGlobals::RELIGION_INFLUENCE_TIME_SCALE)*GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getVictoryDelayPercent()/100;
+	iScore += GC.getDefineINT(CvGlobals::RELIGION_INFLUENCE_TIME_WEIGHT) * (iTurnFounded + iTimeScale) / (iCurrentTurn + iTimeScale);
 
 	return iScore; // note. the random part is not included in this function.
 }
@@ -12068,7 +12070,7 @@ void CvCity::setHasCorporation(CorporationTypes eIndex, bool bNewValue, bool bAn
 
 						CvWString szBonusList;
 						bool bFirst = true;
-						for (int iJ = 0; iJ < GC.getDefineINT("NUM_CORPORATION_PREREQ_BONUSES"); ++iJ)
+						for (int iJ = 0; iJ < GC.getDefineINT(CvGlobals::NUM_CORPORATION_PREREQ_BONUSES); ++iJ)
 						{
 							int iBonus = GC.getCorporationInfo(eIndex).getPrereqBonus(iJ);
 							if (iBonus != NO_BONUS)
@@ -12114,7 +12116,7 @@ void CvCity::setHasCorporation(CorporationTypes eIndex, bool bNewValue, bool bAn
 CvCity* CvCity::getTradeCity(int iIndex) const
 {
 	FAssert(iIndex >= 0);
-	FAssert(iIndex < GC.getDefineINT("MAX_TRADE_ROUTES"));
+	FAssert(iIndex < GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES));
 	return getCity(m_paTradeCities[iIndex]);
 }
 
@@ -12134,13 +12136,13 @@ int CvCity::getTradeRoutes() const
 		iTradeRoutes += GET_PLAYER(getOwnerINLINE()).getCoastalTradeRoutes();
 	iTradeRoutes += getExtraTradeRoutes();
 
-	return std::min(iTradeRoutes, GC.getDefineINT("MAX_TRADE_ROUTES"));
+	return std::min(iTradeRoutes, GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES));
 }
 
 
 void CvCity::clearTradeRoutes()
 {
-	for (int iI = 0; iI < GC.getDefineINT("MAX_TRADE_ROUTES"); iI++)
+	for (int iI = 0; iI < GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES); iI++)
 	{
 		CvCity* pLoopCity = getTradeCity(iI);
 
@@ -12155,58 +12157,55 @@ void CvCity::clearTradeRoutes()
 
 
 // XXX eventually, this needs to be done when roads are built/destroyed...
-void CvCity::updateTradeRoutes() // advc.003: refactored
+void CvCity::updateTradeRoutes(std::vector<CvCity*> const* pCandidates) // advc.003: refactored
 {
-	int const iMaxTradeRoutes = GC.getDefineINT("MAX_TRADE_ROUTES");
+	int const iMaxTradeRoutes = GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES);
 	CvPlayer const& kOwner = GET_PLAYER(getOwnerINLINE());
 
 	clearTradeRoutes();
 
+	/*  advc.003af: Profit of the route in each slot; saves recomputing it for
+		the chosen routes below. */
+	std::vector<int> aiBestValue(iMaxTradeRoutes, 0);
 	if (!isDisorder() && !isPlundered())
 	{
 		int iTradeRoutes = getTradeRoutes();
-		bool bIgnorePlotGroups = (GC.getDefineINT("IGNORE_PLOT_GROUP_FOR_TRADE_ROUTES") > 0);
 		FAssert(iTradeRoutes <= iMaxTradeRoutes);
-		int* paiBestValue = new int[iMaxTradeRoutes](); // value-initialize
-		for(int iI = 0; iI < MAX_CIV_PLAYERS; iI++)
-		{
-			CvPlayer const& kPartner = GET_PLAYER((PlayerTypes)iI);
-			if(!kOwner.canHaveTradeRoutesWith(kPartner.getID()))
+		/*  <advc.003af> The search for candidates has moved into
+			CvPlayer::getTradeRouteCandidates so that the owner can do it
+			once for all its cities. */
+		std::map<CvPlotGroup*,std::vector<CvCity*> > candidateMap;
+		std::vector<CvCity*> const noCandidates;
+		if(pCandidates == NULL)
+		{
+			kOwner.getTradeRouteCandidates(candidateMap);
+			bool bIgnorePlotGroups = (GC.getDefineINT(CvGlobals::IGNORE_PLOT_GROUP_FOR_TRADE_ROUTES) > 0);
+			std::map<CvPlotGroup*,std::vector<CvCity*> >::const_iterator pos =
+					candidateMap.find(bIgnorePlotGroups ? NULL : plotGroup(kOwner.getID()));
+			pCandidates = (pos == candidateMap.end() ? &noCandidates : &pos->second);
+		} // </advc.003af>
+		for(size_t i = 0; i < pCandidates->size(); i++)
+		{
+			CvCity* pLoopCity = (*pCandidates)[i];
+			if(pLoopCity == this)
+				continue;
+			if(pLoopCity->isTradeRoute(kOwner.getID()) && getTeam() != pLoopCity->getTeam())
 				continue;
-			int iLoop;
-			for(CvCity* pLoopCity = kPartner.firstCity(&iLoop);
-					pLoopCity != NULL; pLoopCity = kPartner.nextCity(&iLoop))
+			int iValue = calculateTradeProfit(pLoopCity);
+			for (int iJ = 0; iJ < iTradeRoutes; iJ++)
 			{
-				if(pLoopCity == this)
-					continue;
-				/*  <advc.124> A connection along revealed tiles ensures that the
-					city tile is revealed, but this doesn't imply that the city is
-					also revealed: The tile could've been explored before the city
-					existed. Need to check CvCity::isRevealed explicitly. */
-				if(pLoopCity->isDisorder() || !pLoopCity->isRevealed(getTeam(), false))
-					continue; // <advc.124>
-				if(pLoopCity->isTradeRoute(kOwner.getID()) && getTeam() != kPartner.getTeam())
+				if(iValue <= aiBestValue[iJ])
 					continue;
-				if(!bIgnorePlotGroups && pLoopCity->plotGroup(kOwner.getID()) !=
-						plotGroup(kOwner.getID()))
-					continue;
-				int iValue = calculateTradeProfit(pLoopCity);
-				for (int iJ = 0; iJ < iTradeRoutes; iJ++)
+				for (int iK = iTradeRoutes - 1; iK > iJ; iK--)
 				{
-					if(iValue <= paiBestValue[iJ])
-						continue;
-					for (int iK = iTradeRoutes - 1; iK > iJ; iK--)
-					{
-						paiBestValue[iK] = paiBestValue[(iK - 1)];
-						m_paTradeCities[iK] = m_paTradeCities[(iK - 1)];
-					}
-					paiBestValue[iJ] = iValue;
-					m_paTradeCities[iJ] = pLoopCity->getIDInfo();
-					break;
+					aiBestValue[iK] = aiBestValue[(iK - 1)];
+					m_paTradeCities[iK] = m_paTradeCities[(iK - 1)];
 				}
+				aiBestValue[iJ] = iValue;
+				m_paTradeCities[iJ] = pLoopCity->getIDInfo();
+				break;
 			}
 		}
-		SAFE_DELETE_ARRAY(paiBestValue);
 	}
 
 	int iTradeProfit = 0;
@@ -12216,7 +12215,7 @@ void CvCity::updateTradeRoutes() // advc.003: refactored
 		if (pLoopCity != NULL)
 		{
 			pLoopCity->setTradeRoute(kOwner.getID(), true);
-			iTradeProfit += calculateTradeProfit(pLoopCity);
+			iTradeProfit += aiBestValue[iI]; // advc.003af (was calculateTradeProfit)
 		}
 	}
 
@@ -12915,12 +12914,12 @@ void CvCity::doCulture()
 	int iLevel = getCultureLevel();
 	if (iLevel > 0)
 	{	// advc.125:
-		int iUseKModTradeCulture = GC.getDefineINT("USE_KMOD_TRADE_CULTURE");
+		int iUseKModTradeCulture = GC.getDefineINT(CvGlobals::USE_KMOD_TRADE_CULTURE);
 		// add up the culture contribution for each player before applying it
 		// so that we avoid excessive calls to change culture and reduce rounding errors
 		int iTradeCultureTimes100[MAX_PLAYERS] = {};
 
-		for (iI = 0; iI < GC.getDefineINT("MAX_TRADE_ROUTES"); iI++)
+		for (iI = 0; iI < GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES); iI++)
 		{
 			CvCity* pLoopCity = getTradeCity(iI);
 			if(pLoopCity != NULL)
@@ -13014,7 +13013,7 @@ void CvCity::doPlotCultureTimes100(bool bUpdate, PlayerTypes ePlayer, int iCultu
 	// <advc.025>
 	int iCultureToMaster = 100;
 	if(GET_TEAM(getTeam()).isCapitulated())
-		iCultureToMaster = GC.getDefineINT("CAPITULATED_TO_MASTER_CULTURE_PERCENT");
+		iCultureToMaster = GC.getDefineINT(CvGlobals::CAPITULATED_TO_MASTER_CULTURE_PERCENT);
 	// </advc.025>
 	for (int iDX = -iCultureRange; iDX <= iCultureRange; iDX++)
 	{
@@ -13065,7 +13064,7 @@ bool CvCity::doCheckProduction()  // advc.003:some style changes
 			continue;
 		if (kOwner.isProductionMaxedUnitClass((UnitClassTypes)GC.getUnitInfo((UnitTypes)iI).getUnitClassType()))
 		{	// advc.123f: Commented out (fail gold from national units)
-			/*int iProductionGold = ((getUnitProduction((UnitTypes)iI) * GC.getDefineINT("MAXED_UNIT_GOLD_PERCENT")) / 100);
+			/*int iProductionGold = ((getUnitProduction((UnitTypes)iI) * GC.getDefineINT(CvGlobals::MAXED_UNIT_GOLD_PERCENT)) / 100);
 			if (iProductionGold > 0) {
 				owner.changeGold(iProductionGold);
 				szBuffer = gDLL->getText("TXT_KEY_MISC_LOST_WONDER_PROD_CONVERTED", getNameKey(), GC.getUnitInfo((UnitTypes)iI).getTextKeyWide(), iProductionGold);
@@ -13081,7 +13080,7 @@ bool CvCity::doCheckProduction()  // advc.003:some style changes
 			continue;
 		if (kOwner.isProductionMaxedBuildingClass((BuildingClassTypes)(GC.getBuildingInfo((BuildingTypes)iI).getBuildingClassType())))
 		{	// advc.123f: Commented out. Fail gold now handled in popOrder.
-			/*iProductionGold = ((getBuildingProduction((BuildingTypes)iI) * GC.getDefineINT("MAXED_BUILDING_GOLD_PERCENT")) / 100);
+			/*iProductionGold = ((getBuildingProduction((BuildingTypes)iI) * GC.getDefineINT(CvGlobals::MAXED_BUILDING_GOLD_PERCENT)) / 100);
 			if(iProductionGold > 0) {
 				owner.changeGold(iProductionGold);
 				szBuffer = gDLL->getText("TXT_KEY_MISC_LOST_WONDER_PROD_CONVERTED", getNameKey(), GC.getBuildingInfo((BuildingTypes)iI).getTextKeyWide(), iProductionGold);
@@ -13097,7 +13096,7 @@ bool CvCity::doCheckProduction()  // advc.003:some style changes
 			continue;
 		if (kOwner.isProductionMaxedProject((ProjectTypes)iI))
 		{	// advc.123f: Commented out. Fail gold now handled in popOrder.
-			/*iProductionGold = ((getProjectProduction((ProjectTypes)iI) * GC.getDefineINT("MAXED_BUILDING_GOLD_PERCENT")) / 100);
+			/*iProductionGold = ((getProjectProduction((ProjectTypes)iI) * GC.getDefineINT(CvGlobals::MAXED_BUILDING_GOLD_PERCENT)) / 100);
 			if(iProductionGold > 0) {
 				owner.changeGold(iProductionGold);
 				szBuffer = gDLL->getText("TXT_KEY_MISC_LOST_WONDER_PROD_CONVERTED", getNameKey(), GC.getProjectInfo((ProjectTypes)iI).getTextKeyWide(), iProductionGold);
@@ -13257,10 +13256,10 @@ void CvCity::doDecay()
 				if (isHuman())
 				{
 					int iGameSpeedPercent = GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getConstructPercent();
-					if (100 * getBuildingProductionTime(eBuilding) > GC.getDefineINT("BUILDING_PRODUCTION_DECAY_TIME") * iGameSpeedPercent)
+					if (100 * getBuildingProductionTime(eBuilding) > GC.getDefineINT(CvGlobals::BUILDING_PRODUCTION_DECAY_TIME) * iGameSpeedPercent)
 					{
 						int iProduction = getBuildingProduction(eBuilding);
-						setBuildingProduction(eBuilding, iProduction - (iProduction * (100 - GC.getDefineINT("BUILDING_PRODUCTION_DECAY_PERCENT")) + iGameSpeedPercent - 1) / iGameSpeedPercent);
+						setBuildingProduction(eBuilding, iProduction - (iProduction * (100 - GC.getDefineINT(CvGlobals::BUILDING_PRODUCTION_DECAY_PERCENT)) + iGameSpeedPercent - 1) / iGameSpeedPercent);
 					}
 				}
 			}
@@ -13283,10 +13282,10 @@ void CvCity::doDecay()
 				if (isHuman())
 				{
 					int iGameSpeedPercent = GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getTrainPercent();
-					if (100 * getUnitProductionTime(eUnit) > GC.getDefineINT("UNIT_PRODUCTION_DECAY_TIME") * iGameSpeedPercent)
+					if (100 * getUnitProductionTime(eUnit) > GC.getDefineINT(CvGlobals::UNIT_PRODUCTION_DECAY_TIME) * iGameSpeedPercent)
 					{
 						int iProduction = getUnitProduction(eUnit);
-						setUnitProduction(eUnit, iProduction - (iProduction * (100 - GC.getDefineINT("UNIT_PRODUCTION_DECAY_PERCENT")) + iGameSpeedPercent - 1) / iGameSpeedPercent);
+						setUnitProduction(eUnit, iProduction - (iProduction * (100 - GC.getDefineINT(CvGlobals::UNIT_PRODUCTION_DECAY_PERCENT)) + iGameSpeedPercent - 1) / iGameSpeedPercent);
 					}
 				}
 			}
@@ -13326,9 +13325,9 @@ void CvCity::doReligion()
 	std::vector<std::pair<int, ReligionTypes> > religion_grips;
 	ReligionTypes eWeakestReligion = NO_RELIGION; // weakest religion already in the city
 	int iWeakestGrip = MAX_INT;
-	int iRandomWeight = GC.getDefineINT("RELIGION_INFLUENCE_RANDOM_WEIGHT");
-	int iDivisorBase = GC.getDefineINT("RELIGION_SPREAD_DIVISOR_BASE");
-	int iDistanceFactor = GC.getDefineINT("RELIGION_SPREAD_DISTANCE_FACTOR");
+	int iRandomWeight = GC.getDefineINT(CvGlobals::RELIGION_INFLUENCE_RANDOM_WEIGHT);
+	int iDivisorBase = GC.getDefineINT(CvGlobals::RELIGION_SPREAD_DIVISOR_BASE);
+	int iDistanceFactor = GC.getDefineINT(CvGlobals::RELIGION_SPREAD_DISTANCE_FACTOR);
 
 	for (int iI = 0; iI < GC.getNumReligionInfos(); iI++)
 	{
@@ -13393,7 +13392,7 @@ void CvCity::doReligion()
 
 						if (iSpread > 0)
 						{
-							//iSpread /= std::max(1, (((GC.getDefineINT("RELIGION_SPREAD_DISTANCE_DIVISOR") * plotDistance(getX_INLINE(), getY_INLINE(), pLoopCity->getX_INLINE(), pLoopCity->getY_INLINE())) / GC.getMapINLINE().maxPlotDistance()) - 5));
+							//iSpread /= std::max(1, (((GC.getDefineINT(CvGlobals::RELIGION_SPREAD_DISTANCE_DIVISOR) * plotDistance(getX_INLINE(), getY_INLINE(), pLoopCity->getX_INLINE(), pLoopCity->getY_INLINE())) / GC.getMapINLINE().maxPlotDistance()) - 5));
 
 							// K-Mod. The original formula basically divided the spread by the percent of max distance. (RELIGION_SPREAD_DISTANCE_DIVISOR == 100)
 							// In my view, this produced too much spread at short distance, and too little at long.
@@ -13431,7 +13430,7 @@ void CvCity::doReligion()
 		} */
 		//
 
-		if (GC.getGameINLINE().getSorenRandNum(GC.getDefineINT("RELIGION_SPREAD_RAND"), "Religion Spread") < iRandThreshold)
+		if (GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(CvGlobals::RELIGION_SPREAD_RAND), "Religion Spread") < iRandThreshold)
 		{
 			setHasReligion(eLoopReligion, true, true, true);
 			if (iWeakestGrip < iLoopGrip)
@@ -13797,7 +13796,7 @@ void CvCity::read(FDataStreamBase* pStream)
 	pStream->Read(GC.getNumReligionInfos(), m_pabHasReligion);
 	pStream->Read(GC.getNumCorporationInfos(), m_pabHasCorporation);
 
-	for (iI=0;iI<GC.getDefineINT("MAX_TRADE_ROUTES");iI++)
+	for (iI=0;iI<GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES);iI++)
 	{
 		pStream->Read((int*)&m_paTradeCities[iI].eOwner);
 		pStream->Read(&m_paTradeCities[iI].iID);
@@ -14055,7 +14054,7 @@ void CvCity::write(FDataStreamBase* pStream)
 	pStream->Write(GC.getNumReligionInfos(), m_pabHasReligion);
 	pStream->Write(GC.getNumCorporationInfos(), m_pabHasCorporation);
 
-	for (iI=0;iI<GC.getDefineINT("MAX_TRADE_ROUTES");iI++)
+	for (iI=0;iI<GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES);iI++)
 	{
 		pStream->Write(m_paTradeCities[iI].eOwner);
 		pStream->Write(m_paTradeCities[iI].iID);
@@ -15416,7 +15415,7 @@ void CvCity::liberate(bool bConquest, /* advc.122: */ bool bCede)
 			// K-Mod end
 		}
 		if (GET_TEAM(GET_PLAYER(ePlayer).getTeam()).isAVassal()) {
-			for (int i = 0; i < GC.getDefineINT("COLONY_NUM_FREE_DEFENDERS"); ++i)
+			for (int i = 0; i < GC.getDefineINT(CvGlobals::COLONY_NUM_FREE_DEFENDERS); ++i)
 				pCity->initConscriptedUnit();
 		}
 	}*/
@@ -15701,7 +15700,7 @@ void CvCity::getBuildQueue(std::vector<std::string>& astrQueue) const
 // <advc.004b> See CvCity.h
 int CvCity::initialPopulation() {
 
-	return GC.getDefineINT("INITIAL_CITY_POPULATION") +
+	return GC.getDefineINT(CvGlobals::INITIAL_CITY_POPULATION) +
 			GC.getEraInfo(GC.getGameINLINE().getStartEra()).getFreePopulation();
 }
 
@@ -15720,7 +15719,7 @@ int CvCity::calculateDistanceMaintenanceTimes100(CvPlot const& kCityPlot,
 	iWorstCityMaintenance = 0;
 	iBestCapitalMaintenance = MAX_INT;
 	for (pLoopCity = GET_PLAYER(getOwnerINLINE()).firstCity(&iLoop); pLoopCity != NULL; pLoopCity = GET_PLAYER(getOwnerINLINE()).nextCity(&iLoop))
-		iTempMaintenance = 100 * (GC.getDefineINT("MAX_DISTANCE_CITY_MAINTENANCE") * plotDistance(getX_INLINE(), getY_INLINE(), pLoopCity->getX_INLINE(), pLoopCity->getY_INLINE()));*/
+		iTempMaintenance = 100 * (GC.getDefineINT(CvGlobals::MAX_DISTANCE_CITY_MAINTENANCE) * plotDistance(getX_INLINE(), getY_INLINE(), pLoopCity->getX_INLINE(), pLoopCity->getY_INLINE()));*/
 	// K-Mod, 17/dec/10
 	// Moved the search for maintenance distance to a separate function and improved the efficiency
 	int iTempMaintenance = 100 * GC.getMAX_DISTANCE_CITY_MAINTENANCE() *
@@ -15960,9 +15959,9 @@ int CvCity::failGoldPercent(OrderTypes eOrder) const { // Fail and overflow gold
 		fail gold to the Wealth process. */
 	int r = GC.getProcessInfo((ProcessTypes)0).getProductionToCommerceModifier(COMMERCE_GOLD);
 	switch(eOrder) {
-	case ORDER_TRAIN: r *= GC.getDefineINT("MAXED_UNIT_GOLD_PERCENT"); break;
-	case ORDER_CONSTRUCT: r *= GC.getDefineINT("MAXED_BUILDING_GOLD_PERCENT"); break;
-	case ORDER_CREATE: r *= GC.getDefineINT("MAXED_PROJECT_GOLD_PERCENT"); break;
+	case ORDER_TRAIN: r *= GC.getDefineINT(CvGlobals::MAXED_UNIT_GOLD_PERCENT); break;
+	case ORDER_CONSTRUCT: r *= GC.getDefineINT(CvGlobals::MAXED_BUILDING_GOLD_PERCENT); break;
+	case ORDER_CREATE: r *= GC.getDefineINT(CvGlobals::MAXED_PROJECT_GOLD_PERCENT); break;
 	default: r *= 100; FAssert(false);
 	}
 	return r / 100;
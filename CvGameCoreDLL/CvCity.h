@@ -941,7 +941,8 @@ public:
 	CvCity* getTradeCity(int iIndex) const;																				// Exposed to Python
 	int getTradeRoutes() const;																										// Exposed to Python
 	void clearTradeRoutes();
-	void updateTradeRoutes();
+	// advc.003af: Param added; candidates from CvPlayer::getTradeRouteCandidates
+	void updateTradeRoutes(std::vector<CvCity*> const* pCandidates = NULL);
 
 	void clearOrderQueue();																														// Exposed to Python
 	//void pushOrder(OrderTypes eOrder, int iData1, int iData2, bool bSave, bool bPop, bool bAppend, bool bForce = false);		// Exposed to Python
@@ -203,7 +203,7 @@ void CvCityAI::AI_assignWorkingPlots()
 	PROFILE_FUNC();
 
 	/* original bts code
-	if (0 != GC.getDefineINT("AI_SHOULDNT_MANAGE_PLOT_ASSIGNMENT"))
+	if (0 != GC.getDefineINT(CvGlobals::AI_SHOULDNT_MANAGE_PLOT_ASSIGNMENT))
 	{
 		return;
 	} */ // K-Mod. that option would break a bunch of stuff.
@@ -3516,7 +3516,7 @@ BuildingTypes CvCityAI::AI_bestBuildingThreshold(int iFocusFlags, int iMaxTurns,
 			}
 			if (iLimit != -1)
 			{
-				const int iMaxNumWonders = (g.isOption(GAMEOPTION_ONE_CITY_CHALLENGE) && isHuman()) ? GC.getDefineINT("MAX_NATIONAL_WONDERS_PER_CITY_FOR_OCC") : GC.getDefineINT("MAX_NATIONAL_WONDERS_PER_CITY");
+				const int iMaxNumWonders = (g.isOption(GAMEOPTION_ONE_CITY_CHALLENGE) && isHuman()) ? GC.getDefineINT(CvGlobals::MAX_NATIONAL_WONDERS_PER_CITY_FOR_OCC) : GC.getDefineINT(CvGlobals::MAX_NATIONAL_WONDERS_PER_CITY);
 
 				if (isNationalWonderClass(eLoopClass) && iMaxNumWonders != -1)
 				{
@@ -3946,7 +3946,7 @@ int CvCityAI::AI_buildingValue(BuildingTypes eBuilding, int iFocusFlags,
 				future holds electrical power and other baddies) */
 			if(iOwnerEra >= 4 && !isPower()) {
 				// NB: POWER_HEALTH_CHANGE is negative
-				iFutureHealthLevel += GC.getDefineINT("POWER_HEALTH_CHANGE") / 2;
+				iFutureHealthLevel += GC.getDefineINT(CvGlobals::POWER_HEALTH_CHANGE) / 2;
 			}
 			/*  And replaced four instances of iHealthLevel with iFutureHealthLevel
 				in this block of code ... */
@@ -4104,7 +4104,7 @@ int CvCityAI::AI_buildingValue(BuildingTypes eBuilding, int iFocusFlags,
 			// K-Mod. (original code deleted)
 			int iSpecialistsValue = 0;
 			//int iUnusedSpecialists = 0;
-			SpecialistTypes eDefaultSpecialist = (SpecialistTypes)GC.getDefineINT("DEFAULT_SPECIALIST");
+			SpecialistTypes eDefaultSpecialist = (SpecialistTypes)GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST);
 			int iAvailableWorkers = iFoodDifference/2 + (eDefaultSpecialist == NO_SPECIALIST ? 0 : getSpecialistCount(eDefaultSpecialist));
 			for (SpecialistTypes eLoopSpec = (SpecialistTypes)0; eLoopSpec < GC.getNumSpecialistInfos(); eLoopSpec = (SpecialistTypes)(eLoopSpec+1))
 			{
@@ -6527,7 +6527,7 @@ void CvCityAI::AI_updateSafety(double relativeCityVal) {
 	}
 	// Only bail if they can take the city in one turn or almost
 	if(iAttackers + 1 >= plot()->getNumDefenders(getOwnerINLINE())) {
-		int iThresh = GC.getDefineINT("AI_EVACUATION_THRESH");
+		int iThresh = GC.getDefineINT(CvGlobals::AI_EVACUATION_THRESH);
 		//  Higher threshold for important cities
 		if(relativeCityVal > 0.5)
 			iThresh = ::round(iThresh * (0.5 + relativeCityVal));
@@ -7834,6 +7834,25 @@ void CvCityAI::AI_updateBestBuild()
 		iHealthAdjust += getBuildingHealth(getProductionBuilding());
 	}*/
 
+	/*  <advc.003an> Improvements that none of our builds can create yet (because
+		the tech prereqs are missing) needn't be evaluated on every plot. The
+		remaining inputs of AI_bestPlotBuild - neighboring plots, city growth and
+		health, the owner's strategies and gold - are too varied to cache the
+		per-plot results safely, so only this plot-independent check is shared. */
+	std::vector<bool> abImprovementAvailable(GC.getNumImprovementInfos(), false);
+	{
+		CvTeam const& kTeam = GET_TEAM(getTeam());
+		for (int i = 0; i < GC.getNumBuildInfos(); i++)
+		{
+			CvBuildInfo const& kBuild = GC.getBuildInfo((BuildTypes)i);
+			if (kBuild.getImprovement() == NO_IMPROVEMENT)
+				continue;
+			TechTypes eTechPrereq = (TechTypes)kBuild.getTechPrereq();
+			if (eTechPrereq == NO_TECH || kTeam.isHasTech(eTechPrereq))
+				abImprovementAvailable[kBuild.getImprovement()] = true;
+		}
+	} // </advc.003an>
+
 	for (int iI = 0; iI < NUM_CITY_PLOTS; iI++)
 	{
 		if (iI != CITY_HOME_PLOT)
@@ -7845,7 +7864,8 @@ void CvCityAI::AI_updateBestBuild()
 				BuildTypes eLastBestBuildType = m_aeBestBuild[iI];
 
 				//AI_bestPlotBuild(pLoopPlot, &(m_aiBestBuildValue[iI]), &(m_aeBestBuild[iI]), iFoodMultiplier, iProductionMultiplier, iCommerceMultiplier, bChop, iHappyAdjust, iHealthAdjust, iDesiredFoodChange);
-				AI_bestPlotBuild(pLoopPlot, &(m_aiBestBuildValue[iI]), &(m_aeBestBuild[iI]), iFoodMultiplier, iProductionMultiplier, iCommerceMultiplier, bChop, 0, 0, iDesiredFoodChange);
+				AI_bestPlotBuild(pLoopPlot, &(m_aiBestBuildValue[iI]), &(m_aeBestBuild[iI]), iFoodMultiplier, iProductionMultiplier, iCommerceMultiplier, bChop, 0, 0, iDesiredFoodChange,
+						&abImprovementAvailable); // advc.003an
 				//int iWorkerCount = GET_PLAYER(getOwnerINLINE()).AI_plotTargetMissionAIs(pLoopPlot, MISSIONAI_BUILD); // K-Mod, originally this was all workers at the city.
 				/* m_aiBestBuildValue[iI] *= 4;
 				m_aiBestBuildValue[iI] += 3 + iWorkerCount; // (round up)
@@ -8130,11 +8150,11 @@ void CvCityAI::AI_doDraft(bool bForce)
 	// K-Mod. See if our drafted unit is particularly good value.
 	// (cf. my calculation in CvPlayerAI::AI_civicValue)
 	UnitTypes eConscriptUnit = getConscriptUnit();
-	int iConscriptPop = std::max(1, GC.getUnitInfo(eConscriptUnit).getProductionCost() / GC.getDefineINT("CONSCRIPT_POPULATION_PER_COST"));
+	int iConscriptPop = std::max(1, GC.getUnitInfo(eConscriptUnit).getProductionCost() / GC.getDefineINT(CvGlobals::CONSCRIPT_POPULATION_PER_COST));
 
 	// call it "good value" if we get at least 1.4 times the normal hammers-per-conscript-pop.
 	// (with standard settings, this only happens for riflemen)
-	bool bGoodValue = 10 * GC.getUnitInfo(eConscriptUnit).getProductionCost() / (iConscriptPop * GC.getDefineINT("CONSCRIPT_POPULATION_PER_COST")) >= 14;
+	bool bGoodValue = 10 * GC.getUnitInfo(eConscriptUnit).getProductionCost() / (iConscriptPop * GC.getDefineINT(CvGlobals::CONSCRIPT_POPULATION_PER_COST)) >= 14;
 
 	// one more thing... it's not "good value" if we already have too many troops.
 	if (!bLandWar && bGoodValue)
@@ -8155,7 +8175,7 @@ void CvCityAI::AI_doDraft(bool bForce)
 	if(!bDanger && !kOwner.AI_isFocusWar() && !bTooMuchPop)
 		return; // </advc.017>
 	// Large cities want a little spare happiness
-	int iHappyDiff = GC.getDefineINT("CONSCRIPT_POP_ANGER") - iConscriptPop + (bGoodValue ? 0 : getPopulation()/10);
+	int iHappyDiff = GC.getDefineINT(CvGlobals::CONSCRIPT_POP_ANGER) - iConscriptPop + (bGoodValue ? 0 : getPopulation()/10);
 
 	if((!bGoodValue && !bLandWar) || angryPopulation(iHappyDiff) > 0)
 		return; // advc.003
@@ -8277,7 +8297,7 @@ void CvCityAI::AI_doHurry(bool bForce)
 		{
 			if (!isNoUnhappiness())
 			{
-				iHappyDiff = iHurryPopulation - GC.getDefineINT("HURRY_POP_ANGER");
+				iHappyDiff = iHurryPopulation - GC.getDefineINT(CvGlobals::HURRY_POP_ANGER);
 
 				if (iHurryAngerLength > 0 && getHurryAngerTimer() > 1)
 					iHappyDiff -= ROUND_DIVIDE((kOwner.AI_getFlavorValue(FLAVOR_GROWTH) > 0 ? 4 : 3) * getHurryAngerTimer(), iHurryAngerLength);
@@ -8308,7 +8328,7 @@ void CvCityAI::AI_doHurry(bool bForce)
 				return;
 			}
 
-			iPopCost = AI_citizenSacrificeCost(iHurryPopulation, iHappy, GC.getDefineINT("HURRY_POP_ANGER"), iHurryAngerLength);
+			iPopCost = AI_citizenSacrificeCost(iHurryPopulation, iHappy, GC.getDefineINT(CvGlobals::HURRY_POP_ANGER), iHurryAngerLength);
 			iPopCost += std::max(0, 6 * -iHappyDiff) * iHurryAngerLength;
 
 			if (kOwner.isHuman()) 
@@ -8854,7 +8874,7 @@ bool CvCityAI::AI_bestSpreadUnit(bool bMissionary, bool bExecutive, int iBaseCha
 										int iCost = std::max(0, GC.getCorporationInfo(eCorporation).getSpreadCost() * (100 + GET_PLAYER(getOwnerINLINE()).calculateInflationRate()));
 										iCost /= 100;
 										if (kPlayer.getGold() >= iCost) {
-											iCost *= GC.getDefineINT("CORPORATION_FOREIGN_SPREAD_COST_PERCENT");
+											iCost *= GC.getDefineINT(CvGlobals::CORPORATION_FOREIGN_SPREAD_COST_PERCENT);
 											iCost /= 100;
 											if (kPlayer.getGold() < iCost && iTotalCount > 1)
 												iCorporationValue /= 2;
@@ -9023,16 +9043,16 @@ bool CvCityAI::AI_removeWorstCitizen(SpecialistTypes eIgnoreSpecialist)
 	if (extraFreeSpecialists() < 0)
 	{
 		// does generic 'citizen' specialist exist?
-		if (GC.getDefineINT("DEFAULT_SPECIALIST") != NO_SPECIALIST)
+		if (GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST) != NO_SPECIALIST)
 		{
 			// is ignore something other than generic citizen?
-			if (eIgnoreSpecialist != GC.getDefineINT("DEFAULT_SPECIALIST"))
+			if (eIgnoreSpecialist != GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST))
 			{
 				// do we have at least one more generic citizen than we are forcing?
-				if (getSpecialistCount((SpecialistTypes)(GC.getDefineINT("DEFAULT_SPECIALIST"))) > getForceSpecialistCount((SpecialistTypes)(GC.getDefineINT("DEFAULT_SPECIALIST"))))
+				if (getSpecialistCount((SpecialistTypes)(GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST))) > getForceSpecialistCount((SpecialistTypes)(GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST))))
 				{
 					// remove the extra generic citzen
-					changeSpecialistCount(((SpecialistTypes)(GC.getDefineINT("DEFAULT_SPECIALIST"))), -1);
+					changeSpecialistCount(((SpecialistTypes)(GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST))), -1);
 					return true;
 				}
 			}
@@ -9165,6 +9185,12 @@ void CvCityAI::AI_juggleCitizens()
 	std::vector<PotentialJob_t> worked_jobs;
 	std::vector<PotentialJob_t> unworked_jobs;
 	std::vector<std::pair<bool, int> > new_jobs; // jobs assigned by this juggling process
+	/*  <advc.003am> Specialist values, evaluated at most once per cycle. A specialist
+		type that is both worked and available used to be evaluated twice with the
+		same arguments. (Values can't be carried over to the next cycle because
+		every job swap changes the city's yield rates.) */
+	std::vector<int> aiSpecialistValue(GC.getNumSpecialistInfos());
+	std::vector<bool> abSpecialistValueKnown(GC.getNumSpecialistInfos()); // </advc.003am>
 
 	bool bDone = false;
 	int iCycles = 0;
@@ -9175,6 +9201,7 @@ void CvCityAI::AI_juggleCitizens()
 
 		worked_jobs.clear();
 		unworked_jobs.clear();
+		std::fill(abSpecialistValueKnown.begin(), abSpecialistValueKnown.end(), false); // advc.003am
 
 		// populate jobs lists.
 		// evaluate plots
@@ -9216,16 +9243,27 @@ void CvCityAI::AI_juggleCitizens()
 			if (getSpecialistCount(i) > getForceSpecialistCount(i))
 			{
 				// don't allow unforced specialists unless none of the forced type are available
-				int iValue = bForcedSpecAvailable && getForceSpecialistCount(i) == 0
-					? 0
-					: AI_specialistValue(i, false, false, iGrowthValue);
+				int iValue = 0;
+				if (!bForcedSpecAvailable || getForceSpecialistCount(i) > 0)
+				{	// <advc.003am>
+					aiSpecialistValue[i] = AI_specialistValue(i, false, false, iGrowthValue);
+					abSpecialistValueKnown[i] = true;
+					iValue = aiSpecialistValue[i]; // </advc.003am>
+				}
 				worked_jobs.push_back(PotentialJob_t(iValue, std::make_pair(true, i)));
 			}
 			if (isSpecialistValid(i, 1))
 			{
-				int iValue = bForcedSpecAvailable && getForceSpecialistCount(i) == 0
-					? 0
-					: AI_specialistValue(i, false, false, iGrowthValue);
+				int iValue = 0;
+				if (!bForcedSpecAvailable || getForceSpecialistCount(i) > 0)
+				{	// <advc.003am>
+					if (!abSpecialistValueKnown[i])
+					{
+						aiSpecialistValue[i] = AI_specialistValue(i, false, false, iGrowthValue);
+						abSpecialistValueKnown[i] = true;
+					}
+					iValue = aiSpecialistValue[i]; // </advc.003am>
+				}
 				unworked_jobs.push_back(PotentialJob_t(iValue, std::make_pair(true, i)));
 				if (getForceSpecialistCount(i) > 0)
 					bForcedSpecAvailable = true;
@@ -9845,7 +9883,7 @@ int CvCityAI::AI_yieldValue(short* piYields, short* piCommerceYields, bool bRemo
 						{
 							if (kOwner.getNumCities() > 2)
 							{
-								iHappinessLevel += ((GC.getDefineINT("NO_MILITARY_PERCENT_ANGER") * (iPopulation + 1)) / GC.getPERCENT_ANGER_DIVISOR());
+								iHappinessLevel += ((GC.getDefineINT(CvGlobals::NO_MILITARY_PERCENT_ANGER) * (iPopulation + 1)) / GC.getPERCENT_ANGER_DIVISOR());
 							}
 						}
 
@@ -10380,7 +10418,7 @@ int CvCityAI::AI_jobChangeValue(std::pair<bool, int> new_job, std::pair<bool, in
 		// Devalue generic citizens (for no specific reason). (cf. AI_specialistValue)
 		/* if (no gpp)
 		{
-			SpecialistTypes eGenericCitizen = (SpecialistTypes) GC.getDefineINT("DEFAULT_SPECIALIST");
+			SpecialistTypes eGenericCitizen = (SpecialistTypes) GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST);
 
 			if (eGenericCitizen != NO_SPECIALIST)
 			{
@@ -10570,7 +10608,7 @@ int CvCityAI::AI_growthValuePerFood() const
 	for (SpecialistTypes i = (SpecialistTypes)0; i < GC.getNumSpecialistInfos(); i = (SpecialistTypes)(i+1))
 	{
 		// cf. CvCity::isSpecialistValid
-		int iAvailable = (kOwner.isSpecialistValid(i) || i == GC.getDefineINT("DEFAULT_SPECIALIST"))
+		int iAvailable = (kOwner.isSpecialistValid(i) || i == GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST))
 			? 3
 			: std::min(3, getMaxSpecialistCount(i) - getSpecialistCount(i));
 
@@ -10692,7 +10730,8 @@ int CvCityAI::AI_buildUnitProb(bool bDraft)
 	return std::min(100, iProb); // experimental (K-Mod)
 }
 
-void CvCityAI::AI_bestPlotBuild(CvPlot* pPlot, int* piBestValue, BuildTypes* peBestBuild, int iFoodPriority, int iProductionPriority, int iCommercePriority, bool bChop, int iHappyAdjust, int iHealthAdjust, int iDesiredFoodChange)
+void CvCityAI::AI_bestPlotBuild(CvPlot* pPlot, int* piBestValue, BuildTypes* peBestBuild, int iFoodPriority, int iProductionPriority, int iCommercePriority, bool bChop, int iHappyAdjust, int iHealthAdjust, int iDesiredFoodChange,
+		std::vector<bool> const* pabImprovementAvailable) // advc.003an
 {
 	PROFILE_FUNC();
 
@@ -10852,6 +10891,10 @@ void CvCityAI::AI_bestPlotBuild(CvPlot* pPlot, int* piBestValue, BuildTypes* peB
 	for (int iI = 0; iI < GC.getNumImprovementInfos(); iI++)
 	{
 		ImprovementTypes eImprovement = ((ImprovementTypes)iI);
+		// <advc.003an> AI_getImprovementValue would return 0 anyway
+		if (pabImprovementAvailable != NULL && !(*pabImprovementAvailable)[iI] &&
+				eImprovement != pPlot->getImprovementType())
+			continue; // </advc.003an>
 		BuildTypes eBestTempBuild;
 		int iValue = AI_getImprovementValue(*pPlot, eImprovement, iFoodPriority, iProductionPriority, iCommercePriority, iDesiredFoodChange, iClearFeatureValue, bEmphasizeIrrigation, &eBestTempBuild);
 		if (iValue > iBestValue)
@@ -11071,7 +11114,7 @@ int CvCityAI::AI_getHappyFromHurry(int iHurryPopulation) const
 {
 	PROFILE_FUNC();
 
-	int iHappyDiff = iHurryPopulation - GC.getDefineINT("HURRY_POP_ANGER");
+	int iHappyDiff = iHurryPopulation - GC.getDefineINT(CvGlobals::HURRY_POP_ANGER);
 	if (iHappyDiff > 0)
 	{
 		if (getHurryAngerTimer() <= 1)
@@ -11765,7 +11808,7 @@ int CvCityAI::AI_countGoodSpecialists(bool bHealthy) const
 		{
 			//iCount += getMaxSpecialistCount(eSpecialist);
 			// K-Mod
-			if (kPlayer.isSpecialistValid(eSpecialist) || eSpecialist == GC.getDefineINT("DEFAULT_SPECIALIST"))
+			if (kPlayer.isSpecialistValid(eSpecialist) || eSpecialist == GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST))
 				return getPopulation(); // unlimited
 			int delta = getMaxSpecialistCount(eSpecialist) - getSpecialistCount(eSpecialist);
 			/*  <advc.006> CvTeam::doResearch can obsolete a building
@@ -3,6 +3,7 @@
 #include "CvGameCoreDLL.h"
 #include "CvGamePlay.h"
 #include "WarAndPeaceAgent.h" // advc.104
+#include "TurnTimer.h" // advc.003s
 #include "CvMap.h"
 #include "CvGameTextMgr.h"
 #include "CvDLLInterfaceIFaceBase.h"
@@ -343,6 +344,7 @@ bool CvDeal::recordTradeValue(CLinkList<TradeData>* pFirstList, CLinkList<TradeD
 
 void CvDeal::doTurn()
 {
+	TurnTimer::Scope kTurnTimer(TurnTimer::DEAL_DO_TURN); // advc.003s
 	if (!isPeaceDeal()
 	/*  <advc.130p> Open Borders and Defensive Pact have very small AI_dealVals.
 		In (most?) other places, this doesn't matter b/c the AI never pays for
@@ -143,6 +143,8 @@
 #define DANGER_RANGE						(4)
 #define BORDER_DANGER_RANGE					(2) // K-Mod
 
-#define SERIALIZE_CVINFOS 0 // advc.003i
+/*  advc.003i: Was 0, i.e. no XML cache.
+	advc.003ai: Enabled again; see CvXMLLoadUtility::LoadGlobalClassInfo. */
+#define SERIALIZE_CVINFOS 1
 
 #endif	// CVDEFINES_H
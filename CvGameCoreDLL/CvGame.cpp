@@ -19,6 +19,7 @@
 #include "StartPointsAsHandicap.h" // advc.250b
 #include "RiseFall.h" // advc.700
 #include "CvHallOfFameInfo.h" // advc.106i
+#include "TurnTimer.h" // advc.003s
 
 // interface uses
 #include "CvDLLInterfaceIFaceBase.h"
@@ -108,7 +109,7 @@ void CvGame::init(HandicapTypes eHandicap)
 
 	m_bAllGameDataRead = true; // advc.003: Not loading from savegame
 	// <advc.108>
-	m_iNormalizationLevel = GC.getDefineINT("NORMALIZE_STARTPLOTS_AGGRESSIVELY") > 0 ?
+	m_iNormalizationLevel = GC.getDefineINT(CvGlobals::NORMALIZE_STARTPLOTS_AGGRESSIVELY) > 0 ?
 			3 : 1;
 	if(m_iNormalizationLevel == 1 && isGameMultiPlayer())
 		m_iNormalizationLevel = 2;
@@ -271,7 +272,7 @@ void CvGame::setInitialItems()
 	assignStartingPlots();
 	normalizeStartingPlots();
 	// <advc.030> Now that ice has been placed and normalization is through
-	if(GC.getDefineINT("PASSABLE_AREAS") > 0)
+	if(GC.getDefineINT(CvGlobals::PASSABLE_AREAS) > 0)
 		GC.getMap().recalculateAreas();
 	// </advc.030>
 	initFreeUnits();
@@ -284,7 +285,7 @@ void CvGame::setInitialItems()
 		m_pSpah->setInitialItems(); // </advc.250b>
 	int iStartTurn = getStartTurn(); // advc.250c, advc.251
 	// <advc.250c>
-	if(getStartEra() == 0 && GC.getDefineINT("INCREASE_START_TURN") > 0) {
+	if(getStartEra() == 0 && GC.getDefineINT(CvGlobals::INCREASE_START_TURN) > 0) {
 		std::vector<double> distr;
 		for(int i = 0; i < MAX_CIV_PLAYERS; i++) {
 			CvPlayer const& civ = GET_PLAYER((PlayerTypes)i);
@@ -306,7 +307,7 @@ void CvGame::setInitialItems()
 				gameHandicap.getAIStartingWorkerUnits() * 10) *
 				GC.getGameSpeedInfo(getGameSpeedType()).getGrowthPercent()) / 100;
 	} // <advc.250c>
-	if(getStartTurn() != iStartTurn && GC.getDefineINT("INCREASE_START_TURN") > 0) {
+	if(getStartTurn() != iStartTurn && GC.getDefineINT(CvGlobals::INCREASE_START_TURN) > 0) {
 		setStartTurnYear(iStartTurn);
 		/*  initDiplomacy is called from outside the DLL between the first
 			setStartTurnYear call and setInitialItems. The second setStartTurnYear
@@ -403,7 +404,7 @@ void CvGame::regenerateMap()
 
 	cycleSelectionGroups_delayed(1, false);
 	// <advc.004j>
-	bool bShowDawn = (GC.getDefineINT("SHOW_DAWN_AFTER_REGEN") > 0 &&
+	bool bShowDawn = (GC.getDefineINT(CvGlobals::SHOW_DAWN_AFTER_REGEN) > 0 &&
 			// Somehow doesn't work with Adv. Start; Dawn screen doesn't appear.
 			(!isOption(GAMEOPTION_ADVANCED_START) || isOption(GAMEOPTION_SPAH)));
 	// </advc.004j>
@@ -549,7 +550,7 @@ void CvGame::setStartTurnYear(int iTurn) {
 	}
 	else setEstimateEndTurn(gameTurn() + getMaxTurns());
 
-	setStartYear(GC.getDefineINT("START_YEAR"));
+	setStartYear(GC.getDefineINT(CvGlobals::START_YEAR));
 }
 
 // Initialize data members that are serialized.
@@ -609,7 +610,7 @@ void CvGame::reset(HandicapTypes eHandicap, bool bConstructorCall)
 
 	m_eHandicap = eHandicap;
 	// advc.127: (XML not loaded when constructor called)
-	m_eAIHandicap = bConstructorCall ? NO_HANDICAP : (HandicapTypes)GC.getDefineINT("STANDARD_HANDICAP");
+	m_eAIHandicap = bConstructorCall ? NO_HANDICAP : (HandicapTypes)GC.getDefineINT(CvGlobals::STANDARD_HANDICAP);
 	m_ePausePlayer = NO_PLAYER;
 	m_eBestLandUnit = NO_UNIT;
 	m_eWinner = NO_TEAM;
@@ -936,7 +937,7 @@ void CvGame::initScenario() {
 	setAIHandicap(); // advc.127
 	initFreeState(); // Tech from handicap
 	// <advc.030>
-	if(GC.getDefineINT("PASSABLE_AREAS") > 0) {
+	if(GC.getDefineINT(CvGlobals::PASSABLE_AREAS) > 0) {
 		/*  recalculateAreas can't handle preplaced cities. Or perhaps it can
 			(Barbarian cities are fine in most cases), but there's going to
 			be other stuff, like free units, that causes problems. */
@@ -1442,7 +1443,7 @@ void CvGame::normalizeRemovePeaks()  // advc.003: style changes
 	// <advc.108>
 	double prRemoval = 1;
 	if(m_iNormalizationLevel <= 1)
-		prRemoval = GC.getDefineINT("REMOVAL_CHANCE_PEAK") / 100.0;
+		prRemoval = GC.getDefineINT(CvGlobals::REMOVAL_CHANCE_PEAK) / 100.0;
 	// </advc.108>
 
 	for (int iI = 0; iI < MAX_CIV_PLAYERS; iI++)
@@ -1626,7 +1627,7 @@ void CvGame::normalizeRemoveBadTerrain()  // advc.003: style changes
 	// <advc.108>
 	double prKeep = 0;
 	if(m_iNormalizationLevel <= 1)
-		prKeep = 1 - GC.getDefineINT("REMOVAL_CHANCE_BAD_TERRAIN") / 100.0;
+		prKeep = 1 - GC.getDefineINT(CvGlobals::REMOVAL_CHANCE_BAD_TERRAIN) / 100.0;
 	// </advc.108>
 
 	int iCityRange = CITY_PLOTS_RADIUS;
@@ -2682,7 +2683,7 @@ void CvGame::updateGwPercentAnger()
 			// amplify the affects of responsibility
 			iResponsibilityFactor = std::max(0, 2*iResponsibilityFactor-100);
 
-			iAngerPercent = GC.getDefineINT("GLOBAL_WARMING_BASE_ANGER_PERCENT") * iGwSeverityRating * iResponsibilityFactor;
+			iAngerPercent = GC.getDefineINT(CvGlobals::GLOBAL_WARMING_BASE_ANGER_PERCENT) * iGwSeverityRating * iResponsibilityFactor;
 			iAngerPercent = ROUND_DIVIDE(iAngerPercent, 10000);// div, 100 * 100
 		}
 		kPlayer.setGwPercentAnger(iAngerPercent);
@@ -2922,7 +2923,7 @@ void CvGame::selectGroup(CvUnit* pUnit, bool bShift, bool bCtrl, bool bAlt) cons
 			{
 				if (pLoopUnit->getDomainType() == eDomain && (!bCheckMoves || pLoopUnit->canMove())) // K-Mod added domain check and bCheckMoves.
 				{
-					//if (!isMPOption(MPOPTION_SIMULTANEOUS_TURNS) || getTurnSlice() - pLoopUnit->getLastMoveTurn() > GC.getDefineINT("MIN_TIMER_UNIT_DOUBLE_MOVES")) // disabled by K-Mod
+					//if (!isMPOption(MPOPTION_SIMULTANEOUS_TURNS) || getTurnSlice() - pLoopUnit->getLastMoveTurn() > GC.getDefineINT(CvGlobals::MIN_TIMER_UNIT_DOUBLE_MOVES)) // disabled by K-Mod
 					{
 						if (bAlt || (pLoopUnit->getUnitType() == pUnit->getUnitType()))
 						{
@@ -3201,7 +3202,7 @@ bool CvGame::isTeamVoteEligible(TeamTypes eTeam, VoteSourceTypes eVoteSource) co
 		}
 	}
 
-	int iExtraEligible = GC.getDefineINT("TEAM_VOTE_MIN_CANDIDATES") - iCount;
+	int iExtraEligible = GC.getDefineINT(CvGlobals::TEAM_VOTE_MIN_CANDIDATES) - iCount;
 	if (iExtraEligible <= 0)
 	{
 		return false;
@@ -3668,7 +3669,7 @@ int CvGame::calculateReligionPercent(ReligionTypes eReligion,
 
 int CvGame::goldenAgeLength() const
 {
-	int iLength = GC.getDefineINT("GOLDEN_AGE_LENGTH");
+	int iLength = GC.getDefineINT(CvGlobals::GOLDEN_AGE_LENGTH);
 
 	iLength *= GC.getGameSpeedInfo(getGameSpeedType()).getGoldenAgePercent();
 	iLength /= 100;
@@ -4564,7 +4565,7 @@ int CvGame::getGlobalWarmingChances() const
 	// as you can see, I've scaled it by the number of turns in the game. The probability per chance is also scaled like this.
 	// I estimate that the global warming index will actually be roughly proportional to the number of turns in the game
 	// so by scaling the chances, and the probability per chance, I hope to get roughly the same number of actually events per game
-	int iIndexPerChance = GC.getDefineINT("GLOBAL_WARMING_INDEX_PER_CHANCE");
+	int iIndexPerChance = GC.getDefineINT(CvGlobals::GLOBAL_WARMING_INDEX_PER_CHANCE);
 	iIndexPerChance*=GC.getGameSpeedInfo(getGameSpeedType()).getVictoryDelayPercent();
 	iIndexPerChance/=100;
 	return ROUND_DIVIDE(getGlobalWarmingIndex(), std::max(1, iIndexPerChance));
@@ -4625,7 +4626,7 @@ int CvGame::calculateGwSustainabilityThreshold(PlayerTypes ePlayer) const
 {
 	// expect each pop to give ~10 pollution per turn at the time we cross the threshold, and ~1 pop per land tile...
 	// so default resistance should be around 10 per tile.
-	int iGlobalThreshold = GC.getMapINLINE().getLandPlots() * GC.getDefineINT("GLOBAL_WARMING_RESISTANCE");
+	int iGlobalThreshold = GC.getMapINLINE().getLandPlots() * GC.getDefineINT(CvGlobals::GLOBAL_WARMING_RESISTANCE);
 	
 	// maybe we should add some points for coastal tiles as well, so that watery maps don't get too much warming
 
@@ -4656,7 +4657,7 @@ int CvGame::calculateGwSeverityRating() const
 
 	// I recommend looking at the graph of this function to get a sense of how it works.
 
-	const long x = GC.getDefineINT("GLOBAL_WARMING_PROB") * getGlobalWarmingIndex() / (std::max(1,4*GC.getGameSpeedInfo(getGameSpeedType()).getVictoryDelayPercent()*GC.getMapINLINE().getLandPlots()));
+	const long x = GC.getDefineINT(CvGlobals::GLOBAL_WARMING_PROB) * getGlobalWarmingIndex() / (std::max(1,4*GC.getGameSpeedInfo(getGameSpeedType()).getVictoryDelayPercent()*GC.getMapINLINE().getLandPlots()));
 	const long b = 70; // shape parameter. Lower values result in the function being steeper earlier.
 	return 100L - b*100L/(b+x*x);
 }
@@ -4716,7 +4717,7 @@ bool CvGame::circumnavigationAvailable() const
 		return false;
 	}
 
-	if (GC.getDefineINT("CIRCUMNAVIGATE_FREE_MOVES") == 0)
+	if (GC.getDefineINT(CvGlobals::CIRCUMNAVIGATE_FREE_MOVES) == 0)
 	{
 		return false;
 	}
@@ -5159,7 +5160,7 @@ bool CvGame::isDebugToolsAllowed(bool bWB) const {
 	if(gDLL->GetWorldBuilderMode())
 		return true;
 	if(isGameMultiPlayer()) {
-		if(GC.getDefineINT("ENABLE_DEBUG_TOOLS_MULTIPLAYER") <= 0)
+		if(GC.getDefineINT(CvGlobals::ENABLE_DEBUG_TOOLS_MULTIPLAYER) <= 0)
 			return false;
 		if(isHotSeat())
 			return true;
@@ -6239,7 +6240,7 @@ void CvGame::setHolyCity(ReligionTypes eIndex, CvCity* pNewValue, bool bAnnounce
 
 	if (pOldValue != NULL)
 	{
-		pOldValue->changeReligionInfluence(eIndex, -(GC.getDefineINT("HOLY_CITY_INFLUENCE")));
+		pOldValue->changeReligionInfluence(eIndex, -(GC.getDefineINT(CvGlobals::HOLY_CITY_INFLUENCE)));
 
 		pOldValue->updateReligionCommerce();
 
@@ -6251,7 +6252,7 @@ void CvGame::setHolyCity(ReligionTypes eIndex, CvCity* pNewValue, bool bAnnounce
 		CvCity* pHolyCity = getHolyCity(eIndex);
 
 		pHolyCity->setHasReligion(eIndex, true, bAnnounce, true);
-		pHolyCity->changeReligionInfluence(eIndex, GC.getDefineINT("HOLY_CITY_INFLUENCE"));
+		pHolyCity->changeReligionInfluence(eIndex, GC.getDefineINT(CvGlobals::HOLY_CITY_INFLUENCE));
 
 		pHolyCity->updateReligionCommerce();
 
@@ -6275,12 +6276,12 @@ void CvGame::setHolyCity(ReligionTypes eIndex, CvCity* pNewValue, bool bAnnounce
 							|| kObs.isSpectator()) // advc.127
 					{
 						szBuffer = gDLL->getText("TXT_KEY_MISC_REL_FOUNDED", GC.getReligionInfo(eIndex).getTextKeyWide(), pHolyCity->getNameKey());
-						gDLL->getInterfaceIFace()->addHumanMessage(kObs.getID(), false, GC.getDefineINT("EVENT_MESSAGE_TIME_LONG"), szBuffer, GC.getReligionInfo(eIndex).getSound(), MESSAGE_TYPE_MAJOR_EVENT, GC.getReligionInfo(eIndex).getButton(), (ColorTypes)GC.getInfoTypeForString("COLOR_HIGHLIGHT_TEXT"), pHolyCity->getX_INLINE(), pHolyCity->getY_INLINE(), false, true);
+						gDLL->getInterfaceIFace()->addHumanMessage(kObs.getID(), false, GC.getDefineINT(CvGlobals::EVENT_MESSAGE_TIME_LONG), szBuffer, GC.getReligionInfo(eIndex).getSound(), MESSAGE_TYPE_MAJOR_EVENT, GC.getReligionInfo(eIndex).getButton(), (ColorTypes)GC.getInfoTypeForString("COLOR_HIGHLIGHT_TEXT"), pHolyCity->getX_INLINE(), pHolyCity->getY_INLINE(), false, true);
 					}
 					else
 					{
 						szBuffer = gDLL->getText("TXT_KEY_MISC_REL_FOUNDED_UNKNOWN", GC.getReligionInfo(eIndex).getTextKeyWide());
-						gDLL->getInterfaceIFace()->addHumanMessage(kObs.getID(), false, GC.getDefineINT("EVENT_MESSAGE_TIME_LONG"), szBuffer, GC.getReligionInfo(eIndex).getSound(), MESSAGE_TYPE_MAJOR_EVENT, GC.getReligionInfo(eIndex).getButton(), (ColorTypes)GC.getInfoTypeForString("COLOR_HIGHLIGHT_TEXT"));
+						gDLL->getInterfaceIFace()->addHumanMessage(kObs.getID(), false, GC.getDefineINT(CvGlobals::EVENT_MESSAGE_TIME_LONG), szBuffer, GC.getReligionInfo(eIndex).getSound(), MESSAGE_TYPE_MAJOR_EVENT, GC.getReligionInfo(eIndex).getButton(), (ColorTypes)GC.getInfoTypeForString("COLOR_HIGHLIGHT_TEXT"));
 					}
 				}
 			}
@@ -6345,12 +6346,12 @@ void CvGame::setHeadquarters(CorporationTypes eIndex, CvCity* pNewValue, bool bA
 						{
 							if (pHeadquarters->isRevealed(GET_PLAYER((PlayerTypes)iI).getTeam(), false))
 							{
-								gDLL->getInterfaceIFace()->addHumanMessage(((PlayerTypes)iI), false, GC.getDefineINT("EVENT_MESSAGE_TIME_LONG"), szBuffer, GC.getCorporationInfo(eIndex).getSound(), MESSAGE_TYPE_MAJOR_EVENT, GC.getCorporationInfo(eIndex).getButton(), (ColorTypes)GC.getInfoTypeForString("COLOR_HIGHLIGHT_TEXT"), pHeadquarters->getX_INLINE(), pHeadquarters->getY_INLINE(), false, true);
+								gDLL->getInterfaceIFace()->addHumanMessage(((PlayerTypes)iI), false, GC.getDefineINT(CvGlobals::EVENT_MESSAGE_TIME_LONG), szBuffer, GC.getCorporationInfo(eIndex).getSound(), MESSAGE_TYPE_MAJOR_EVENT, GC.getCorporationInfo(eIndex).getButton(), (ColorTypes)GC.getInfoTypeForString("COLOR_HIGHLIGHT_TEXT"), pHeadquarters->getX_INLINE(), pHeadquarters->getY_INLINE(), false, true);
 							}
 							else
 							{
 								CvWString szBuffer2 = gDLL->getText("TXT_KEY_MISC_CORPORATION_FOUNDED_UNKNOWN", GC.getCorporationInfo(eIndex).getTextKeyWide());
-								gDLL->getInterfaceIFace()->addHumanMessage(((PlayerTypes)iI), false, GC.getDefineINT("EVENT_MESSAGE_TIME_LONG"), szBuffer2, GC.getCorporationInfo(eIndex).getSound(), MESSAGE_TYPE_MAJOR_EVENT, GC.getCorporationInfo(eIndex).getButton(), (ColorTypes)GC.getInfoTypeForString("COLOR_HIGHLIGHT_TEXT"));
+								gDLL->getInterfaceIFace()->addHumanMessage(((PlayerTypes)iI), false, GC.getDefineINT(CvGlobals::EVENT_MESSAGE_TIME_LONG), szBuffer2, GC.getCorporationInfo(eIndex).getSound(), MESSAGE_TYPE_MAJOR_EVENT, GC.getCorporationInfo(eIndex).getButton(), (ColorTypes)GC.getInfoTypeForString("COLOR_HIGHLIGHT_TEXT"));
 							}
 						}
 					}
@@ -6506,6 +6507,9 @@ void CvGame::addGreatPersonBornName(const CvWString& szName)
 void CvGame::doTurn()
 {
 	PROFILE_BEGIN("CvGame::doTurn()");
+	// <advc.003s>
+	TurnTimer::atTurnStart();
+	TurnTimer::Scope kTurnTimer(TurnTimer::GAME_DO_TURN); // </advc.003s>
 
 	// END OF TURN
 	if(!CvPlot::isAllFog()) // advc.706: Suppress popups
@@ -6703,9 +6707,9 @@ void CvGame::doGlobalWarming()
 			}
 		}
 	}
-	iGlobalWarmingDefense = iGlobalWarmingDefense * GC.getDefineINT("GLOBAL_WARMING_FOREST") / std::max(1, GC.getMapINLINE().getLandPlots());
+	iGlobalWarmingDefense = iGlobalWarmingDefense * GC.getDefineINT(CvGlobals::GLOBAL_WARMING_FOREST) / std::max(1, GC.getMapINLINE().getLandPlots());
 
-	int iUnhealthWeight = GC.getDefineINT("GLOBAL_WARMING_UNHEALTH_WEIGHT");
+	int iUnhealthWeight = GC.getDefineINT(CvGlobals::GLOBAL_WARMING_UNHEALTH_WEIGHT);
 	int iGlobalWarmingValue = 0;
 	for (int iPlayer = 0; iPlayer < MAX_PLAYERS; ++iPlayer)
 	{
@@ -6721,13 +6725,13 @@ void CvGame::doGlobalWarming()
 	}
 	iGlobalWarmingValue /= GC.getMapINLINE().numPlotsINLINE();
 
-	iGlobalWarmingValue += getNukesExploded() * GC.getDefineINT("GLOBAL_WARMING_NUKE_WEIGHT") / 100;
+	iGlobalWarmingValue += getNukesExploded() * GC.getDefineINT(CvGlobals::GLOBAL_WARMING_NUKE_WEIGHT) / 100;
 
-	TerrainTypes eWarmingTerrain = ((TerrainTypes)(GC.getDefineINT("GLOBAL_WARMING_TERRAIN")));
+	TerrainTypes eWarmingTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::GLOBAL_WARMING_TERRAIN)));
 
 	for (int iI = 0; iI < iGlobalWarmingValue; iI++)
 	{
-		if (getSorenRandNum(100, "Global Warming") + iGlobalWarmingDefense < GC.getDefineINT("GLOBAL_WARMING_PROB"))
+		if (getSorenRandNum(100, "Global Warming") + iGlobalWarmingDefense < GC.getDefineINT(CvGlobals::GLOBAL_WARMING_PROB))
 		{
 			CvPlot* pPlot = GC.getMapINLINE().syncRandPlot(RANDPLOT_LAND | RANDPLOT_NOT_CITY);
 
@@ -6737,7 +6741,7 @@ void CvGame::doGlobalWarming()
 
 				if (pPlot->getFeatureType() != NO_FEATURE)
 				{
-					if (pPlot->getFeatureType() != GC.getDefineINT("NUKE_FEATURE"))
+					if (pPlot->getFeatureType() != GC.getDefineINT(CvGlobals::NUKE_FEATURE))
 					{
 						pPlot->setFeatureType(NO_FEATURE);
 						bChanged = true;
@@ -6828,24 +6832,24 @@ void CvGame::doGlobalWarming()
 	*/
 	int iGlobalWarmingRolls = getGlobalWarmingChances();
 
-	TerrainTypes eWarmingTerrain = ((TerrainTypes)(GC.getDefineINT("GLOBAL_WARMING_TERRAIN")));
-	TerrainTypes eFrozenTerrain = ((TerrainTypes)(GC.getDefineINT("FROZEN_TERRAIN")));
-	TerrainTypes eColdTerrain = ((TerrainTypes)(GC.getDefineINT("COLD_TERRAIN")));
-	TerrainTypes eTemperateTerrain = ((TerrainTypes)(GC.getDefineINT("TEMPERATE_TERRAIN")));
-	TerrainTypes eDryTerrain = ((TerrainTypes)(GC.getDefineINT("DRY_TERRAIN")));
-	TerrainTypes eBarrenTerrain = ((TerrainTypes)(GC.getDefineINT("BARREN_TERRAIN")));
+	TerrainTypes eWarmingTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::GLOBAL_WARMING_TERRAIN)));
+	TerrainTypes eFrozenTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::FROZEN_TERRAIN)));
+	TerrainTypes eColdTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::COLD_TERRAIN)));
+	TerrainTypes eTemperateTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::TEMPERATE_TERRAIN)));
+	TerrainTypes eDryTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::DRY_TERRAIN)));
+	TerrainTypes eBarrenTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::BARREN_TERRAIN)));
 
-	FeatureTypes eColdFeature = ((FeatureTypes)(GC.getDefineINT("COLD_FEATURE")));
-	FeatureTypes eTemperateFeature = ((FeatureTypes)(GC.getDefineINT("TEMPERATE_FEATURE")));
-	FeatureTypes eWarmFeature = ((FeatureTypes)(GC.getDefineINT("WARM_FEATURE")));
-	FeatureTypes eFalloutFeature = ((FeatureTypes)(GC.getDefineINT("NUKE_FEATURE")));
+	FeatureTypes eColdFeature = ((FeatureTypes)(GC.getDefineINT(CvGlobals::COLD_FEATURE)));
+	FeatureTypes eTemperateFeature = ((FeatureTypes)(GC.getDefineINT(CvGlobals::TEMPERATE_FEATURE)));
+	FeatureTypes eWarmFeature = ((FeatureTypes)(GC.getDefineINT(CvGlobals::WARM_FEATURE)));
+	FeatureTypes eFalloutFeature = ((FeatureTypes)(GC.getDefineINT(CvGlobals::NUKE_FEATURE)));
 
 	//Global Warming
 	for (int iI = 0; iI < iGlobalWarmingRolls; iI++)
 	{
 		// note, warming prob out of 1000, not percent.
 		int iLeftOdds = 10*GC.getGameSpeedInfo(getGameSpeedType()).getVictoryDelayPercent();
-		if (getSorenRandNum(iLeftOdds, "Global Warming") < GC.getDefineINT("GLOBAL_WARMING_PROB"))
+		if (getSorenRandNum(iLeftOdds, "Global Warming") < GC.getDefineINT(CvGlobals::GLOBAL_WARMING_PROB))
 		{
 			//CvPlot* pPlot = GC.getMapINLINE().syncRandPlot(RANDPLOT_LAND | RANDPLOT_NOT_CITY);
 
@@ -6946,12 +6950,12 @@ CvPlot* CvGame::getRandGWPlot(int iPool)
 	int iTestScore;
 	int i;
 
-	const TerrainTypes eFrozenTerrain = ((TerrainTypes)(GC.getDefineINT("FROZEN_TERRAIN")));
-	const TerrainTypes eColdTerrain = ((TerrainTypes)(GC.getDefineINT("COLD_TERRAIN")));
-	const TerrainTypes eTemperateTerrain = ((TerrainTypes)(GC.getDefineINT("TEMPERATE_TERRAIN")));
-	const TerrainTypes eDryTerrain = ((TerrainTypes)(GC.getDefineINT("DRY_TERRAIN")));
+	const TerrainTypes eFrozenTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::FROZEN_TERRAIN)));
+	const TerrainTypes eColdTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::COLD_TERRAIN)));
+	const TerrainTypes eTemperateTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::TEMPERATE_TERRAIN)));
+	const TerrainTypes eDryTerrain = ((TerrainTypes)(GC.getDefineINT(CvGlobals::DRY_TERRAIN)));
 
-	const FeatureTypes eColdFeature = ((FeatureTypes)(GC.getDefineINT("COLD_FEATURE")));
+	const FeatureTypes eColdFeature = ((FeatureTypes)(GC.getDefineINT(CvGlobals::COLD_FEATURE)));
 
 	// Currently we just choose the coldest tile; but I may include other tests in future versions
 	for (i = 0; i < iPool; i++)
@@ -7404,7 +7408,7 @@ void CvGame::createBarbarianCity(bool bSkipCivAreas, int iProbModifierPercent) {
 	}
 
 	CvPlayerAI::CvFoundSettings kFoundSet(GET_PLAYER(BARBARIAN_PLAYER), false); // K-Mod
-	kFoundSet.iMinRivalRange = GC.getDefineINT("MIN_BARBARIAN_CITY_STARTING_DISTANCE");
+	kFoundSet.iMinRivalRange = GC.getDefineINT(CvGlobals::MIN_BARBARIAN_CITY_STARTING_DISTANCE);
 	/* <advc.300> Randomize penalty on short inter-city distance for more variety
 	   in Barbarian settling patterns. The expected value is 8, which is also the
 	   value K-Mod uses. */
@@ -7474,7 +7478,7 @@ void CvGame::createBarbarianCity(bool bSkipCivAreas, int iProbModifierPercent) {
 
 		if (a.getCitiesPerPlayer(BARBARIAN_PLAYER) < iTargetCities)
 		{
-			//iValue = GET_PLAYER(BARBARIAN_PLAYER).AI_foundValue(pLoopPlot->getX_INLINE(), pLoopPlot->getY_INLINE(), GC.getDefineINT("MIN_BARBARIAN_CITY_STARTING_DISTANCE"));
+			//iValue = GET_PLAYER(BARBARIAN_PLAYER).AI_foundValue(pLoopPlot->getX_INLINE(), pLoopPlot->getY_INLINE(), GC.getDefineINT(CvGlobals::MIN_BARBARIAN_CITY_STARTING_DISTANCE));
 			// K-Mod
 			int iValue = GET_PLAYER(BARBARIAN_PLAYER).AI_foundValue_bulk(
 					pLoopPlot->getX_INLINE(), pLoopPlot->getY_INLINE(), kFoundSet); 
@@ -7542,7 +7546,7 @@ void CvGame::createBarbarianUnits()
 			/*  advc.300: No need to delay Barbarians (bAnimals=true) if they start
 				slowly (PEAK_PERCENT>=35). For slow game speed settings, there is
 				now a similar check in CvUnitAI::AI_barbAttackMove. */
-			GC.getDefineINT("BARB_PEAK_PERCENT") < 35)
+			GC.getDefineINT(CvGlobals::BARB_PEAK_PERCENT) < 35)
 		bAnimals = true;
 	// advc.300: Moved into new function
 	if (gameTurn() < getBarbarianStartTurn())
@@ -7698,7 +7702,7 @@ void CvGame::createAnimals()  // advc.003: style changes
 			CvPlot* pPlot = GC.getMapINLINE().syncRandPlot(
 					(RANDPLOT_NOT_VISIBLE_TO_CIV | RANDPLOT_PASSABLE
 					| RANDPLOT_WATERSOURCE), // advc.300
-					pLoopArea->getID(), GC.getDefineINT("MIN_ANIMAL_STARTING_DISTANCE"));
+					pLoopArea->getID(), GC.getDefineINT(CvGlobals::MIN_ANIMAL_STARTING_DISTANCE));
 			if (pPlot == NULL)
 				continue;
 
@@ -7772,7 +7776,7 @@ int CvGame::numBarbariansToCreate(int iTilesPerUnit, int iTiles, int iUnowned,
 		int iUnitsPresent, int iBarbarianCities) {
 
 	int iOwned = iTiles - iUnowned;
-	int iPeakPercent = ::range(GC.getDefineINT("BARB_PEAK_PERCENT"), 0, 100);
+	int iPeakPercent = ::range(GC.getDefineINT(CvGlobals::BARB_PEAK_PERCENT), 0, 100);
 	if(iOwned == 0 || iPeakPercent == 0)
 		return 0;
 	double peak = iPeakPercent / 100.0;
@@ -7806,7 +7810,7 @@ int CvGame::numBarbariansToCreate(int iTilesPerUnit, int iTiles, int iUnowned,
 			/*  Make sure that there's enough unowned land where the Barbarians
 				could plausibly gather. */
 			iUnowned / 6.0);
-	double adjustment = GC.getDefineINT("BARB_ACTIVITY_ADJUSTMENT") + 100;
+	double adjustment = GC.getDefineINT(CvGlobals::BARB_ACTIVITY_ADJUSTMENT) + 100;
 	adjustment /= 100;
 	target *= adjustment;
 
@@ -7945,7 +7949,7 @@ CvPlot* CvGame::randomBarbarianPlot(CvArea const& a, Shelf* shelf) const {
 		Could otherwise happen now b/c the visible flag and dist. restriction
 		no longer apply to Barbarians previously spawned; see
 		CvPlot::isVisibleToCivTeam, CvMap::isCivUnitNearby. */
-	int iDist = GC.getDefineINT("MIN_BARBARIAN_STARTING_DISTANCE");
+	int iDist = GC.getDefineINT(CvGlobals::MIN_BARBARIAN_STARTING_DISTANCE);
 	// <advc.304> Sometimes don't pick a plot if there are few legal plots
 	int iLegal = 0;
 	CvPlot* r = NULL;
@@ -8118,6 +8122,7 @@ void CvGame::updateWar()
 
 void CvGame::updateMoves()
 {
+	TurnTimer::Scope kTurnTimer(TurnTimer::GAME_UPDATE_MOVES); // advc.003s
 	CvSelectionGroup* pLoopSelectionGroup;
 	int iLoop;
 	int iI;
@@ -9850,7 +9855,7 @@ void CvGame::addPlayer(PlayerTypes eNewPlayer, LeaderHeadTypes eLeader, Civiliza
 		{
 			for (int iK = 0; iK < GC.getNumPlayerColorInfos(); iK++)
 			{
-				if (iK != GC.getCivilizationInfo((CivilizationTypes)GC.getDefineINT("BARBARIAN_CIVILIZATION")).getDefaultPlayerColor())
+				if (iK != GC.getCivilizationInfo((CivilizationTypes)GC.getDefineINT(CvGlobals::BARBARIAN_CIVILIZATION)).getDefaultPlayerColor())
 				{
 					bool bValid = true;
 
@@ -10227,7 +10232,7 @@ int CvGame::getCultureThreshold(CultureLevelTypes eLevel) const
 	int iThreshold = GC.getCultureLevelInfo(eLevel).getSpeedThreshold(getGameSpeedType());
 	if (isOption(GAMEOPTION_NO_ESPIONAGE))
 	{
-		iThreshold *= 100 + GC.getDefineINT("NO_ESPIONAGE_CULTURE_LEVEL_MODIFIER");
+		iThreshold *= 100 + GC.getDefineINT(CvGlobals::NO_ESPIONAGE_CULTURE_LEVEL_MODIFIER);
 		iThreshold /= 100;
 	} // <advc.126>
 	int const iExempt = 50; // Don't adjust thresholds below "developing"
@@ -10903,7 +10908,7 @@ void CvGame::doVoteSelection()
 					}
 					else
 					{
-						setSecretaryGeneralTimer(eVoteSource, GC.getDefineINT("DIPLO_VOTE_SECRETARY_GENERAL_INTERVAL"));
+						setSecretaryGeneralTimer(eVoteSource, GC.getDefineINT(CvGlobals::DIPLO_VOTE_SECRETARY_GENERAL_INTERVAL));
 
 						for (int iJ = 0; iJ < GC.getNumVoteInfos(); iJ++)
 						{
@@ -11082,10 +11087,10 @@ double CvGame::goodyHutEffectFactor(
 	double speedMultFinal = (bSpeedAdjust ?
 			kSpeed.getTrainPercent() * iWorldSzPercent / 10000.0 : 1);
 	double startTurn = std::max(0.0,
-			GC.getDefineINT("GOODY_BUFF_START_TURN") * speedMultTurns);
+			GC.getDefineINT(CvGlobals::GOODY_BUFF_START_TURN) * speedMultTurns);
 	double peakTurn = std::max(startTurn,
-			GC.getDefineINT("GOODY_BUFF_PEAK_TURN") * speedMultTurns);
-	double peakMult = std::max(1, GC.getDefineINT("GOODY_BUFF_PEAK_MULTIPLIER"));
+			GC.getDefineINT(CvGlobals::GOODY_BUFF_PEAK_TURN) * speedMultTurns);
+	double peakMult = std::max(1, GC.getDefineINT(CvGlobals::GOODY_BUFF_PEAK_MULTIPLIER));
 	/*  Exponent for power-law function; aiming for a function shape that
 		resembles the graphs on the Info tab. */
 	double exponent = 1.25;
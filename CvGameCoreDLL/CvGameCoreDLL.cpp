@@ -17,7 +17,7 @@ void	ProfileTrackAlloc(void* ptr);
 
 void	ProfileTrackDeAlloc(void* ptr);
 /*  advc.003j (comment): This isn't currently called. Also not called: DllMain,
-	EnableDetailedTrace, ProfileTrackAlloc and ProfileTrackDeAlloc. */
+	ProfileTrackAlloc and ProfileTrackDeAlloc. */
 void DumpMemUsage(const char* fn, int line)
 {
 	PROCESS_MEMORY_COUNTERS pmc;
@@ -181,228 +181,411 @@ BOOL APIENTRY DllMain(HANDLE hModule,
 }
 
 #ifdef USE_INTERNAL_PROFILER
+/*  advc.003t: Rewritten. The BtS internal profiler kept flat totals in the
+	ProfileSample objects, which made it impossible to tell from which caller a
+	sample's time came, and it timed every sample through QueryPerformanceCounter.
+	Now the samples are only static descriptors and the timings are accumulated
+	in a call tree - one node per distinct path of samples - with the time stamp
+	counter as the clock. The tree is kept across turns; only the timings are
+	reset. At the end of each game turn (stopProfilingDLL(true)), a flat table is
+	written to IFP_log.txt and the call tree to IFP_foldedN.log (N being the game
+	turn) in the "folded stacks" format that flame graph tools (e.g.
+	flamegraph.pl) read; the numbers there are self times in microseconds.
+	The game runs on a single thread. To keep the bookkeeping free of locks,
+	only the thread that calls startProfilingDLL is profiled; samples taken
+	on other threads are ignored. */
+
+#define MAX_SAMPLES 2000
+#define MAX_PROFILE_NODES 16384
+#define MAX_PROFILE_DEPTH 256
+
+struct ProfileNode
+{
+	int iSample; // -1 for the root
+	int iParent;
+	int iFirstChild;
+	int iNextSibling;
+	unsigned int uiCalls;
+	unsigned __int64 uiTicks; // inclusive
+};
+
+struct ProfileFrame
+{
+	ProfileSample* pSample;
+	int iNode; // -1 if the tree was full
+	unsigned __int64 uiStart;
+};
 
-//	Uncomment the following line to provide (very) detailed tracing to
-//	the debug stream (view with DbgView or a debugger)
-#define DETAILED_TRACE
-
-#define MAX_SAMPLES 900
-static ProfileSample* _currentSample = NULL;
-static int numSamples = 0;
 static ProfileSample* sampleList[MAX_SAMPLES];
-static ProfileSample* sampleStack[MAX_SAMPLES];
-static int depth = -1;
-
-#ifdef DETAILED_TRACE
-static ProfileSample* lastExit = NULL;
-static int exitCount = 0;
-static bool detailedTraceEnabled = false;
+static int numSamples = 0;
+static ProfileNode nodeList[MAX_PROFILE_NODES];
+static int numNodes = 0;
+// Frame 0 is the root; always open.
+static ProfileFrame frameStack[MAX_PROFILE_DEPTH];
+static int depth = 0;
+// Samples begun while the stack was full; their ends are ignored.
+static int overflowDepth = 0;
+static DWORD profiledThreadId = 0;
+// For converting TSC ticks to time
+static unsigned __int64 tscAtReset = 0;
+static LARGE_INTEGER qpcAtReset;
 
-static void GenerateTabString(char* buffer,int n)
+static inline unsigned __int64 readTSC()
 {
-	while(n-- > 0)
+	unsigned __int64 r;
+	__asm
 	{
-		*buffer++ = '\t';
+		rdtsc
+		mov dword ptr [r], eax
+		mov dword ptr [r+4], edx
 	}
-
-	*buffer = '\0';
+	return r;
 }
-#endif
 
-void EnableDetailedTrace(bool enable)
+static int addProfileNode(int iParent, int iSample)
 {
-#ifdef DETAILED_TRACE
-	detailedTraceEnabled = enable;
-#endif
-}
-
-void IFPBeginSample(ProfileSample* sample)
-{
-	if ( sample->Id == -1 )
+	if (numNodes >= MAX_PROFILE_NODES)
 	{
-		if ( numSamples == MAX_SAMPLES )
-		{
-			dumpProfileStack();
-			::MessageBox(NULL,"Profile sample limit exceeded","CvGameCore",MB_OK);
-			return;
-		}
-		sample->Id = numSamples;
-		sample->OpenProfiles = 0;
-		sample->ProfileInstances = 0;
-		sample->Accumulator.QuadPart = 0;
-		sample->ChildrenSampleTime.QuadPart = 0;
-		sampleList[numSamples++] = sample;
+		return -1;
 	}
-
-	if ( ++depth == MAX_SAMPLES )
+	ProfileNode& kNode = nodeList[numNodes];
+	kNode.iSample = iSample;
+	kNode.iParent = iParent;
+	kNode.iFirstChild = -1;
+	kNode.uiCalls = 0;
+	kNode.uiTicks = 0;
+	if (iParent >= 0)
 	{
-		::MessageBox(NULL,"Sample stack overflow","CvGameCore",MB_OK);
+		kNode.iNextSibling = nodeList[iParent].iFirstChild;
+		nodeList[iParent].iFirstChild = numNodes;
 	}
 	else
 	{
-		sampleStack[depth] = sample;
+		kNode.iNextSibling = -1;
 	}
+	return numNodes++;
+}
 
-	sample->ProfileInstances++;
-	sample->OpenProfiles++;
+static void initProfiler()
+{
+	profiledThreadId = GetCurrentThreadId();
+	numNodes = 0;
+	addProfileNode(-1, -1);
+	depth = 0;
+	frameStack[0].pSample = NULL;
+	frameStack[0].iNode = 0;
+	frameStack[0].uiStart = readTSC();
+	tscAtReset = frameStack[0].uiStart;
+	QueryPerformanceCounter(&qpcAtReset);
+}
 
-	if ( sample->OpenProfiles == 1 )
+// Child of iParent for pSample; creates it if necessary.
+static int findProfileNode(int iParent, ProfileSample* pSample)
+{
+	if (iParent < 0)
+	{
+		return -1;
+	}
+	// Usually, a site gets called repeatedly from the same parent
+	if (pSample->LastParent == iParent)
+	{
+		return pSample->LastNode;
+	}
+	int iNode;
+	for (iNode = nodeList[iParent].iFirstChild; iNode >= 0; iNode = nodeList[iNode].iNextSibling)
 	{
-		if ( _currentSample == NULL )
+		if (nodeList[iNode].iSample == pSample->Id)
 		{
-			sample->Parent = -1;
+			break;
 		}
-		else
+	}
+	if (iNode < 0)
+	{
+		iNode = addProfileNode(iParent, pSample->Id);
+		if (iNode < 0)
 		{
-			sample->Parent = _currentSample->Id;
+			return -1;
 		}
-
-		QueryPerformanceCounter(&sample->StartTime);
 	}
+	pSample->LastParent = iParent;
+	pSample->LastNode = iNode;
+	return iNode;
+}
 
-	_currentSample = sample;
-
-#ifdef DETAILED_TRACE
-	if ( detailedTraceEnabled && lastExit != sample )
+void IFPBeginSample(ProfileSample* sample)
+{
+	if (GetCurrentThreadId() != profiledThreadId)
 	{
-		char buffer[300];
-
-		if ( exitCount != 0 )
+		return;
+	}
+	if (sample->Id == -1)
+	{
+		if (numSamples == MAX_SAMPLES)
 		{
-			GenerateTabString(buffer, depth);
-			sprintf(buffer+depth, "[%d]\n", exitCount);
-			OutputDebugString(buffer);
-
-			exitCount = 0;
+			// Every new sample site ends up here; report it only once.
+			static bool bLimitReported = false;
+			if (!bLimitReported)
+			{
+				bLimitReported = true;
+				FAssertMsg(false, "Profile sample limit exceeded");
+			}
+			return;
 		}
-
-		GenerateTabString(buffer, depth);
-		sprintf(buffer+depth, "-->%s\n", sample->Name);
-
-		OutputDebugString(buffer);
+		sample->Id = numSamples;
+		sampleList[numSamples++] = sample;
 	}
-#endif
+	if (overflowDepth > 0 || depth + 1 == MAX_PROFILE_DEPTH)
+	{
+		overflowDepth++;
+		return;
+	}
+	int iNode = findProfileNode(frameStack[depth].iNode, sample);
+	if (iNode >= 0)
+	{
+		nodeList[iNode].uiCalls++;
+	}
+	ProfileFrame& kFrame = frameStack[++depth];
+	kFrame.pSample = sample;
+	kFrame.iNode = iNode;
+	kFrame.uiStart = readTSC();
 }
 
 void IFPEndSample(ProfileSample* sample)
 {
-	if ( _currentSample != sample )
+	if (GetCurrentThreadId() != profiledThreadId || sample->Id == -1)
 	{
-		MessageBox(NULL,"Sample closure not matched","CvGameCore",MB_OK);
+		return;
 	}
-
-	if ( depth < 0 )
+	if (overflowDepth > 0)
 	{
-		MessageBox(NULL,"Too many end-samples","CvGameCore",MB_OK);
+		overflowDepth--;
+		return;
 	}
-	else if ( depth == 0 )
+	unsigned __int64 uiNow = readTSC();
+	int iFrame = depth;
+	while (iFrame > 0 && frameStack[iFrame].pSample != sample)
 	{
-		_currentSample = NULL;
-		depth = -1;
+		iFrame--;
 	}
-	else
+	if (iFrame <= 0)
 	{
-		_currentSample = sampleStack[--depth];
+		FAssertMsg(false, "Too many end-samples");
+		return;
 	}
-
-	if ( sample->OpenProfiles-- == 1 )
+	// Can happen if there's a return statement between PROFILE_BEGIN and PROFILE_END
+	FAssertMsg(iFrame == depth, "Sample closure not matched");
+	for (; depth >= iFrame; depth--)
 	{
-		LARGE_INTEGER now;
-		LONGLONG ellapsed;
-
-		QueryPerformanceCounter(&now);
-
-		ellapsed = (now.QuadPart - sample->StartTime.QuadPart);
-		sample->Accumulator.QuadPart += ellapsed;
-
-		if ( _currentSample != NULL )
+		ProfileFrame const& kFrame = frameStack[depth];
+		if (kFrame.iNode >= 0)
 		{
-			_currentSample->ChildrenSampleTime.QuadPart += ellapsed;
+			nodeList[kFrame.iNode].uiTicks += uiNow - kFrame.uiStart;
 		}
 	}
+}
 
-#ifdef DETAILED_TRACE
-	if ( detailedTraceEnabled && lastExit != sample )
+// Adds the time of the open frames to the tree so that a dump includes it
+static void IFPFlushOpenFrames()
+{
+	unsigned __int64 uiNow = readTSC();
+	for (int i = 1; i <= depth; i++)
 	{
-		char buffer[300];
-
-		GenerateTabString(buffer, depth+1);
-		strcpy(buffer+depth+1, "...\n");
+		ProfileFrame& kFrame = frameStack[i];
+		if (kFrame.iNode >= 0)
+		{
+			nodeList[kFrame.iNode].uiTicks += uiNow - kFrame.uiStart;
+		}
+		kFrame.uiStart = uiNow;
+	}
+}
 
-		OutputDebugString(buffer);
-		exitCount = 1;
+void IFPBegin(void)
+{
+	if (numNodes == 0)
+	{
+		initProfiler();
+		return;
 	}
-	else
+	for (int i = 0; i < numNodes; i++)
 	{
-		exitCount++;
+		nodeList[i].uiCalls = 0;
+		nodeList[i].uiTicks = 0;
 	}
-
-	lastExit = sample;
-#endif
+	unsigned __int64 uiNow = readTSC();
+	for (int i = 0; i <= depth; i++)
+	{
+		frameStack[i].uiStart = uiNow;
+	}
+	tscAtReset = uiNow;
+	QueryPerformanceCounter(&qpcAtReset);
 }
 
-void IFPBegin(void)
+// Sorts sample ids by inclusive time
+struct ProfileSampleTimeOrder
 {
-	for(int i = 0; i < numSamples; i++ )
+	ProfileSampleTimeOrder(std::vector<unsigned __int64> const& kTicks) : m_kTicks(kTicks) {}
+	bool operator()(int iLeft, int iRight) const
 	{
-		sampleList[i]->Accumulator.QuadPart = 0;
-		sampleList[i]->ChildrenSampleTime.QuadPart = 0;
-		sampleList[i]->ProfileInstances = sampleList[i]->OpenProfiles;
+		return m_kTicks[iLeft] > m_kTicks[iRight];
+	}
+	std::vector<unsigned __int64> const& m_kTicks;
+};
+
+// Writes buffered log text in chunks of moderate size
+static void IFPLog(char const* szFileName, CvString& szBuffer, bool bFlush)
+{
+	if (szBuffer.size() >= 1024 || (bFlush && !szBuffer.empty()))
+	{
+		gDLL->logMsg(szFileName, szBuffer.c_str(), false, false);
+		szBuffer.clear();
 	}
 }
 
 void IFPEnd(void)
 {
-	//	Log the timings
-	char buffer[300];
-	LARGE_INTEGER freq;
+	if (numNodes == 0)
+	{
+		return;
+	}
+	IFPFlushOpenFrames();
 
+	LARGE_INTEGER qpcNow;
+	LARGE_INTEGER freq;
+	QueryPerformanceCounter(&qpcNow);
 	QueryPerformanceFrequency(&freq);
+	double fMicrosElapsed = (1000000.0 * (qpcNow.QuadPart - qpcAtReset.QuadPart)) / freq.QuadPart;
+	if (fMicrosElapsed <= 0)
+	{
+		return;
+	}
+	double fTicksPerMicro = (__int64)(readTSC() - tscAtReset) / fMicrosElapsed;
+	if (fTicksPerMicro <= 0)
+	{
+		return;
+	}
 
-	gDLL->logMsg("IFP_log.txt","Fn\tTime (mS)\tAvg time\t#calls\tChild time\tParent\n");
+	// Self time of each node; children always come after their parents in nodeList.
+	std::vector<unsigned __int64> aiSelfTicks(numNodes);
+	for (int i = 0; i < numNodes; i++)
+	{
+		aiSelfTicks[i] = nodeList[i].uiTicks;
+	}
+	for (int i = numNodes - 1; i > 0; i--)
+	{
+		int iParent = nodeList[i].iParent;
+		if (iParent > 0)
+		{
+			aiSelfTicks[iParent] -= std::min(aiSelfTicks[iParent], nodeList[i].uiTicks);
+		}
+	}
+
+	/*  Depth-first traversal. Writes the folded stacks and sums up the flat
+		totals. A sample's inclusive time only counts where the sample doesn't
+		already have an open (recursive) call above it. */
+	std::vector<unsigned __int64> aiSampleTicks(numSamples, 0);
+	std::vector<unsigned __int64> aiSampleSelfTicks(numSamples, 0);
+	std::vector<unsigned int> aiSampleCalls(numSamples, 0);
+	std::vector<int> aiOpen(numSamples, 0);
+	CvString szFoldedFileName;
+	szFoldedFileName.Format("IFP_folded%d.log", GC.getGameINLINE().getGameTurn());
+	CvString szBuffer;
+	std::string szPath;
+	std::vector<std::string::size_type> aiPathLength;
+	std::vector<int> aiPending;
+	for (int iChild = nodeList[0].iFirstChild; iChild >= 0; iChild = nodeList[iChild].iNextSibling)
+	{
+		aiPending.push_back(iChild);
+	}
+	while (!aiPending.empty())
+	{
+		int iNode = aiPending.back();
+		aiPending.pop_back();
+		if (iNode < 0) // Marks the end of a subtree
+		{
+			iNode = -iNode - 2;
+			aiOpen[nodeList[iNode].iSample]--;
+			szPath.resize(aiPathLength.back());
+			aiPathLength.pop_back();
+			continue;
+		}
+		ProfileNode const& kNode = nodeList[iNode];
+		if (kNode.uiCalls == 0 && kNode.uiTicks == 0)
+		{
+			continue;
+		}
+		int iSample = kNode.iSample;
+		if (aiOpen[iSample] == 0)
+		{
+			aiSampleTicks[iSample] += kNode.uiTicks;
+		}
+		aiOpen[iSample]++;
+		aiSampleSelfTicks[iSample] += aiSelfTicks[iNode];
+		aiSampleCalls[iSample] += kNode.uiCalls;
+
+		aiPathLength.push_back(szPath.size());
+		if (!szPath.empty())
+		{
+			szPath += ';';
+		}
+		szPath += sampleList[iSample]->Name;
+		int iSelfMicros = (int)((__int64)aiSelfTicks[iNode] / fTicksPerMicro);
+		if (iSelfMicros > 0)
+		{
+			szBuffer += CvString::format("%s %d\n", szPath.c_str(), iSelfMicros);
+			IFPLog(szFoldedFileName, szBuffer, false);
+		}
+		aiPending.push_back(-iNode - 2);
+		for (int iChild = kNode.iFirstChild; iChild >= 0; iChild = nodeList[iChild].iNextSibling)
+		{
+			aiPending.push_back(iChild);
+		}
+	}
+	IFPLog(szFoldedFileName, szBuffer, true);
 
-	for(int i = 0; i < numSamples; i++ )
+	std::vector<int> aiSamples;
+	for (int i = 0; i < numSamples; i++)
 	{
-		if ( sampleList[i]->ProfileInstances != 0 )
+		if (aiSampleCalls[i] > 0)
 		{
-			sprintf(buffer,
-					"%s\t%d\t%d\t%u\t%d\t%s\n",
-					sampleList[i]->Name,
-					(int)((1000*sampleList[i]->Accumulator.QuadPart)/freq.QuadPart),
-					(int)((1000*sampleList[i]->Accumulator.QuadPart)/(freq.QuadPart*sampleList[i]->ProfileInstances)),
-					sampleList[i]->ProfileInstances,
-					(int)((1000*sampleList[i]->ChildrenSampleTime.QuadPart)/freq.QuadPart),
-					sampleList[i]->Parent == -1 ? "" : sampleList[sampleList[i]->Parent]->Name);
-			gDLL->logMsg("IFP_log.txt",buffer);
+			aiSamples.push_back(i);
 		}
 	}
+	std::sort(aiSamples.begin(), aiSamples.end(), ProfileSampleTimeOrder(aiSampleTicks));
+	szBuffer.Format("Turn %d\nFn\tTime (mS)\tAvg time (uS)\t#calls\tSelf time (mS)\n",
+			GC.getGameINLINE().getGameTurn());
+	for (size_t i = 0; i < aiSamples.size(); i++)
+	{
+		int iSample = aiSamples[i];
+		double fMicros = (__int64)aiSampleTicks[iSample] / fTicksPerMicro;
+		szBuffer += CvString::format("%s\t%d\t%d\t%u\t%d\n",
+				sampleList[iSample]->Name,
+				(int)(fMicros / 1000),
+				(int)(fMicros / aiSampleCalls[iSample]),
+				aiSampleCalls[iSample],
+				(int)((__int64)aiSampleSelfTicks[iSample] / fTicksPerMicro / 1000));
+		IFPLog("IFP_log.txt", szBuffer, false);
+	}
+	IFPLog("IFP_log.txt", szBuffer, true);
 }
 
-static bool isInLongLivedSection = false;
-static ProfileSample rootSample__("Root");
-
 //
 // dump the current (profile) call stack to debug output
 //
 void dumpProfileStack(void)
 {
-	int i = 0;
-	int dumpDepth = depth;
-	char buffer[200];
+	char buffer[MAX_PROFILE_DEPTH + 200];
 
 	OutputDebugString("Profile stack:\n");
 
-	while(dumpDepth >= 0)
+	for (int i = depth; i > 0; i--)
 	{
-		char* ptr = buffer;
-
-		i++;
-		for(int j = 0; j < i; j++)
+		int iIndent = depth - i + 1;
+		for (int j = 0; j < iIndent; j++)
 		{
-			*ptr++ = '\t';
+			buffer[j] = '\t';
 		}
-		strcpy(ptr,sampleStack[dumpDepth--]->Name);
-		strcat(ptr, "\n");
+		_snprintf(buffer + iIndent, 198, "%s\n", frameStack[i].pSample->Name);
+		buffer[iIndent + 198] = '\0';
 		OutputDebugString(buffer);
 	}
 }
@@ -537,14 +720,10 @@ bool IFPPythonCall(const char* callerFn, const char* moduleName, const char* fxn
 void startProfilingDLL(bool longLived)
 {
 #ifdef USE_INTERNAL_PROFILER
-	if ( longLived )
-	{
-		isInLongLivedSection = true;
-	}
-	else if (GC.isDLLProfilerEnabled() && !isInLongLivedSection)
+	// advc.003t: Timings now accumulate over a whole turn; see stopProfilingDLL.
+	if (GC.isDLLProfilerEnabled() && numNodes == 0)
 	{
 		IFPBegin();
-		IFPBeginSample(&rootSample__);
 	}
 #else
 	if (GC.isDLLProfilerEnabled())
@@ -560,14 +739,12 @@ void startProfilingDLL(bool longLived)
 void stopProfilingDLL(bool longLived)
 {
 #ifdef USE_INTERNAL_PROFILER
-	if ( longLived )
+	/*  advc.003t: The long-lived section ends with CvGame::doTurn, i.e. after
+		the AI turns. Dump the timings of the whole turn then. */
+	if (longLived && GC.isDLLProfilerEnabled())
 	{
-		isInLongLivedSection = false;
-	}
-	else if (GC.isDLLProfilerEnabled() && !isInLongLivedSection)
-	{
-		IFPEndSample(&rootSample__);
 		IFPEnd();
+		IFPBegin();
 	}
 #else
 	if (GC.isDLLProfilerEnabled())
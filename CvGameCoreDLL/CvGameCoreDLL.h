@@ -164,7 +164,6 @@ struct ProfileSample;
 void IFPBeginSample(ProfileSample* sample);
 void IFPEndSample(ProfileSample* sample);
 void dumpProfileStack(void);
-void EnableDetailedTrace(bool enable);
 #endif
 
 #ifdef _DEBUG
@@ -913,6 +913,24 @@ bool isLimitedProject(ProjectTypes eProject)
 // Modified by Jason Winokur to keep the intermediate factorials small
 __int64 getBinomialCoefficient(int iN, int iK)
 {
+	/*  <advc.003aj> Pascal's triangle for the small arguments that the
+		combat odds need. Up to N=61, the loop below doesn't overflow either,
+		so the results are the same. */
+	static int const iMAX_TABLE_N = 61;
+	static __int64 aaiTable[iMAX_TABLE_N + 1][iMAX_TABLE_N + 1];
+	static bool bTableReady = false;
+	if (!bTableReady)
+	{
+		for (int i = 0; i <= iMAX_TABLE_N; i++)
+		{
+			aaiTable[i][0] = aaiTable[i][i] = 1;
+			for (int j = 1; j < i; j++)
+				aaiTable[i][j] = aaiTable[i - 1][j - 1] + aaiTable[i - 1][j];
+		}
+		bTableReady = true;
+	}
+	if (iN >= 0 && iN <= iMAX_TABLE_N && iK >= 0 && iK <= iN)
+		return aaiTable[iN][iK]; // </advc.003aj>
 	__int64 iTemp = 1;
 	//take advantage of symmetry in combination, eg. 15C12 = 15C3
 	iK = std::min(iK, iN - iK);
@@ -927,14 +945,60 @@ __int64 getBinomialCoefficient(int iN, int iK)
 	return iTemp;
 }
 
+/*  <advc.003aj> The combat odds only depend on a handful of small integers,
+	and the AI keeps asking for the same battles when it compares its units
+	against a stack. Memoize the results of both algorithms. */
+static int calculateCombatOdds(int iAttackerLowFS, int iAttackerHighFS, int iDefenderLowFS, int iDefenderHighFS, int iNeededRoundsAttacker, int iNeededRoundsDefender, int iAttackerOdds);
+static int LFBcalculateTotalCombatOdds(int iAttackerLowFS, int iAttackerHighFS, int iDefenderLowFS, int iDefenderHighFS, int iNeededRoundsAttacker, int iNeededRoundsDefender, int iAttackerOdds);
+
+static stdext::hash_map<__int64,int> combatOddsMemo;
+static int iCombatOddsMemoDieSides = -1;
+// Cleared entirely when full; refilling it is cheap.
+static int const iMAX_COMBAT_ODDS_MEMO_SIZE = 8192;
+
+static int lookupCombatOdds(bool bLFB, int iAttackerLowFS, int iAttackerHighFS, int iDefenderLowFS, int iDefenderHighFS, int iNeededRoundsAttacker, int iNeededRoundsDefender, int iAttackerOdds)
+{
+	// Key layout: 1 bit for bLFB, 6 per first strike bound, 8 per number of rounds, 16 for the odds
+	if (iAttackerLowFS < 0 || iAttackerHighFS >= 64 || iDefenderLowFS < 0 || iDefenderHighFS >= 64 ||
+			iNeededRoundsAttacker < 0 || iNeededRoundsAttacker >= 256 ||
+			iNeededRoundsDefender < 0 || iNeededRoundsDefender >= 256 ||
+			iAttackerOdds < 0 || iAttackerOdds >= 65536)
+	{
+		return (bLFB ?
+				LFBcalculateTotalCombatOdds(iAttackerLowFS, iAttackerHighFS, iDefenderLowFS, iDefenderHighFS, iNeededRoundsAttacker, iNeededRoundsDefender, iAttackerOdds) :
+				calculateCombatOdds(iAttackerLowFS, iAttackerHighFS, iDefenderLowFS, iDefenderHighFS, iNeededRoundsAttacker, iNeededRoundsDefender, iAttackerOdds));
+	}
+	if (iCombatOddsMemoDieSides != GC.getCOMBAT_DIE_SIDES())
+	{
+		combatOddsMemo.clear();
+		iCombatOddsMemoDieSides = GC.getCOMBAT_DIE_SIDES();
+	}
+	__int64 iKey = (bLFB ? 1 : 0);
+	iKey = (iKey << 6) | iAttackerLowFS;
+	iKey = (iKey << 6) | iAttackerHighFS;
+	iKey = (iKey << 6) | iDefenderLowFS;
+	iKey = (iKey << 6) | iDefenderHighFS;
+	iKey = (iKey << 8) | iNeededRoundsAttacker;
+	iKey = (iKey << 8) | iNeededRoundsDefender;
+	iKey = (iKey << 16) | iAttackerOdds;
+	stdext::hash_map<__int64,int>::const_iterator pos = combatOddsMemo.find(iKey);
+	if (pos != combatOddsMemo.end())
+		return pos->second;
+	int iOdds = (bLFB ?
+			LFBcalculateTotalCombatOdds(iAttackerLowFS, iAttackerHighFS, iDefenderLowFS, iDefenderHighFS, iNeededRoundsAttacker, iNeededRoundsDefender, iAttackerOdds) :
+			calculateCombatOdds(iAttackerLowFS, iAttackerHighFS, iDefenderLowFS, iDefenderHighFS, iNeededRoundsAttacker, iNeededRoundsDefender, iAttackerOdds));
+	if ((int)combatOddsMemo.size() >= iMAX_COMBAT_ODDS_MEMO_SIZE)
+		combatOddsMemo.clear();
+	combatOddsMemo[iKey] = iOdds;
+	return iOdds;
+} // </advc.003aj>
+
 // FUNCTION: getCombatOdds
 // Calculates combat odds, given two units
 // Returns value from 0-1000
 // Written by DeepO
 int getCombatOdds(const CvUnit* pAttacker, const CvUnit* pDefender)
 {
-	float fOddsEvent;
-	float fOddsAfterEvent;
 	int iAttackerStrength;
 	int iAttackerFirepower;
 	int iDefenderStrength;
@@ -946,18 +1010,11 @@ int getCombatOdds(const CvUnit* pAttacker, const CvUnit* pDefender)
 	int iDamageToDefender;
 	int iNeededRoundsAttacker;
 	int iNeededRoundsDefender;
-	int iMaxRounds;
 	int iAttackerLowFS;
 	int iAttackerHighFS;
 	int iDefenderLowFS;
 	int iDefenderHighFS;
-	int iFirstStrikes;
 	int iDefenderHitLimit;
-	int iI;
-	int iJ;
-	int iI3;
-	int iI4;
-	int iOdds = 0;
 
 	// setup battle, calculate strengths and odds
 	//////
@@ -1002,7 +1059,6 @@ int getCombatOdds(const CvUnit* pAttacker, const CvUnit* pDefender)
 
 	iNeededRoundsAttacker = (std::max(0, pDefender->currHitPoints() - iDefenderHitLimit) + iDamageToDefender - 1 ) / iDamageToDefender;
 	iNeededRoundsDefender = (pAttacker->currHitPoints() + iDamageToAttacker - 1 ) / iDamageToAttacker;
-	iMaxRounds = iNeededRoundsAttacker + iNeededRoundsDefender - 1;
 
 	// calculate possible first strikes distribution.
 	// We can't use the getCombatFirstStrikes() function (only one result,
@@ -1020,6 +1076,25 @@ int getCombatOdds(const CvUnit* pAttacker, const CvUnit* pDefender)
 		return LFBgetCombatOdds(iAttackerLowFS, iAttackerHighFS, iDefenderLowFS, iDefenderHighFS, iNeededRoundsAttacker, iNeededRoundsDefender, iAttackerOdds);
 	// /UncutDragon
 
+	// advc.003aj: Moved into calculateCombatOdds
+	return lookupCombatOdds(false, iAttackerLowFS, iAttackerHighFS, iDefenderLowFS, iDefenderHighFS, iNeededRoundsAttacker, iNeededRoundsDefender, iAttackerOdds);
+}
+
+/*  advc.003aj: Cut from getCombatOdds. Only depends on the discretized
+	battle, not on the units. */
+static int calculateCombatOdds(int iAttackerLowFS, int iAttackerHighFS, int iDefenderLowFS, int iDefenderHighFS, int iNeededRoundsAttacker, int iNeededRoundsDefender, int iAttackerOdds)
+{
+	float fOddsEvent;
+	float fOddsAfterEvent;
+	int iDefenderOdds = GC.getCOMBAT_DIE_SIDES() - iAttackerOdds;
+	int iMaxRounds = iNeededRoundsAttacker + iNeededRoundsDefender - 1;
+	int iFirstStrikes;
+	int iI;
+	int iJ;
+	int iI3;
+	int iI4;
+	int iOdds = 0;
+
 	// For every possible first strike event, calculate the odds of combat.
 	// Then, add these to the total, weighted to the chance of that first 
 	// strike event occurring
@@ -1155,7 +1230,8 @@ int getCombatOdds(const CvUnit* pAttacker, const CvUnit* pDefender)
 	// note: the integer math breaks down when #FS > 656 (with a die size of 1000)
 	//////
 
-	iOdds /= (((pDefender->immuneToFirstStrikes()) ? 0 : pAttacker->chanceFirstStrikes()) + 1) * (((pAttacker->immuneToFirstStrikes()) ? 0 : pDefender->chanceFirstStrikes()) + 1); 
+	//iOdds /= (((pDefender->immuneToFirstStrikes()) ? 0 : pAttacker->chanceFirstStrikes()) + 1) * (((pAttacker->immuneToFirstStrikes()) ? 0 : pDefender->chanceFirstStrikes()) + 1);
+	iOdds /= (iAttackerHighFS - iAttackerLowFS + 1) * (iDefenderHighFS - iDefenderLowFS + 1); // advc.003aj
 
 	// finished!
 	//////
@@ -1809,6 +1885,12 @@ int pathHeuristic(int iFromX, int iFromY, int iToX, int iToY)
 	return (stepDistance(iFromX, iFromY, iToX, iToY) * PATH_MOVEMENT_WEIGHT);
 }
 
+// advc.003x: For a lower bound on the number of steps other than stepDistance
+int pathStepHeuristic(int iSteps)
+{
+	return iSteps * PATH_MOVEMENT_WEIGHT;
+}
+
 // This function has been completely rewritten for K-Mod. (the rewrite includes some bug fixes as well as some new features)
 int pathCost(FAStarNode* parent, FAStarNode* node, int data, const void* pointer, FAStar* finder)
 {
@@ -3190,6 +3272,12 @@ LFBoddsFirstStrike pOddsCacheFSNeg;
 
 // gets the combat odds using precomputed attacker/defender values instead of unit pointers
 int LFBgetCombatOdds(int iAttackerLowFS,	int iAttackerHighFS, int iDefenderLowFS, int iDefenderHighFS, int iNeededRoundsAttacker, int iNeededRoundsDefender, int iAttackerOdds)
+{
+	// advc.003aj: Body moved into LFBcalculateTotalCombatOdds
+	return lookupCombatOdds(true, iAttackerLowFS, iAttackerHighFS, iDefenderLowFS, iDefenderHighFS, iNeededRoundsAttacker, iNeededRoundsDefender, iAttackerOdds);
+}
+
+static int LFBcalculateTotalCombatOdds(int iAttackerLowFS, int iAttackerHighFS, int iDefenderLowFS, int iDefenderHighFS, int iNeededRoundsAttacker, int iNeededRoundsDefender, int iAttackerOdds)
 {
 	int iDefenderOdds;
 	bool bFlip = false;
@@ -197,15 +197,15 @@ void CvGameTextMgr::setDateStr(CvWString& szString, int iGameTurn, bool bSave, C
 		break;
 
 	case CALENDAR_WEEKS:
-		szWeekBuffer = gDLL->getText("TXT_KEY_TIME_WEEK", ((iGameTurn % GC.getDefineINT("WEEKS_PER_MONTHS")) + 1));
+		szWeekBuffer = gDLL->getText("TXT_KEY_TIME_WEEK", ((iGameTurn % GC.getDefineINT(CvGlobals::WEEKS_PER_MONTHS)) + 1));
 
 		if (bSave)
 		{
-			szString = (szYearBuffer + "-" + GC.getMonthInfo((MonthTypes)((iGameTurn / GC.getDefineINT("WEEKS_PER_MONTHS")) % GC.getNumMonthInfos())).getDescription() + "-" + szWeekBuffer);
+			szString = (szYearBuffer + "-" + GC.getMonthInfo((MonthTypes)((iGameTurn / GC.getDefineINT(CvGlobals::WEEKS_PER_MONTHS)) % GC.getNumMonthInfos())).getDescription() + "-" + szWeekBuffer);
 		}
 		else
 		{
-			szString = (szWeekBuffer + ", " + GC.getMonthInfo((MonthTypes)((iGameTurn / GC.getDefineINT("WEEKS_PER_MONTHS")) % GC.getNumMonthInfos())).getDescription() + ", " + szYearBuffer);
+			szString = (szWeekBuffer + ", " + GC.getMonthInfo((MonthTypes)((iGameTurn / GC.getDefineINT(CvGlobals::WEEKS_PER_MONTHS)) % GC.getNumMonthInfos())).getDescription() + ", " + szYearBuffer);
 		}
 		break;
 
@@ -419,7 +419,7 @@ void CvGameTextMgr::setEspionageMissionHelp(CvWStringBuffer &szBuffer, const CvU
 			}
 			else if (pUnit->getFortifyTurns() > 0)
 			{
-				int iModifier = -(pUnit->getFortifyTurns() * GC.getDefineINT("ESPIONAGE_EACH_TURN_UNIT_COST_DECREASE"));
+				int iModifier = -(pUnit->getFortifyTurns() * GC.getDefineINT(CvGlobals::ESPIONAGE_EACH_TURN_UNIT_COST_DECREASE));
 				if (0 != iModifier)
 				{
 					szBuffer.append(NEWLINE);
@@ -2461,11 +2461,11 @@ static float getCombatOddsSpecific(CvUnit* pAttacker, CvUnit* pDefender, int n_A
 	iDefenderFirepower = pDefender->currFirepower(pDefender->plot(), pAttacker);
 
 	iStrengthFactor = ((iAttackerFirepower + iDefenderFirepower + 1) / 2);
-	iDamageToAttacker = std::max(1,((GC.getDefineINT("COMBAT_DAMAGE") * (iDefenderFirepower + iStrengthFactor)) / (iAttackerFirepower + iStrengthFactor)));
-	iDamageToDefender = std::max(1,((GC.getDefineINT("COMBAT_DAMAGE") * (iAttackerFirepower + iStrengthFactor)) / (iDefenderFirepower + iStrengthFactor)));
+	iDamageToAttacker = std::max(1,((GC.getDefineINT(CvGlobals::COMBAT_DAMAGE) * (iDefenderFirepower + iStrengthFactor)) / (iAttackerFirepower + iStrengthFactor)));
+	iDamageToDefender = std::max(1,((GC.getDefineINT(CvGlobals::COMBAT_DAMAGE) * (iAttackerFirepower + iStrengthFactor)) / (iDefenderFirepower + iStrengthFactor)));
 
-	iDefenderOdds = ((GC.getDefineINT("COMBAT_DIE_SIDES") * iDefenderStrength) / (iAttackerStrength + iDefenderStrength));
-	iAttackerOdds = GC.getDefineINT("COMBAT_DIE_SIDES") - iDefenderOdds;
+	iDefenderOdds = ((GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES) * iDefenderStrength) / (iAttackerStrength + iDefenderStrength));
+	iAttackerOdds = GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES) - iDefenderOdds;
 	/*  advc.001: Replacing the check below. The BUG authors must've missed this
 		one when they integrated ACO into BUG. */
 	if(!getBugOptionBOOL("ACO__IgnoreBarbFreeWins", false)
@@ -2480,8 +2480,8 @@ static float getCombatOddsSpecific(CvUnit* pAttacker, CvUnit* pDefender, int n_A
 				//attacker is not barb and attacker player has free wins left
 				//I have assumed in the following code only one of the units (attacker and defender) can be a barbarian
 
-				iDefenderOdds = std::min((10 * GC.getDefineINT("COMBAT_DIE_SIDES")) / 100, iDefenderOdds);
-				iAttackerOdds = std::max((90 * GC.getDefineINT("COMBAT_DIE_SIDES")) / 100, iAttackerOdds);
+				iDefenderOdds = std::min((10 * GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES)) / 100, iDefenderOdds);
+				iAttackerOdds = std::max((90 * GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES)) / 100, iAttackerOdds);
 			}
 		}
 		else if (pAttacker->isBarbarian())
@@ -2490,8 +2490,8 @@ static float getCombatOddsSpecific(CvUnit* pAttacker, CvUnit* pDefender, int n_A
 			if (!GET_PLAYER(pDefender->getOwnerINLINE()).isBarbarian() && GET_PLAYER(pDefender->getOwnerINLINE()).getWinsVsBarbs() < GC.getHandicapInfo(GET_PLAYER(pDefender->getOwnerINLINE()).getHandicapType()).getFreeWinsVsBarbs())
 			{
 				//defender is not barbarian and defender has free wins left and attacker is barbarian
-				iAttackerOdds = std::min((10 * GC.getDefineINT("COMBAT_DIE_SIDES")) / 100, iAttackerOdds);
-				iDefenderOdds = std::max((90 * GC.getDefineINT("COMBAT_DIE_SIDES")) / 100, iDefenderOdds);
+				iAttackerOdds = std::min((10 * GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES)) / 100, iAttackerOdds);
+				iDefenderOdds = std::max((90 * GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES)) / 100, iDefenderOdds);
 			}
 		}
 	}
@@ -2513,8 +2513,8 @@ static float getCombatOddsSpecific(CvUnit* pAttacker, CvUnit* pDefender, int n_A
 	AttFSC = (pDefender->immuneToFirstStrikes()) ? 0 : (pAttacker->chanceFirstStrikes());
 	DefFSC = (pAttacker->immuneToFirstStrikes()) ? 0 : (pDefender->chanceFirstStrikes());
 
-	float P_A = (float)iAttackerOdds / GC.getDefineINT("COMBAT_DIE_SIDES");
-	float P_D = (float)iDefenderOdds / GC.getDefineINT("COMBAT_DIE_SIDES");
+	float P_A = (float)iAttackerOdds / GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES);
+	float P_D = (float)iDefenderOdds / GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES);
 	float answer = 0.0f;
 	if (n_A < N_A && n_D == iNeededRoundsAttacker)   // (1) Defender dies or is taken to combat limit
 	{
@@ -2718,7 +2718,7 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 
 	// <advc.048>
 	bool bBestOddsHelp = false;
-	if(!bMaxSurvival && GC.getDefineINT("GROUP_ATTACK_BEST_ODDS_HELP") > 0) {
+	if(!bMaxSurvival && GC.getDefineINT(CvGlobals::GROUP_ATTACK_BEST_ODDS_HELP) > 0) {
 		CvUnit* pBestOddsAttacker = kSelectionList.AI_getBestGroupAttacker(pPlot, false, iOdds,
 				false, false, false, true);
 		if(pBestOddsAttacker == NULL) {
@@ -2820,7 +2820,7 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 		if (ACO_enabled)
 		{
 			// <advc.312>
-			int iMaxXPAtt = GC.getDefineINT("MAX_EXPERIENCE_PER_COMBAT");
+			int iMaxXPAtt = GC.getDefineINT(CvGlobals::MAX_EXPERIENCE_PER_COMBAT);
 			int iMaxXPDef = iMaxXPAtt;
 			if(pAttacker->isBarbarian())
 				iMaxXPDef -= 4;
@@ -2869,12 +2869,12 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 			FAssert((iAttackerStrength + iDefenderStrength)*(iAttackerFirepower + iDefenderFirepower) > 0);
 
 			int iStrengthFactor    = ((iAttackerFirepower + iDefenderFirepower + 1) / 2);
-			int iDamageToAttacker  = std::max(1,((GC.getDefineINT("COMBAT_DAMAGE") * (iDefenderFirepower + iStrengthFactor)) / (iAttackerFirepower + iStrengthFactor)));
-			int iDamageToDefender  = std::max(1,((GC.getDefineINT("COMBAT_DAMAGE") * (iAttackerFirepower + iStrengthFactor)) / (iDefenderFirepower + iStrengthFactor)));
+			int iDamageToAttacker  = std::max(1,((GC.getDefineINT(CvGlobals::COMBAT_DAMAGE) * (iDefenderFirepower + iStrengthFactor)) / (iAttackerFirepower + iStrengthFactor)));
+			int iDamageToDefender  = std::max(1,((GC.getDefineINT(CvGlobals::COMBAT_DAMAGE) * (iAttackerFirepower + iStrengthFactor)) / (iDefenderFirepower + iStrengthFactor)));
 			int iFlankAmount       = iDamageToAttacker;
 
-			int iDefenderOdds = ((GC.getDefineINT("COMBAT_DIE_SIDES") * iDefenderStrength) / (iAttackerStrength + iDefenderStrength));
-			int iAttackerOdds = GC.getDefineINT("COMBAT_DIE_SIDES") - iDefenderOdds;
+			int iDefenderOdds = ((GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES) * iDefenderStrength) / (iAttackerStrength + iDefenderStrength));
+			int iAttackerOdds = GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES) - iDefenderOdds;
 
 			// Barbarian related code.
 			/*  advc.001: The section below deals with FreeWins, so it should
@@ -2891,8 +2891,8 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 					{
 						//attacker is not barb and attacker player has free wins left
 						//I have assumed in the following code only one of the units (attacker and defender) can be a barbarian
-						iDefenderOdds = std::min((10 * GC.getDefineINT("COMBAT_DIE_SIDES")) / 100, iDefenderOdds);
-						iAttackerOdds = std::max((90 * GC.getDefineINT("COMBAT_DIE_SIDES")) / 100, iAttackerOdds);
+						iDefenderOdds = std::min((10 * GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES)) / 100, iDefenderOdds);
+						iAttackerOdds = std::max((90 * GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES)) / 100, iAttackerOdds);
 						szTempBuffer.Format(SETCOLR L"%d\n" ENDCOLR,
 							TEXT_COLOR("COLOR_HIGHLIGHT_TEXT"),GC.getHandicapInfo(GET_PLAYER(pAttacker->getOwnerINLINE()).getHandicapType()).getFreeWinsVsBarbs()-GET_PLAYER(pAttacker->getOwnerINLINE()).getWinsVsBarbs());
 						szString.append(gDLL->getText("TXT_ACO_BarbFreeWinsLeft"));
@@ -2908,8 +2908,8 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 						if (!GET_PLAYER(pDefender->getOwnerINLINE()).isBarbarian() && GET_PLAYER(pDefender->getOwnerINLINE()).getWinsVsBarbs() < GC.getHandicapInfo(GET_PLAYER(pDefender->getOwnerINLINE()).getHandicapType()).getFreeWinsVsBarbs())
 						{
 							//defender is not barbarian and defender has free wins left and attacker is barbarian
-							iAttackerOdds = std::min((10 * GC.getDefineINT("COMBAT_DIE_SIDES")) / 100, iAttackerOdds);
-							iDefenderOdds = std::max((90 * GC.getDefineINT("COMBAT_DIE_SIDES")) / 100, iDefenderOdds);
+							iAttackerOdds = std::min((10 * GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES)) / 100, iAttackerOdds);
+							iDefenderOdds = std::max((90 * GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES)) / 100, iDefenderOdds);
 							szTempBuffer.Format(SETCOLR L"%d\n" ENDCOLR,
 								TEXT_COLOR("COLOR_HIGHLIGHT_TEXT"),GC.getHandicapInfo(GET_PLAYER(pDefender->getOwnerINLINE()).getHandicapType()).getFreeWinsVsBarbs()-GET_PLAYER(pDefender->getOwnerINLINE()).getWinsVsBarbs());
 							szString.append(gDLL->getText("TXT_ACO_BarbFreeWinsLeft"));
@@ -2923,27 +2923,27 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 			//XP calculations
 			int iExperience;
 			int iWithdrawXP;//thanks to phungus420
-			iWithdrawXP = GC.getDefineINT("EXPERIENCE_FROM_WITHDRAWL");//thanks to phungus420
+			iWithdrawXP = GC.getDefineINT(CvGlobals::EXPERIENCE_FROM_WITHDRAWL);//thanks to phungus420
 
 			if (pAttacker->combatLimit() < 100)
 			{
-				iExperience        = GC.getDefineINT("EXPERIENCE_FROM_WITHDRAWL");
+				iExperience        = GC.getDefineINT(CvGlobals::EXPERIENCE_FROM_WITHDRAWL);
 			}
 			else
 			{
 				iExperience        = (pDefender->attackXPValue() * iDefenderStrength) / iAttackerStrength;
-				iExperience        = range(iExperience, GC.getDefineINT("MIN_EXPERIENCE_PER_COMBAT"),
+				iExperience        = range(iExperience, GC.getDefineINT(CvGlobals::MIN_EXPERIENCE_PER_COMBAT),
 						iMaxXPAtt); // advc.312
 			}
 
 			int iDefExperienceKill;
 			iDefExperienceKill = (pAttacker->defenseXPValue() * iAttackerStrength) / iDefenderStrength;
-			iDefExperienceKill = range(iDefExperienceKill, GC.getDefineINT("MIN_EXPERIENCE_PER_COMBAT"),
+			iDefExperienceKill = range(iDefExperienceKill, GC.getDefineINT(CvGlobals::MIN_EXPERIENCE_PER_COMBAT),
 					iMaxXPDef); // advc.312
 
 			int iBonusAttackerXP = (iExperience * iAttackerExperienceModifier) / 100;
 			int iBonusDefenderXP = (iDefExperienceKill * iDefenderExperienceModifier) / 100;
-			int iBonusWithdrawXP = (GC.getDefineINT("EXPERIENCE_FROM_WITHDRAWL") * iAttackerExperienceModifier) / 100;
+			int iBonusWithdrawXP = (GC.getDefineINT(CvGlobals::EXPERIENCE_FROM_WITHDRAWL) * iAttackerExperienceModifier) / 100;
 
 
 			//The following code adjusts the XP for barbarian encounters.  In standard game, barb and animal xp cap is 10,5 respectively.
@@ -2953,22 +2953,22 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 				if (pDefender->isAnimal())
 				{
 					//animal
-					iExperience = range(iExperience,0,GC.getDefineINT("ANIMAL_MAX_XP_VALUE")-(pAttacker->getExperience()));
+					iExperience = range(iExperience,0,GC.getDefineINT(CvGlobals::ANIMAL_MAX_XP_VALUE)-(pAttacker->getExperience()));
 					if (iExperience < 0 )
 					{
 						iExperience = 0;
 					}
-					iWithdrawXP = range(iWithdrawXP,0,GC.getDefineINT("ANIMAL_MAX_XP_VALUE")-(pAttacker->getExperience()));
+					iWithdrawXP = range(iWithdrawXP,0,GC.getDefineINT(CvGlobals::ANIMAL_MAX_XP_VALUE)-(pAttacker->getExperience()));
 					if (iWithdrawXP < 0 )
 					{
 						iWithdrawXP = 0;
 					}
-					iBonusAttackerXP = range(iBonusAttackerXP,0,GC.getDefineINT("ANIMAL_MAX_XP_VALUE")-(pAttacker->getExperience() + iExperience));
+					iBonusAttackerXP = range(iBonusAttackerXP,0,GC.getDefineINT(CvGlobals::ANIMAL_MAX_XP_VALUE)-(pAttacker->getExperience() + iExperience));
 					if (iBonusAttackerXP < 0 )
 					{
 						iBonusAttackerXP = 0;
 					}
-					iBonusWithdrawXP = range(iBonusWithdrawXP,0,GC.getDefineINT("ANIMAL_MAX_XP_VALUE")-(pAttacker->getExperience() + iWithdrawXP));
+					iBonusWithdrawXP = range(iBonusWithdrawXP,0,GC.getDefineINT(CvGlobals::ANIMAL_MAX_XP_VALUE)-(pAttacker->getExperience() + iWithdrawXP));
 					if (iBonusWithdrawXP < 0 )
 					{
 						iBonusWithdrawXP = 0;
@@ -2977,22 +2977,22 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 				else
 				{
 					//normal barbarian
-					iExperience = range(iExperience,0,GC.getDefineINT("BARBARIAN_MAX_XP_VALUE")-pAttacker->getExperience());
+					iExperience = range(iExperience,0,GC.getDefineINT(CvGlobals::BARBARIAN_MAX_XP_VALUE)-pAttacker->getExperience());
 					if (iExperience < 0 )
 					{
 						iExperience = 0;
 					}
-					iWithdrawXP = range(iWithdrawXP,0,GC.getDefineINT("BARBARIAN_MAX_XP_VALUE")-(pAttacker->getExperience()));
+					iWithdrawXP = range(iWithdrawXP,0,GC.getDefineINT(CvGlobals::BARBARIAN_MAX_XP_VALUE)-(pAttacker->getExperience()));
 					if (iWithdrawXP < 0 )
 					{
 						iWithdrawXP = 0;
 					}
-					iBonusAttackerXP = range(iBonusAttackerXP,0,GC.getDefineINT("BARBARIAN_MAX_XP_VALUE")-(pAttacker->getExperience() + iExperience));
+					iBonusAttackerXP = range(iBonusAttackerXP,0,GC.getDefineINT(CvGlobals::BARBARIAN_MAX_XP_VALUE)-(pAttacker->getExperience() + iExperience));
 					if (iBonusAttackerXP < 0 )
 					{
 						iBonusAttackerXP = 0;
 					}
-					iBonusWithdrawXP = range(iBonusWithdrawXP,0,GC.getDefineINT("BARBARIAN_MAX_XP_VALUE")-(pAttacker->getExperience() + iWithdrawXP));
+					iBonusWithdrawXP = range(iBonusWithdrawXP,0,GC.getDefineINT(CvGlobals::BARBARIAN_MAX_XP_VALUE)-(pAttacker->getExperience() + iWithdrawXP));
 					if (iBonusWithdrawXP < 0 )
 					{
 						iBonusWithdrawXP = 0;
@@ -3311,7 +3311,7 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 			else
 			{
 				szTempBuffer.Format(L": " SETCOLR L"%.2f%% " L"%d" ENDCOLR,
-					TEXT_COLOR("COLOR_POSITIVE_TEXT"),100.0f*PullOutOdds,GC.getDefineINT("EXPERIENCE_FROM_WITHDRAWL"));
+					TEXT_COLOR("COLOR_POSITIVE_TEXT"),100.0f*PullOutOdds,GC.getDefineINT(CvGlobals::EXPERIENCE_FROM_WITHDRAWL));
 				//iExperience,TEXT_COLOR("COLOR_POSITIVE_TEXT"), E_HP_Att_Victory/AttackerKillOdds);
 				szString.append(gDLL->getText("TXT_ACO_Withdraw"));
 				szString.append(szTempBuffer.GetCString());
@@ -3349,7 +3349,7 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 			{
 				szString.append(NEWLINE);
 				szTempBuffer.Format(L": " SETCOLR L"%.2f%% " ENDCOLR SETCOLR L"%d" ENDCOLR,
-					TEXT_COLOR("COLOR_UNIT_TEXT"),100.0f*RetreatOdds,TEXT_COLOR("COLOR_POSITIVE_TEXT"),GC.getDefineINT("EXPERIENCE_FROM_WITHDRAWL"));
+					TEXT_COLOR("COLOR_UNIT_TEXT"),100.0f*RetreatOdds,TEXT_COLOR("COLOR_POSITIVE_TEXT"),GC.getDefineINT(CvGlobals::EXPERIENCE_FROM_WITHDRAWL));
 				//szString.append(gDLL->getText("TXT_ACO_Retreat"));
 				szString.append(gDLL->getText("TXT_ACO_Withdraw")); // advc.048b
 				szString.append(szTempBuffer.GetCString());
@@ -3405,9 +3405,9 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 				if (pAttacker->combatLimit() == (pDefender->maxHitPoints() ))
 				{
 					FAssert(/* advc.312: */ iMaxXPAtt
-							> GC.getDefineINT("MIN_EXPERIENCE_PER_COMBAT")); //ensuring the differences is at least 1
+							> GC.getDefineINT(CvGlobals::MIN_EXPERIENCE_PER_COMBAT)); //ensuring the differences is at least 1
 					int size = /* advc.312: */ iMaxXPAtt
-							- GC.getDefineINT("MIN_EXPERIENCE_PER_COMBAT");
+							- GC.getDefineINT(CvGlobals::MIN_EXPERIENCE_PER_COMBAT);
 					float* CombatRatioThresholds = new float[size];
 
 					for (int i = 0; i < size; i++) //setup the array
@@ -3429,7 +3429,7 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 							{
 								szString.append(NEWLINE);
 								szTempBuffer.Format(L"(%.2f:%d",
-									CombatRatioThresholds[i],GC.getDefineINT("MIN_EXPERIENCE_PER_COMBAT")+1);
+									CombatRatioThresholds[i],GC.getDefineINT(CvGlobals::MIN_EXPERIENCE_PER_COMBAT)+1);
 								szString.append(szTempBuffer.GetCString());
 								szString.append(gDLL->getText("TXT_ACO_XP"));
 								szTempBuffer.Format(L"), (R=" SETCOLR L"%.2f" ENDCOLR
@@ -3943,7 +3943,7 @@ bool CvGameTextMgr::setCombatPlotHelp(CvWStringBuffer &szString, CvPlot* pPlot)
 				szString.append(gDLL->getText("TXT_ACO_HitsAt"));
 				// advc.048: Closing parenthesis added
 				szTempBuffer.Format(L")" SETCOLR L" %.1f%%" ENDCOLR,
-					TEXT_COLOR("COLOR_POSITIVE_TEXT"),float(iAttackerOdds)*100.0f / float(GC.getDefineINT("COMBAT_DIE_SIDES")));
+					TEXT_COLOR("COLOR_POSITIVE_TEXT"),float(iAttackerOdds)*100.0f / float(GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES)));
 				szString.append(szTempBuffer.GetCString());
 			}
 			/*  advc.048: The else branch of this conditional contained the XP range code,
@@ -4515,7 +4515,7 @@ void CvGameTextMgr::setPlotHelp(CvWStringBuffer& szString, CvPlot* pPlot)
 			// advc.004h:
 			pHeadSelectedUnit->canFound() && pHeadSelectedUnit->atPlot(pPlot)) {
 			szTempBuffer = CvWString::format(L" +%d%c",
-					GC.getDefineINT("FRESH_WATER_HEALTH_CHANGE"),
+					GC.getDefineINT(CvGlobals::FRESH_WATER_HEALTH_CHANGE),
 					gDLL->getSymbolID(HEALTHY_CHAR));
 			szString.append(szTempBuffer);
 		} // </advc.004b>
@@ -5943,7 +5943,7 @@ void CvGameTextMgr::setPlotHelpDebug_ShiftAltOnly(CvWStringBuffer& szString, CvP
 				int iMaxThisSpecialist = pCity->getMaxSpecialistCount((SpecialistTypes) iI);
 				int iSpecialistCount = pCity->getSpecialistCount((SpecialistTypes) iI);
 				bool bUsingSpecialist = (iSpecialistCount > 0);
-				bool bDefaultSpecialist = (iI == GC.getDefineINT("DEFAULT_SPECIALIST"));
+				bool bDefaultSpecialist = (iI == GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST));
 
 				// can this city have any of this specialist?
 				if (iMaxThisSpecialist > 0 || bDefaultSpecialist)
@@ -8889,7 +8889,7 @@ void CvGameTextMgr::setBasicUnitHelp(CvWStringBuffer &szBuffer, UnitTypes eUnit,
 
 	if (u.getLeaderExperience() > 0)
 	{
-		if (0 == GC.getDefineINT("WARLORD_EXTRA_EXPERIENCE_PER_UNIT_PERCENT"))
+		if (0 == GC.getDefineINT(CvGlobals::WARLORD_EXTRA_EXPERIENCE_PER_UNIT_PERCENT))
 		{
 			szBuffer.append(NEWLINE);
 			szBuffer.append(gDLL->getText("TXT_KEY_UNIT_LEADER", u.getLeaderExperience()));
@@ -10520,13 +10520,13 @@ void CvGameTextMgr::setBuildingHelpActual(CvWStringBuffer &szBuffer, BuildingTyp
 		szBuffer.append(gDLL->getText("TXT_KEY_BUILDING_PROVIDES_POWER"));
 
 		/* original bts code
-		if (kBuilding.isDirtyPower() && (GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE") != 0))
+		if (kBuilding.isDirtyPower() && (GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE) != 0))
 		{
-			szTempBuffer.Format(L" (+%d%c)", abs(GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE")), ((GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE") > 0) ? gDLL->getSymbolID(HEALTHY_CHAR): gDLL->getSymbolID(UNHEALTHY_CHAR)));
+			szTempBuffer.Format(L" (+%d%c)", abs(GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE)), ((GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE) > 0) ? gDLL->getSymbolID(HEALTHY_CHAR): gDLL->getSymbolID(UNHEALTHY_CHAR)));
 			szBuffer.append(szTempBuffer);
 		} */
 		// K-Mod. Also include base health change from power.
-		int iPowerHealth = GC.getDefineINT("POWER_HEALTH_CHANGE") + (kBuilding.isDirtyPower() ? GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE") : 0);
+		int iPowerHealth = GC.getDefineINT(CvGlobals::POWER_HEALTH_CHANGE) + (kBuilding.isDirtyPower() ? GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE) : 0);
 		if (iPowerHealth)
 		{
 			szTempBuffer.Format(L" (+%d%c)", abs(iPowerHealth), iPowerHealth > 0 ? gDLL->getSymbolID(HEALTHY_CHAR): gDLL->getSymbolID(UNHEALTHY_CHAR));
@@ -11192,13 +11192,13 @@ void CvGameTextMgr::setBuildingHelpActual(CvWStringBuffer &szBuffer, BuildingTyp
 		szBuffer.append(gDLL->getText("TXT_KEY_BUILDING_PROVIDES_POWER_WITH", GC.getBonusInfo((BonusTypes)kBuilding.getPowerBonus()).getTextKeyWide()));
 
 		/* original bts code
-		if (kBuilding.isDirtyPower() && (GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE") != 0))
+		if (kBuilding.isDirtyPower() && (GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE) != 0))
 		{
-			szTempBuffer.Format(L" (+%d%c)", abs(GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE")), ((GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE") > 0) ? gDLL->getSymbolID(HEALTHY_CHAR): gDLL->getSymbolID(UNHEALTHY_CHAR)));
+			szTempBuffer.Format(L" (+%d%c)", abs(GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE)), ((GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE) > 0) ? gDLL->getSymbolID(HEALTHY_CHAR): gDLL->getSymbolID(UNHEALTHY_CHAR)));
 			szBuffer.append(szTempBuffer);
 		} */
 		// K-Mod. Also include base health change from power.
-		int iPowerHealth = GC.getDefineINT("POWER_HEALTH_CHANGE") + (kBuilding.isDirtyPower() ? GC.getDefineINT("DIRTY_POWER_HEALTH_CHANGE") : 0);
+		int iPowerHealth = GC.getDefineINT(CvGlobals::POWER_HEALTH_CHANGE) + (kBuilding.isDirtyPower() ? GC.getDefineINT(CvGlobals::DIRTY_POWER_HEALTH_CHANGE) : 0);
 		if (iPowerHealth)
 		{
 			szTempBuffer.Format(L" (+%d%c)", abs(iPowerHealth), iPowerHealth > 0 ? gDLL->getSymbolID(HEALTHY_CHAR): gDLL->getSymbolID(UNHEALTHY_CHAR));
@@ -11292,7 +11292,7 @@ void CvGameTextMgr::setBuildingHelpActual(CvWStringBuffer &szBuffer, BuildingTyp
 				if (pCity->isWorldWondersMaxed())
 				{
 					szBuffer.append(NEWLINE);
-					szBuffer.append(gDLL->getText("TXT_KEY_BUILDING_WORLD_WONDERS_PER_CITY", GC.getDefineINT("MAX_WORLD_WONDERS_PER_CITY")));
+					szBuffer.append(gDLL->getText("TXT_KEY_BUILDING_WORLD_WONDERS_PER_CITY", GC.getDefineINT(CvGlobals::MAX_WORLD_WONDERS_PER_CITY)));
 				}
 			}
 			else if (isTeamWonderClass(bct))
@@ -11300,14 +11300,14 @@ void CvGameTextMgr::setBuildingHelpActual(CvWStringBuffer &szBuffer, BuildingTyp
 				if (pCity->isTeamWondersMaxed())
 				{
 					szBuffer.append(NEWLINE);
-					szBuffer.append(gDLL->getText("TXT_KEY_BUILDING_TEAM_WONDERS_PER_CITY", GC.getDefineINT("MAX_TEAM_WONDERS_PER_CITY")));
+					szBuffer.append(gDLL->getText("TXT_KEY_BUILDING_TEAM_WONDERS_PER_CITY", GC.getDefineINT(CvGlobals::MAX_TEAM_WONDERS_PER_CITY)));
 				}
 			}
 			else if (isNationalWonderClass(bct))
 			{
 				if (pCity->isNationalWondersMaxed())
 				{
-					int iMaxNumWonders = (g.isOption(GAMEOPTION_ONE_CITY_CHALLENGE) && GET_PLAYER(pCity->getOwnerINLINE()).isHuman()) ? GC.getDefineINT("MAX_NATIONAL_WONDERS_PER_CITY_FOR_OCC") : GC.getDefineINT("MAX_NATIONAL_WONDERS_PER_CITY");
+					int iMaxNumWonders = (g.isOption(GAMEOPTION_ONE_CITY_CHALLENGE) && GET_PLAYER(pCity->getOwnerINLINE()).isHuman()) ? GC.getDefineINT(CvGlobals::MAX_NATIONAL_WONDERS_PER_CITY_FOR_OCC) : GC.getDefineINT(CvGlobals::MAX_NATIONAL_WONDERS_PER_CITY);
 					szBuffer.append(NEWLINE);
 					szBuffer.append(gDLL->getText("TXT_KEY_BUILDING_NATIONAL_WONDERS_PER_CITY", iMaxNumWonders));
 				}
@@ -11317,7 +11317,7 @@ void CvGameTextMgr::setBuildingHelpActual(CvWStringBuffer &szBuffer, BuildingTyp
 				if (pCity->isBuildingsMaxed())
 				{
 					szBuffer.append(NEWLINE);
-					szBuffer.append(gDLL->getText("TXT_KEY_BUILDING_NUM_PER_CITY", GC.getDefineINT("MAX_BUILDINGS_PER_CITY")));
+					szBuffer.append(gDLL->getText("TXT_KEY_BUILDING_NUM_PER_CITY", GC.getDefineINT(CvGlobals::MAX_BUILDINGS_PER_CITY)));
 				}
 			}
 		}
@@ -12127,7 +12127,7 @@ void CvGameTextMgr::setProjectHelp(CvWStringBuffer &szBuffer, ProjectTypes eProj
 			// <advc.251>
 			int const iBaseCost = kProject.getProductionCost();
 			iCost = iBaseCost;
-			iCost *= GC.getDefineINT("PROJECT_PRODUCTION_PERCENT");
+			iCost *= GC.getDefineINT(CvGlobals::PROJECT_PRODUCTION_PERCENT);
 			iCost /= 100;
 			// To match CvPlayer::getProductionNeeded
 			iCost = ::roundToMultiple(iCost, iBaseCost > 500 ? 50 : 5);
@@ -12523,7 +12523,7 @@ void CvGameTextMgr::setAngerHelp(CvWStringBuffer &szBuffer, CvCity& city)
 /*
 ** K-Mod, 5/jan/11, karadoc
 ** all anger perecent bits were like this:
-iNewAnger += (((iNewAngerPercent * city.getPopulation()) / GC.getPERCENT_ANGER_DIVISOR()) - ((iOldAngerPercent * city.getPopulation()) / GC.getDefineINT("PERCENT_ANGER_DIVISOR")));
+iNewAnger += (((iNewAngerPercent * city.getPopulation()) / GC.getPERCENT_ANGER_DIVISOR()) - ((iOldAngerPercent * city.getPopulation()) / GC.getDefineINT(CvGlobals::PERCENT_ANGER_DIVISOR)));
 ** I've changed it to use GC.getPERCENT_ANGER_DIVISOR() for both parts.
 */
 		// XXX decomp these???
@@ -12891,7 +12891,7 @@ void CvGameTextMgr::setHappyHelp(CvWStringBuffer &szBuffer, CvCity& city)
 
 	if (city.getHappinessTimer() > 0)
 	{
-		iHappy = GC.getDefineINT("TEMP_HAPPY");
+		iHappy = GC.getDefineINT(CvGlobals::TEMP_HAPPY);
 		iTotalHappy += iHappy;
 		szBuffer.append(gDLL->getText("TXT_KEY_HAPPY_TEMP", iHappy, city.getHappinessTimer()));
 		szBuffer.append(NEWLINE);
@@ -15471,7 +15471,7 @@ void CvGameTextMgr::getAttitudeString(CvWStringBuffer& szBuffer, PlayerTypes ePl
 	// Attitude breakdown
 	// <advc.sha>
 	int iTotal = 0;
-	bool bSHowHiddenAttitude = (GC.getDefineINT("SHOW_HIDDEN_ATTITUDE") > 0);
+	bool bSHowHiddenAttitude = (GC.getDefineINT(CvGlobals::SHOW_HIDDEN_ATTITUDE) > 0);
 	// </advc.sha>
 	for (int iPass = 0; iPass < 2; iPass++)
 	{
@@ -16135,7 +16135,7 @@ void CvGameTextMgr::buildFinanceAwaySupplyString(CvWStringBuffer& szBuffer, Play
 	CvWString szTmp; // advc.086
 	szTmp.append(NEWLINE);
 	szTmp.append(gDLL->getText("TXT_KEY_FINANCE_ADVISOR_SUPPLY_COST",
-			//iPaidUnits, GC.getDefineINT("INITIAL_FREE_OUTSIDE_UNITS"),
+			//iPaidUnits, GC.getDefineINT(CvGlobals::INITIAL_FREE_OUTSIDE_UNITS),
 			// K-Mod:
 			player.getNumOutsideUnits(), player.getNumOutsideUnits() - iPaidUnits,
 			iBaseCost, szHandicap.GetCString(), iCost));
@@ -17346,26 +17346,26 @@ void CvGameTextMgr::setVassalRevoltHelp(CvWStringBuffer& szBuffer, TeamTypes eMa
 	int iMasterLand = kMaster.getTotalLand(false);
 	// advc.112: Lower bound added
 	int iVassalLand = std::max(10, kVassal.getTotalLand(false));
-	if (iMasterLand > 0 && GC.getDefineINT("FREE_VASSAL_LAND_PERCENT") >= 0)
+	if (iMasterLand > 0 && GC.getDefineINT(CvGlobals::FREE_VASSAL_LAND_PERCENT) >= 0)
 	{
-		szBuffer.append(gDLL->getText("TXT_KEY_MISC_VASSAL_LAND_STATS", (iVassalLand * 100) / iMasterLand, GC.getDefineINT("FREE_VASSAL_LAND_PERCENT")));
+		szBuffer.append(gDLL->getText("TXT_KEY_MISC_VASSAL_LAND_STATS", (iVassalLand * 100) / iMasterLand, GC.getDefineINT(CvGlobals::FREE_VASSAL_LAND_PERCENT)));
 	}
 
 	int iMasterPop = kMaster.getTotalPopulation(false);
 	int iVassalPop = kVassal.getTotalPopulation(false);
-	if (iMasterPop > 0 && GC.getDefineINT("FREE_VASSAL_POPULATION_PERCENT") >= 0)
+	if (iMasterPop > 0 && GC.getDefineINT(CvGlobals::FREE_VASSAL_POPULATION_PERCENT) >= 0)
 	{
-		szBuffer.append(gDLL->getText("TXT_KEY_MISC_VASSAL_POPULATION_STATS", (iVassalPop * 100) / iMasterPop, GC.getDefineINT("FREE_VASSAL_POPULATION_PERCENT")));
+		szBuffer.append(gDLL->getText("TXT_KEY_MISC_VASSAL_POPULATION_STATS", (iVassalPop * 100) / iMasterPop, GC.getDefineINT(CvGlobals::FREE_VASSAL_POPULATION_PERCENT)));
 	}
 
-	if (GC.getDefineINT("VASSAL_REVOLT_OWN_LOSSES_FACTOR") > 0 && kVassal.getVassalPower() > 0)
+	if (GC.getDefineINT(CvGlobals::VASSAL_REVOLT_OWN_LOSSES_FACTOR) > 0 && kVassal.getVassalPower() > 0)
 	{
-		szBuffer.append(gDLL->getText("TXT_KEY_MISC_VASSAL_AREA_LOSS", (iVassalLand * 100) / kVassal.getVassalPower(), GC.getDefineINT("VASSAL_REVOLT_OWN_LOSSES_FACTOR")));
+		szBuffer.append(gDLL->getText("TXT_KEY_MISC_VASSAL_AREA_LOSS", (iVassalLand * 100) / kVassal.getVassalPower(), GC.getDefineINT(CvGlobals::VASSAL_REVOLT_OWN_LOSSES_FACTOR)));
 	}
 
-	if (GC.getDefineINT("VASSAL_REVOLT_MASTER_LOSSES_FACTOR") > 0 && kVassal.getMasterPower() > 0)
+	if (GC.getDefineINT(CvGlobals::VASSAL_REVOLT_MASTER_LOSSES_FACTOR) > 0 && kVassal.getMasterPower() > 0)
 	{
-		szBuffer.append(gDLL->getText("TXT_KEY_MISC_MASTER_AREA_LOSS", (iMasterLand * 100) / kVassal.getMasterPower(), GC.getDefineINT("VASSAL_REVOLT_MASTER_LOSSES_FACTOR")));
+		szBuffer.append(gDLL->getText("TXT_KEY_MISC_MASTER_AREA_LOSS", (iMasterLand * 100) / kVassal.getMasterPower(), GC.getDefineINT(CvGlobals::VASSAL_REVOLT_MASTER_LOSSES_FACTOR)));
 	}
 }
 
@@ -17510,7 +17510,7 @@ void CvGameTextMgr::parseGreatPeopleHelp(CvWStringBuffer &szBuffer,
 
 	if (kOwner.isGoldenAge())
 	{
-		int iGoldenAgeMod = GC.getDefineINT("GOLDEN_AGE_GREAT_PEOPLE_MODIFIER");
+		int iGoldenAgeMod = GC.getDefineINT(CvGlobals::GOLDEN_AGE_GREAT_PEOPLE_MODIFIER);
 
 		if (0 != iGoldenAgeMod)
 		{
@@ -17783,25 +17783,25 @@ void CvGameTextMgr::setScoreHelp(CvWStringBuffer &szString, PlayerTypes ePlayer)
 		int iPopScore = 0;
 		if (iMaxPop > 0)
 		{
-			iPopScore = (GC.getDefineINT("SCORE_POPULATION_FACTOR") * iPop) / iMaxPop;
+			iPopScore = (GC.getDefineINT(CvGlobals::SCORE_POPULATION_FACTOR) * iPop) / iMaxPop;
 		}
 		int iLand = player.getLandScore();
 		int iMaxLand = GC.getGameINLINE().getMaxLand();
 		int iLandScore = 0;
 		if (iMaxLand > 0)
 		{
-			iLandScore = (GC.getDefineINT("SCORE_LAND_FACTOR") * iLand) / iMaxLand;
+			iLandScore = (GC.getDefineINT(CvGlobals::SCORE_LAND_FACTOR) * iLand) / iMaxLand;
 		}
 		int iTech = player.getTechScore();
 		int iMaxTech = GC.getGameINLINE().getMaxTech();
 		int iTechScore = 0;
 		if( iMaxTech > 0 ) // BETTER_BTS_AI_MOD, Bugfix, 02/24/10, jdog5000
-			iTechScore = (GC.getDefineINT("SCORE_TECH_FACTOR") * iTech) / iMaxTech;
+			iTechScore = (GC.getDefineINT(CvGlobals::SCORE_TECH_FACTOR) * iTech) / iMaxTech;
 		int iWonders = player.getWondersScore();
 		int iMaxWonders = GC.getGameINLINE().getMaxWonders();
 		int iWondersScore = 0;
 		if( iMaxWonders > 0 ) // BETTER_BTS_AI_MOD, Bugfix, 02/24/10, jdog5000
-			iWondersScore = (GC.getDefineINT("SCORE_WONDER_FACTOR") * iWonders) / iMaxWonders;
+			iWondersScore = (GC.getDefineINT(CvGlobals::SCORE_WONDER_FACTOR) * iWonders) / iMaxWonders;
 		int iTotalScore = iPopScore + iLandScore + iTechScore + iWondersScore;
 		int iVictoryScore = player.calculateScore(true, true);
 		// <advc.250c> Show leader name while in Advanced Start
@@ -17989,12 +17989,12 @@ void CvGameTextMgr::setEventHelp(CvWStringBuffer& szBuffer, EventTypes eEvent, i
 		if (kEvent.isCityEffect() || kEvent.isOtherPlayerCityEffect())
 		{
 			szBuffer.append(NEWLINE);
-			szBuffer.append(gDLL->getText("TXT_KEY_EVENT_TEMP_HAPPY_CITY", GC.getDefineINT("TEMP_HAPPY"), kEvent.getHappyTurns(), szCity.GetCString()));
+			szBuffer.append(gDLL->getText("TXT_KEY_EVENT_TEMP_HAPPY_CITY", GC.getDefineINT(CvGlobals::TEMP_HAPPY), kEvent.getHappyTurns(), szCity.GetCString()));
 		}
 		else
 		{
 			szBuffer.append(NEWLINE);
-			szBuffer.append(gDLL->getText("TXT_KEY_EVENT_TEMP_HAPPY", GC.getDefineINT("TEMP_HAPPY"), kEvent.getHappyTurns()));
+			szBuffer.append(gDLL->getText("TXT_KEY_EVENT_TEMP_HAPPY", GC.getDefineINT(CvGlobals::TEMP_HAPPY), kEvent.getHappyTurns()));
 		}
 	}
 
@@ -18730,7 +18730,7 @@ void CvGameTextMgr::setTradeRouteHelp(CvWStringBuffer &szBuffer, int iRoute, CvC
 
 			if (pCity->isConnectedToCapital())
 			{
-				iNewMod = GC.getDefineINT("CAPITAL_TRADE_MODIFIER");
+				iNewMod = GC.getDefineINT(CvGlobals::CAPITAL_TRADE_MODIFIER);
 				if (0 != iNewMod)
 				{
 					szBuffer.append(NEWLINE);
@@ -18743,7 +18743,7 @@ void CvGameTextMgr::setTradeRouteHelp(CvWStringBuffer &szBuffer, int iRoute, CvC
 			{
 				if (pCity->area() != pOtherCity->area())
 				{
-					iNewMod = GC.getDefineINT("OVERSEAS_TRADE_MODIFIER");
+					iNewMod = GC.getDefineINT(CvGlobals::OVERSEAS_TRADE_MODIFIER);
 					if (0 != iNewMod)
 					{
 						szBuffer.append(NEWLINE);
@@ -19072,7 +19072,7 @@ void CvGameTextMgr::setEspionageCostHelp(CvWStringBuffer &szBuffer, EspionageMis
 		if (pCity != NULL && kMission.isTargetsCity())
 		{
 			// City Population
-			iTempModifier = (GC.getDefineINT("ESPIONAGE_CITY_POP_EACH_MOD") * (pCity->getPopulation() - 1));
+			iTempModifier = (GC.getDefineINT(CvGlobals::ESPIONAGE_CITY_POP_EACH_MOD) * (pCity->getPopulation() - 1));
 			if (0 != iTempModifier)
 			{
 				szBuffer.append(NEWLINE);
@@ -19084,7 +19084,7 @@ void CvGameTextMgr::setEspionageCostHelp(CvWStringBuffer &szBuffer, EspionageMis
 			// Trade Route
 			if (pCity->isTradeRoute(kPlayer.getID()))
 			{
-				iTempModifier = GC.getDefineINT("ESPIONAGE_CITY_TRADE_ROUTE_MOD");
+				iTempModifier = GC.getDefineINT(CvGlobals::ESPIONAGE_CITY_TRADE_ROUTE_MOD);
 				if (0 != iTempModifier)
 				{
 					szBuffer.append(NEWLINE);
@@ -19103,12 +19103,12 @@ void CvGameTextMgr::setEspionageCostHelp(CvWStringBuffer &szBuffer, EspionageMis
 				{
 					if (GET_PLAYER(eTargetPlayer).getStateReligion() != eReligion)
 					{
-						iTempModifier += GC.getDefineINT("ESPIONAGE_CITY_RELIGION_STATE_MOD");
+						iTempModifier += GC.getDefineINT(CvGlobals::ESPIONAGE_CITY_RELIGION_STATE_MOD);
 					}
 
 					if (kPlayer.hasHolyCity(eReligion))
 					{
-						iTempModifier += GC.getDefineINT("ESPIONAGE_CITY_HOLY_CITY_MOD");
+						iTempModifier += GC.getDefineINT(CvGlobals::ESPIONAGE_CITY_HOLY_CITY_MOD);
 					}
 				}
 
@@ -19123,7 +19123,7 @@ void CvGameTextMgr::setEspionageCostHelp(CvWStringBuffer &szBuffer, EspionageMis
 
 			// City's culture affects cost
 			/* original bts code
-			iTempModifier = - (pCity->getCultureTimes100(kPlayer.getID()) * GC.getDefineINT("ESPIONAGE_CULTURE_MULTIPLIER_MOD")) / std::max(1, pCity->getCultureTimes100(eTargetPlayer) + pCity->getCultureTimes100(kPlayer.getID()));
+			iTempModifier = - (pCity->getCultureTimes100(kPlayer.getID()) * GC.getDefineINT(CvGlobals::ESPIONAGE_CULTURE_MULTIPLIER_MOD)) / std::max(1, pCity->getCultureTimes100(eTargetPlayer) + pCity->getCultureTimes100(kPlayer.getID()));
 			if (0 != iTempModifier)
 			{
 				szBuffer.append(NEWLINE);
@@ -19147,7 +19147,7 @@ void CvGameTextMgr::setEspionageCostHelp(CvWStringBuffer &szBuffer, EspionageMis
 			// K-Mod. Culture Mod. (Based on plot culture rather than city culture.)
 			if (kMission.isSelectPlot() || kMission.isTargetsCity())
 			{
-				iTempModifier = - (pPlot->getCulture(kPlayer.getID()) * GC.getDefineINT("ESPIONAGE_CULTURE_MULTIPLIER_MOD")) / std::max(1, pPlot->getCulture(eTargetPlayer) + pPlot->getCulture(kPlayer.getID()));
+				iTempModifier = - (pPlot->getCulture(kPlayer.getID()) * GC.getDefineINT(CvGlobals::ESPIONAGE_CULTURE_MULTIPLIER_MOD)) / std::max(1, pPlot->getCulture(eTargetPlayer) + pPlot->getCulture(kPlayer.getID()));
 				if (0 != iTempModifier)
 				{
 					szBuffer.append(NEWLINE);
@@ -19178,7 +19178,7 @@ void CvGameTextMgr::setEspionageCostHelp(CvWStringBuffer &szBuffer, EspionageMis
 				}
 			}
 
-			iTempModifier = (iDistance + GC.getMapINLINE().maxPlotDistance()) * GC.getDefineINT("ESPIONAGE_DISTANCE_MULTIPLIER_MOD") / GC.getMapINLINE().maxPlotDistance() - 100;
+			iTempModifier = (iDistance + GC.getMapINLINE().maxPlotDistance()) * GC.getDefineINT(CvGlobals::ESPIONAGE_DISTANCE_MULTIPLIER_MOD) / GC.getMapINLINE().maxPlotDistance() - 100;
 			if (0 != iTempModifier)
 			{
 				szBuffer.append(NEWLINE);
@@ -19191,7 +19191,7 @@ void CvGameTextMgr::setEspionageCostHelp(CvWStringBuffer &szBuffer, EspionageMis
 		// Spy presence mission cost alteration
 		if (NULL != pSpyUnit)
 		{
-			iTempModifier = -(pSpyUnit->getFortifyTurns() * GC.getDefineINT("ESPIONAGE_EACH_TURN_UNIT_COST_DECREASE"));
+			iTempModifier = -(pSpyUnit->getFortifyTurns() * GC.getDefineINT(CvGlobals::ESPIONAGE_EACH_TURN_UNIT_COST_DECREASE));
 			if (0 != iTempModifier)
 			{
 				szBuffer.append(NEWLINE);
@@ -20214,7 +20214,7 @@ void CvGameTextMgr::getUnitDataForAS(std::vector<CvWBData>& mapUnitList)
 				szBuffer.clear();
 				setUnitHelp(szBuffer, eUnit);
 
-				int iMaxUnitsPerCity = GC.getDefineINT("ADVANCED_START_MAX_UNITS_PER_CITY");
+				int iMaxUnitsPerCity = GC.getDefineINT(CvGlobals::ADVANCED_START_MAX_UNITS_PER_CITY);
 				if (iMaxUnitsPerCity >= 0 && GC.getUnitInfo(eUnit).isMilitarySupport())
 				{
 					szBuffer.append(NEWLINE);
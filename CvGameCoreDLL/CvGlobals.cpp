@@ -35,17 +35,36 @@ void deleteInfoArray(std::vector<T*>& array)
 	array.clear();
 }
 
+/*  advc.003ai: Increment this whenever the header written by writeInfoArray or
+	any read/write function of the CvInfo classes changes. (The compile time
+	of CvInfos.cpp is also part of the signature, but a cache may outlive a
+	rebuild that the user doesn't notice.) */
+static int const iINFO_CACHE_VERSION = 1;
+
 template <class T>
 bool readInfoArray(FDataStreamBase* pStream, std::vector<T*>& array, const char* szClassName)
 {
 #if SERIALIZE_CVINFOS
-	addToInfosVectors(&array);
+	GC.addToInfosVectors(&array); // advc.003ai: GC. added
 
 	int iSize;
+	// <advc.003ai> Discard caches written by a different version or DLL
+	pStream->Read(&iSize);
+	if (iSize != iINFO_CACHE_VERSION)
+		return false; // </advc.003ai>
 	pStream->Read(&iSize);
 	FAssertMsg(iSize==sizeof(T), CvString::format("class size doesn't match cache size - check info read/write functions:%s", szClassName).c_str());
 	if (iSize!=sizeof(T))
 		return false;
+	/*  <advc.003ai> The EXE only checks the time stamp of T's own XML file.
+		Changes to the infos that T refers to also invalidate the cache. */
+	unsigned int uiSignature;
+	pStream->Read(&uiSignature);
+	if (uiSignature != GC.getInfoCacheSignature(&array))
+	{
+		gDLL->logMsg("xml.log", CvString::format("Discarded %s cache: dependencies have changed", szClassName).c_str());
+		return false;
+	} // </advc.003ai>
 	pStream->Read(&iSize);
 
 	deleteInfoArray(array);
@@ -59,7 +78,7 @@ bool readInfoArray(FDataStreamBase* pStream, std::vector<T*>& array, const char*
 	for (std::vector<T*>::iterator it = array.begin(); it != array.end(); ++it)
 	{
 		(*it)->read(pStream);
-		setInfoTypeFromString((*it)->getType(), iIndex);
+		GC.setInfoTypeFromString((*it)->getType(), iIndex); // advc.003ai: GC. added
 		++iIndex;
 	}
 
@@ -74,8 +93,10 @@ template <class T>
 bool writeInfoArray(FDataStreamBase* pStream,  std::vector<T*>& array)
 {
 #if SERIALIZE_CVINFOS
+	pStream->Write(iINFO_CACHE_VERSION); // advc.003ai
 	int iSize = sizeof(T);
 	pStream->Write(iSize);
+	pStream->Write(GC.getInfoCacheSignature(&array)); // advc.003ai
 	pStream->Write(array.size());
 	for (std::vector<T*>::iterator it = array.begin(); it != array.end(); ++it)
 	{
@@ -314,6 +335,9 @@ m_paMainMenus(NULL)
 // BETTER_BTS_AI_MOD: END
 {
 	// (constructor body)
+	// <advc.003ah>
+	for (int i = 0; i < NUM_GLOBAL_DEFINES; i++)
+		m_aiGlobalDefines[i] = 0; // </advc.003ah>
 }
 
 CvGlobals::~CvGlobals()
@@ -2894,6 +2918,19 @@ int CvGlobals::getDefineINT( const char * szName, const int iDefault ) const
 } // BETTER_BTS_AI_MOD: END
 
 
+// advc.003ah:
+void CvGlobals::cacheIntGlobalDefines()
+{
+#define CACHE_INT_GLOBAL_DEFINE(VAR) m_aiGlobalDefines[VAR] = getDefineINT(#VAR);
+	DO_FOR_EACH_INT_GLOBAL_DEFINE_1(CACHE_INT_GLOBAL_DEFINE)
+	DO_FOR_EACH_INT_GLOBAL_DEFINE_2(CACHE_INT_GLOBAL_DEFINE)
+	DO_FOR_EACH_INT_GLOBAL_DEFINE_3(CACHE_INT_GLOBAL_DEFINE)
+	DO_FOR_EACH_INT_GLOBAL_DEFINE_4(CACHE_INT_GLOBAL_DEFINE)
+	DO_FOR_EACH_INT_GLOBAL_DEFINE_5(CACHE_INT_GLOBAL_DEFINE)
+#undef CACHE_INT_GLOBAL_DEFINE
+}
+
+
 int CvGlobals::getDefineINT( const char * szName ) const
 {
 	int iReturn = 0;
@@ -2928,7 +2965,10 @@ void CvGlobals::setDefineINT( const char * szName, int iValue,
 {
 	getDefinesVarSystem()->SetValue( szName, iValue );
 	if(bUpdateCache) // advc.003b
+	{
 		cacheGlobals();
+		cacheIntGlobalDefines(); // advc.003ah
+	}
 }
 
 void CvGlobals::setDefineFLOAT( const char * szName, float fValue,
@@ -2936,7 +2976,10 @@ void CvGlobals::setDefineFLOAT( const char * szName, float fValue,
 {
 	getDefinesVarSystem()->SetValue( szName, fValue );
 	if(bUpdateCache) // advc.003b
+	{
 		cacheGlobals();
+		cacheIntGlobalDefines(); // advc.003ah
+	}
 }
 
 void CvGlobals::setDefineSTRING( const char * szName, const char * szValue,
@@ -2944,7 +2987,10 @@ void CvGlobals::setDefineSTRING( const char * szName, const char * szValue,
 {
 	getDefinesVarSystem()->SetValue( szName, szValue );
 	if(bUpdateCache) // advc.003b
+	{
 		cacheGlobals();
+		cacheIntGlobalDefines(); // advc.003ah
+	}
 }
 
 int CvGlobals::getMOVE_DENOMINATOR()
@@ -3815,9 +3861,49 @@ void CvGlobals::infoTypeFromStringReset()
 void CvGlobals::addToInfosVectors(void *infoVector)
 {
 	std::vector<CvInfoBase *> *infoBaseVector = (std::vector<CvInfoBase *> *) infoVector;
+	/*  advc.003ai: readInfoArray registers the vectors too; don't let them
+		be reset twice. */
+	if (std::find(m_aInfoVectors.begin(), m_aInfoVectors.end(), infoBaseVector) != m_aInfoVectors.end())
+		return;
 	m_aInfoVectors.push_back(infoBaseVector);
 }
 
+/*  advc.003ai: Hash of the type strings of all infos loaded so far (except for
+	those in pSkip), the defines that determine the size of info arrays and
+	the time at which CvInfos.cpp was compiled. The XML cache of a class is only valid if this is the
+	same as when the cache was written. */
+unsigned int CvGlobals::getInfoCacheSignature(void const* pSkip) const
+{
+	unsigned int r = 0;
+	char const* szBuild = CvInfoBase::getStreamBuildStamp();
+	for (char const* pc = szBuild; *pc != '\0'; pc++)
+		r = r * 31 + *pc;
+	for (size_t i = 0; i < m_aInfoVectors.size(); i++)
+	{
+		std::vector<CvInfoBase*> const& kInfos = *m_aInfoVectors[i];
+		if (&kInfos == pSkip)
+			continue;
+		r = r * 31 + kInfos.size();
+		for (size_t j = 0; j < kInfos.size(); j++)
+		{
+			char const* szType = kInfos[j]->getType();
+			if (szType == NULL)
+				continue;
+			for (char const* pc = szType; *pc != '\0'; pc++)
+				r = r * 31 + *pc;
+		}
+	}
+	int const aiSizes[] = {
+		m_iNUM_UNIT_PREREQ_OR_BONUSES, m_iNUM_BUILDING_PREREQ_OR_BONUSES,
+		m_iNUM_UNIT_AND_TECH_PREREQS, m_iNUM_AND_TECH_PREREQS,
+		m_iNUM_OR_TECH_PREREQS, m_iNUM_ROUTE_PREREQ_OR_BONUSES,
+		m_iNUM_BUILDING_AND_TECH_PREREQS, m_iNUM_CORPORATION_PREREQ_BONUSES,
+	};
+	for (int i = 0; i < (int)(sizeof(aiSizes) / sizeof(int)); i++)
+		r = r * 31 + aiSizes[i];
+	return r;
+}
+
 void CvGlobals::infosReset()
 {
 	for(int i=0;i<(int)m_aInfoVectors.size();i++)
@@ -135,6 +135,360 @@ class CvUnitArtStyleTypeInfo;
 class CvVoteSourceInfo;
 class CvMainMenuInfo;
 
+/*  <advc.003ah> Integer defines that CvGlobals caches in an array indexed by
+	the CvGlobals::GlobalDefines enum. Split into several lists b/c of
+	compiler limits on the size of a macro. */
+#define DO_FOR_EACH_INT_GLOBAL_DEFINE_1(DO) \
+	DO(ADVANCED_START_ALLOW_UNITS_OUTSIDE_CITIES) \
+	DO(ADVANCED_START_CITY_COST) \
+	DO(ADVANCED_START_CITY_COST_INCREASE) \
+	DO(ADVANCED_START_CITY_PLACEMENT_MAX_RANGE) \
+	DO(ADVANCED_START_CULTURE_COST) \
+	DO(ADVANCED_START_MAX_UNITS_PER_CITY) \
+	DO(ADVANCED_START_POPULATION_COST) \
+	DO(ADVANCED_START_POPULATION_COST_INCREASE) \
+	DO(ADVANCED_START_SIGHT_RANGE) \
+	DO(ADVANCED_START_VISIBILITY_COST) \
+	DO(ADVANCED_START_VISIBILITY_COST_INCREASE) \
+	DO(ADVANCED_START_WORKER_BUILD_MODIFIER) \
+	DO(AIR_COMBAT_DAMAGE) \
+	DO(AI_CAN_DISBAND_UNITS) \
+	DO(AI_EVACUATION_THRESH) \
+	DO(AI_OFFER_EXTRA_GOLD_PERCENT) \
+	DO(AI_SHOULDNT_MANAGE_PLOT_ASSIGNMENT) \
+	DO(ANIMAL_MAX_XP_VALUE) \
+	DO(ANNOUNCE_ESPIONAGE_REVOLUTION) \
+	DO(ANNOUNCE_STATE_RELIGION_SPREAD) \
+	DO(AT_WAR_ATTITUDE_CHANGE) \
+	DO(AT_WAR_CULTURE_ANGER_MODIFIER) \
+	DO(BARBARIAN_CIVILIZATION) \
+	DO(BARBARIAN_FREE_TECH_PERCENT) \
+	DO(BARBARIAN_LEADER) \
+	DO(BARBARIAN_MAX_XP_VALUE) \
+	DO(BARBS_REVOLT) \
+	DO(BARB_ACTIVITY_ADJUSTMENT) \
+	DO(BARB_PEAK_PERCENT) \
+	DO(BARREN_TERRAIN) \
+	DO(BASE_CITY_GROWTH_THRESHOLD) \
+	DO(BASE_CIVIC_ANARCHY_LENGTH) \
+	DO(BASE_FEATURE_PRODUCTION_PERCENT) \
+	DO(BASE_GOLDEN_AGE_UNITS) \
+	DO(BASE_OCCUPATION_TURNS) \
+	DO(BASE_RELIGION_ANARCHY_LENGTH) \
+	DO(BASE_RESEARCH_RATE) \
+	DO(BASE_REVOLT_FREE_UNITS) \
+	DO(BASE_REVOLT_OCCUPATION_TURNS) \
+	DO(BASE_SPY_DESTROY_COST) \
+	DO(BASE_SPY_SABOTAGE_COST) \
+	DO(BASE_SPY_STEAL_PLANS_COST) \
+	DO(BASE_UNIT_UPGRADE_COST) \
+	DO(BASE_WAR_WEARINESS_MULTIPLIER) \
+	DO(BBAI_MINIMUM_FOUND_VALUE) \
+	DO(BBAI_TURTLE_ENEMY_POWER_RATIO) \
+	DO(BBAI_VICTORY_STRATEGY_CONQUEST) \
+	DO(BBAI_VICTORY_STRATEGY_CULTURE) \
+	DO(BBAI_VICTORY_STRATEGY_DIPLOMACY) \
+	DO(BBAI_VICTORY_STRATEGY_DOMINATION) \
+	DO(BBAI_VICTORY_STRATEGY_SPACE) \
+	DO(BUILDING_PRODUCTION_DECAY_PERCENT) \
+	DO(BUILDING_PRODUCTION_DECAY_TIME) \
+	DO(BUILDING_PRODUCTION_PERCENT) \
+	DO(CAPITAL_BUILDINGCLASS) \
+	DO(CAPITAL_TRADE_MODIFIER) \
+	DO(CAPITULATED_TO_MASTER_CULTURE_PERCENT) \
+	DO(CIRCUMNAVIGATE_FREE_MOVES) \
+	DO(CITY_AIR_UNIT_CAPACITY) \
+	DO(CITY_BARBARIAN_DEFENSE_MODIFIER) \
+	DO(CITY_DEFENSE_DAMAGE_HEAL_RATE) \
+	DO(CITY_GROWTH_MULTIPLIER) \
+	DO(CITY_HEAL_RATE) \
+	DO(CITY_SCREEN_FOG_ENABLED) \
+	DO(CITY_TRADE_CULTURE_THRESH) \
+	DO(CLOSED_BORDERS_CULTURE_ANGER_MODIFIER) \
+	DO(COLD_FEATURE) \
+	DO(COLD_TERRAIN) \
+	DO(COLLATERAL_COMBAT_DAMAGE) \
+	DO(COLONY_NUM_FREE_DEFENDERS)
+
+#define DO_FOR_EACH_INT_GLOBAL_DEFINE_2(DO) \
+	DO(COMBAT_DAMAGE) \
+	DO(COMBAT_DIE_SIDES) \
+	DO(COMBAT_EXPERIENCE_IN_BORDERS_PERCENT) \
+	DO(COMMERCE_PERCENT_CHANGE_INCREMENTS) \
+	DO(CONNECTION_TO_CAPITAL_ON_TRADE_LAYER) \
+	DO(CONSCRIPT_ANGER_DIVISOR) \
+	DO(CONSCRIPT_MIN_CITY_POPULATION) \
+	DO(CONSCRIPT_MIN_CULTURE_PERCENT) \
+	DO(CONSCRIPT_POPULATION_PER_COST) \
+	DO(CONSCRIPT_POP_ANGER) \
+	DO(CORPORATION_FOREIGN_SPREAD_COST_PERCENT) \
+	DO(CULTURE_PERCENT_ANGER) \
+	DO(DEEP_WATER_TERRAIN) \
+	DO(DEFAULT_SPECIALIST) \
+	DO(DEFY_RESOLUTION_ANGER_DIVISOR) \
+	DO(DEFY_RESOLUTION_POP_ANGER) \
+	DO(DEMAND_BETTER_PROTECTION) \
+	DO(DIFFERENT_TEAM_FEATURE_PRODUCTION_PERCENT) \
+	DO(DIPLOMACY_VALUE_REMAINDER) \
+	DO(DIPLO_VOTE_SECRETARY_GENERAL_INTERVAL) \
+	DO(DIRTY_POWER_HEALTH_CHANGE) \
+	DO(DISENGAGE_LENGTH) \
+	DO(DRY_TERRAIN) \
+	DO(ENABLE_130L) \
+	DO(ENABLE_162) \
+	DO(ENABLE_DEBUG_TOOLS_MULTIPLAYER) \
+	DO(ENEMY_HEAL_RATE) \
+	DO(ESPIONAGE_CITY_HOLY_CITY_MOD) \
+	DO(ESPIONAGE_CITY_POP_EACH_MOD) \
+	DO(ESPIONAGE_CITY_RELIGION_STATE_MOD) \
+	DO(ESPIONAGE_CITY_TRADE_ROUTE_MOD) \
+	DO(ESPIONAGE_CULTURE_MULTIPLIER_MOD) \
+	DO(ESPIONAGE_DISTANCE_MULTIPLIER_MOD) \
+	DO(ESPIONAGE_EACH_TURN_UNIT_COST_DECREASE) \
+	DO(ESPIONAGE_INTERCEPT_COUNTERESPIONAGE_MISSION) \
+	DO(ESPIONAGE_INTERCEPT_COUNTERSPY) \
+	DO(ESPIONAGE_INTERCEPT_RECENT_MISSION) \
+	DO(ESPIONAGE_INTERCEPT_SPENDING_MAX) \
+	DO(ESPIONAGE_SPENDING_MULTIPLIER) \
+	DO(ESPIONAGE_SPY_INTERCEPT_MOD) \
+	DO(ESPIONAGE_SPY_MISSION_ESCAPE_MOD) \
+	DO(ESPIONAGE_SPY_NO_INTRUDE_INTERCEPT_MOD) \
+	DO(ESPIONAGE_SPY_REVEAL_IDENTITY_PERCENT) \
+	DO(EVENT_MESSAGE_TIME_LONG) \
+	DO(EVENT_PROBABILITY_ROLL_SIDES) \
+	DO(EXPERIENCE_FROM_WITHDRAWL) \
+	DO(FEATURE_PRODUCTION_PERCENT_MULTIPLIER) \
+	DO(FIRST_EVENT_DELAY_TURNS) \
+	DO(FLOODPLAIN_AFTER_RAZE) \
+	DO(FORCED_WAR_WAR_WEARINESS_MODIFIER) \
+	DO(FORCE_UNOWNED_CITY_TIMER) \
+	DO(FOREIGN_GROUPS_ON_TRADE_LAYER) \
+	DO(FOREIGN_TRADE_FULL_CREDIT_PEACE_TURNS) \
+	DO(FOREIGN_TRADE_MODIFIER) \
+	DO(FOUND_CORPORATION_CITY_RAND) \
+	DO(FOUND_RELIGION_CITY_RAND) \
+	DO(FREE_CITY_ADJACENT_CULTURE) \
+	DO(FREE_CITY_CULTURE) \
+	DO(FREE_VASSAL_LAND_PERCENT) \
+	DO(FREE_VASSAL_POPULATION_PERCENT) \
+	DO(FRESH_WATER_HEALTH_CHANGE) \
+	DO(FRIENDLY_HEAL_RATE) \
+	DO(FROZEN_TERRAIN) \
+	DO(GLOBAL_WARMING_BASE_ANGER_PERCENT) \
+	DO(GLOBAL_WARMING_BONUS_WEIGHT) \
+	DO(GLOBAL_WARMING_BUILDING_WEIGHT) \
+	DO(GLOBAL_WARMING_FOREST) \
+	DO(GLOBAL_WARMING_INDEX_PER_CHANCE) \
+	DO(GLOBAL_WARMING_NUKE_WEIGHT) \
+	DO(GLOBAL_WARMING_POPULATION_WEIGHT)
+
+#define DO_FOR_EACH_INT_GLOBAL_DEFINE_3(DO) \
+	DO(GLOBAL_WARMING_POWER_WEIGHT) \
+	DO(GLOBAL_WARMING_PROB) \
+	DO(GLOBAL_WARMING_RESISTANCE) \
+	DO(GLOBAL_WARMING_TERRAIN) \
+	DO(GLOBAL_WARMING_UNHEALTH_WEIGHT) \
+	DO(GOLDEN_AGE_GREAT_PEOPLE_MODIFIER) \
+	DO(GOLDEN_AGE_LENGTH) \
+	DO(GOLDEN_AGE_UNITS_MULTIPLIER) \
+	DO(GOODY_BUFF_PEAK_MULTIPLIER) \
+	DO(GOODY_BUFF_PEAK_TURN) \
+	DO(GOODY_BUFF_START_TURN) \
+	DO(GREAT_GENERALS_THRESHOLD) \
+	DO(GREAT_GENERALS_THRESHOLD_INCREASE) \
+	DO(GREAT_GENERALS_THRESHOLD_INCREASE_TEAM) \
+	DO(GREAT_PEOPLE_THRESHOLD) \
+	DO(GREAT_PEOPLE_THRESHOLD_INCREASE) \
+	DO(GREAT_PEOPLE_THRESHOLD_INCREASE_TEAM) \
+	DO(GREAT_WORKS_CULTURE_TURNS) \
+	DO(GROUP_ATTACK_BEST_ODDS_HELP) \
+	DO(HOLY_CITY_INFLUENCE) \
+	DO(HURRY_ANGER_DIVISOR) \
+	DO(HURRY_POP_ANGER) \
+	DO(IGNORE_PLOT_GROUP_FOR_TRADE_ROUTES) \
+	DO(INCREASE_START_TURN) \
+	DO(INITIAL_AI_CITY_PRODUCTION) \
+	DO(INITIAL_BASE_FREE_MILITARY_UNITS) \
+	DO(INITIAL_BASE_FREE_UNITS) \
+	DO(INITIAL_CITY_POPULATION) \
+	DO(INITIAL_CITY_ROUTE_TYPE) \
+	DO(INITIAL_FREE_MILITARY_UNITS_POPULATION_PERCENT) \
+	DO(INITIAL_FREE_OUTSIDE_UNITS) \
+	DO(INITIAL_FREE_UNITS_POPULATION_PERCENT) \
+	DO(INITIAL_GOLD_PER_UNIT) \
+	DO(INITIAL_NON_STATE_RELIGION_HAPPINESS) \
+	DO(INITIAL_OUTSIDE_UNIT_GOLD_PERCENT) \
+	DO(INITIAL_STATE_RELIGION_HAPPINESS) \
+	DO(INITIAL_TRADE_ROUTES) \
+	DO(INTERCEPTION_MAX_ROUNDS) \
+	DO(LAND_IMPROVEMENT) \
+	DO(LAND_TERRAIN) \
+	DO(LAND_UNITS_CAN_ATTACK_WATER_CITIES) \
+	DO(MAXED_BUILDING_GOLD_PERCENT) \
+	DO(MAXED_PROJECT_GOLD_PERCENT) \
+	DO(MAXED_UNIT_GOLD_PERCENT) \
+	DO(MAX_ANARCHY_TURNS) \
+	DO(MAX_BUILDINGS_PER_CITY) \
+	DO(MAX_DISTANCE_CITY_MAINTENANCE) \
+	DO(MAX_EVASION_PROBABILITY) \
+	DO(MAX_EXPERIENCE_AFTER_UPGRADE) \
+	DO(MAX_EXPERIENCE_PER_COMBAT) \
+	DO(MAX_FORTIFY_TURNS) \
+	DO(MAX_INTERCEPTION_DAMAGE) \
+	DO(MAX_INTERCEPTION_PROBABILITY) \
+	DO(MAX_NATIONAL_WONDERS_PER_CITY) \
+	DO(MAX_NATIONAL_WONDERS_PER_CITY_FOR_OCC) \
+	DO(MAX_TEAM_WONDERS_PER_CITY) \
+	DO(MAX_TRADE_ROUTES) \
+	DO(MAX_WITHDRAWAL_PROBABILITY) \
+	DO(MAX_WORLD_WONDERS_PER_CITY) \
+	DO(MAX_YIELD_STACK) \
+	DO(MESSAGE_LIMIT_WITHOUT_MPU) \
+	DO(MIN_ANIMAL_STARTING_DISTANCE) \
+	DO(MIN_BARBARIAN_CITY_STARTING_DISTANCE) \
+	DO(MIN_BARBARIAN_STARTING_DISTANCE) \
+	DO(MIN_CITY_ATTACK_MODIFIER_FOR_SIEGE_TOWER) \
+	DO(MIN_CIV_STARTING_DISTANCE) \
+	DO(MIN_CONVERSION_TURNS) \
+	DO(MIN_EXPERIENCE_PER_COMBAT) \
+	DO(MIN_INTERCEPTION_DAMAGE) \
+	DO(MIN_REVOLUTION_TURNS)
+
+#define DO_FOR_EACH_INT_GLOBAL_DEFINE_4(DO) \
+	DO(MIN_TIMER_UNIT_DOUBLE_MOVES) \
+	DO(MULTIPLAYER_WAR_WEARINESS_MODIFIER) \
+	DO(NEUTRAL_HEAL_RATE) \
+	DO(NEW_CITY_BUILDING_VALUE_MODIFIER) \
+	DO(NORMALIZE_STARTPLOTS_AGGRESSIVELY) \
+	DO(NO_ESPIONAGE_CULTURE_LEVEL_MODIFIER) \
+	DO(NO_MILITARY_PERCENT_ANGER) \
+	DO(NUKE_BUILDING_DESTRUCTION_PROB) \
+	DO(NUKE_FALLOUT_PROB) \
+	DO(NUKE_FEATURE) \
+	DO(NUKE_NON_COMBAT_DEATH_THRESHOLD) \
+	DO(NUKE_POPULATION_DEATH_BASE) \
+	DO(NUKE_POPULATION_DEATH_RAND_1) \
+	DO(NUKE_POPULATION_DEATH_RAND_2) \
+	DO(NUKE_UNIT_DAMAGE_BASE) \
+	DO(NUKE_UNIT_DAMAGE_RAND_1) \
+	DO(NUKE_UNIT_DAMAGE_RAND_2) \
+	DO(NUM_CORPORATION_PREREQ_BONUSES) \
+	DO(NUM_DO_GOODY_ATTEMPTS) \
+	DO(OCCUPATION_COUNTDOWN_EXPONENT) \
+	DO(OCCUPATION_CULTURE_PERCENT_THRESHOLD) \
+	DO(OCCUPATION_TURNS_POPULATION_PERCENT) \
+	DO(OUR_POPULATION_TRADE_MODIFIER) \
+	DO(OUR_POPULATION_TRADE_MODIFIER_OFFSET) \
+	DO(OVERSEAS_TRADE_MODIFIER) \
+	DO(OWNERSHIP_SCORE_DURATION_THRESHOLD) \
+	DO(OWN_TEAM_STARTING_MODIFIER) \
+	DO(PASSABLE_AREAS) \
+	DO(PERCENT_ANGER_DIVISOR) \
+	DO(PER_ERA_BATTLE_ANIMATION_ROUNDS) \
+	DO(PLOT_VISIBILITY_RANGE) \
+	DO(POWER_HEALTH_CHANGE) \
+	DO(PROJECT_PRODUCTION_PERCENT) \
+	DO(RANGED_ATTACKS_USE_MOVES) \
+	DO(RANGE_COMBAT_DAMAGE) \
+	DO(RAZING_CULTURAL_PERCENT_THRESHOLD) \
+	DO(RECON_VISIBILITY_RANGE) \
+	DO(RELIGION_INFLUENCE_BUILDING_WEIGHT) \
+	DO(RELIGION_INFLUENCE_DISTANCE_WEIGHT) \
+	DO(RELIGION_INFLUENCE_POPULATION_WEIGHT) \
+	DO(RELIGION_INFLUENCE_RANDOM_WEIGHT) \
+	DO(RELIGION_INFLUENCE_SHRINE_WEIGHT) \
+	DO(RELIGION_INFLUENCE_STATE_RELIGION_WEIGHT) \
+	DO(RELIGION_INFLUENCE_TIME_SCALE) \
+	DO(RELIGION_INFLUENCE_TIME_WEIGHT) \
+	DO(RELIGION_PERCENT_ANGER) \
+	DO(RELIGION_SPREAD_DISTANCE_DIVISOR) \
+	DO(RELIGION_SPREAD_DISTANCE_FACTOR) \
+	DO(RELIGION_SPREAD_DIVISOR_BASE) \
+	DO(RELIGION_SPREAD_RAND) \
+	DO(REMOVAL_CHANCE_BAD_TERRAIN) \
+	DO(REMOVAL_CHANCE_PEAK) \
+	DO(RESEARCH_MODIFIER_EXTRA_TEAM_MEMBER) \
+	DO(REVOLTS_IGNORE_CULTURE_RANGE) \
+	DO(REVOLT_DEFENSE_STATE_RELIGION_MODIFIER) \
+	DO(REVOLT_FREE_UNITS_PERCENT) \
+	DO(REVOLT_OCCUPATION_TURNS_PERCENT) \
+	DO(REVOLT_OFFENSE_STATE_RELIGION_MODIFIER) \
+	DO(REVOLT_TEST_PROB) \
+	DO(REVOLT_TOTAL_CULTURE_MODIFIER) \
+	DO(RIVAL_TEAM_STARTING_MODIFIER) \
+	DO(SCORE_LAND_FACTOR) \
+	DO(SCORE_POPULATION_FACTOR) \
+	DO(SCORE_TECH_FACTOR) \
+	DO(SCORE_WONDER_FACTOR) \
+	DO(SHALLOW_WATER_TERRAIN) \
+	DO(SHIP_BLOCKADE_RANGE) \
+	DO(SHOW_DAWN_AFTER_REGEN) \
+	DO(SHOW_ENTERED_ERA_IN_REPLAY) \
+	DO(SHOW_FIRST_TO_DISCOVER_IN_REPLAY)
+
+#define DO_FOR_EACH_INT_GLOBAL_DEFINE_5(DO) \
+	DO(SHOW_FRIENDLY_MISSIONARY_MOVES) \
+	DO(SHOW_FRIENDLY_SEA_MOVES) \
+	DO(SHOW_FRIENDLY_WORKER_MOVES) \
+	DO(SHOW_HIDDEN_ATTITUDE) \
+	DO(SPY_DESTROY_COST_MULTIPLIER) \
+	DO(SPY_DESTROY_COST_MULTIPLIER_LIMITED) \
+	DO(SPY_STEAL_PLANS_COST_MULTIPLIER) \
+	DO(STANDARD_HANDICAP) \
+	DO(STARTING_DISTANCE_PERCENT) \
+	DO(START_SIGHT_RANGE) \
+	DO(START_YEAR) \
+	DO(STOP_RELIGION_SPREAD_ANNOUNCE_ERA) \
+	DO(TEAM_VOTE_MIN_CANDIDATES) \
+	DO(TECH_COST_EXTRA_TEAM_MEMBER_MODIFIER) \
+	DO(TEMPERATE_FEATURE) \
+	DO(TEMPERATE_TERRAIN) \
+	DO(TEMP_HAPPY) \
+	DO(THEIR_POPULATION_TRADE_PERCENT) \
+	DO(TRADE_PROFIT_PERCENT) \
+	DO(TRUNCATE_ANIMATIONS) \
+	DO(TRUNCATE_ANIMATIONS_ERA) \
+	DO(TRUNCATE_ANIMATION_TURNS) \
+	DO(UNIT_PRODUCTION_DECAY_PERCENT) \
+	DO(UNIT_PRODUCTION_DECAY_TIME) \
+	DO(UNIT_PRODUCTION_PERCENT) \
+	DO(UNIT_UPGRADE_COST_PER_PRODUCTION) \
+	DO(UNIT_VISIBILITY_RANGE) \
+	DO(UPKEEP_CITY_OFFSET) \
+	DO(UPKEEP_POPULATION_OFFSET) \
+	DO(USE_KMOD_TRADE_CULTURE) \
+	DO(UWAI_PERSONALITY_PERCENT) \
+	DO(VASSAL_DENY_OWN_LOSSES_FACTOR) \
+	DO(VASSAL_HAPPINESS) \
+	DO(VASSAL_REVOLT_MASTER_LOSSES_FACTOR) \
+	DO(VASSAL_REVOLT_OWN_LOSSES_FACTOR) \
+	DO(WARLORD_EXTRA_EXPERIENCE_PER_UNIT_PERCENT) \
+	DO(WARLORD_MAXIMUM_EXTRA_EXPERIENCE_PERCENT) \
+	DO(WARM_FEATURE) \
+	DO(WAR_DESPITE_TRIBUTE_MEMORY) \
+	DO(WAR_SUCCESS_ATTACKING) \
+	DO(WAR_SUCCESS_CITY_CAPTURING) \
+	DO(WAR_SUCCESS_DEFENDING) \
+	DO(WAR_SUCCESS_NUKE) \
+	DO(WAR_SUCCESS_UNIT_CAPTURING) \
+	DO(WAR_TRADEVAL_POWER_WEIGHT) \
+	DO(WATER_IMPROVEMENT) \
+	DO(WATER_POTENTIAL_CITY_WORK_FOR_AREA) \
+	DO(WEEKS_PER_MONTHS) \
+	DO(WE_LOVE_THE_KING_POPULATION_MIN_POPULATION) \
+	DO(WE_LOVE_THE_KING_RAND) \
+	DO(WW_ATTACKED_WITH_NUKE) \
+	DO(WW_CAPTURED_CITY) \
+	DO(WW_CAPTURED_UNIT) \
+	DO(WW_DECAY_PEACE_PERCENT) \
+	DO(WW_DECAY_RATE) \
+	DO(WW_HIT_BY_NUKE) \
+	DO(WW_KILLED_UNIT_ATTACKING) \
+	DO(WW_KILLED_UNIT_DEFENDING) \
+	DO(WW_UNIT_CAPTURED) \
+	DO(WW_UNIT_KILLED_ATTACKING) \
+	DO(WW_UNIT_KILLED_DEFENDING)
+// </advc.003ah>
 
 class CvGlobals
 {
@@ -221,6 +575,7 @@ public:
 	void setInfoTypeFromString(const char* szType, int idx);
 	DllExport void infoTypeFromStringReset();
 	void addToInfosVectors(void *infoVector);
+	unsigned int getInfoCacheSignature(void const* pSkip) const; // advc.003ai
 	DllExport void infosReset();
 
 	DllExport int getNumWorldInfos();
@@ -697,6 +1052,29 @@ public:
 	void setDefineINT( const char * szName, int iValue, bool bUpdateCache = true);
 	void setDefineFLOAT( const char * szName, float fValue, bool bUpdateCache = true );
 	void setDefineSTRING( const char * szName, const char * szValue, bool bUpdateCache = true );
+	/*  <advc.003ah> Array access instead of a lookup by name. Use e.g.
+		GC.getDefineINT(CvGlobals::MAX_TRADE_ROUTES). The defines need to be
+		listed in one of the DO_FOR_EACH_INT_GLOBAL_DEFINE macros above. */
+#define MAKE_ENUMERATOR(VAR) VAR,
+	enum GlobalDefines
+	{
+		DO_FOR_EACH_INT_GLOBAL_DEFINE_1(MAKE_ENUMERATOR)
+		DO_FOR_EACH_INT_GLOBAL_DEFINE_2(MAKE_ENUMERATOR)
+		DO_FOR_EACH_INT_GLOBAL_DEFINE_3(MAKE_ENUMERATOR)
+		DO_FOR_EACH_INT_GLOBAL_DEFINE_4(MAKE_ENUMERATOR)
+		DO_FOR_EACH_INT_GLOBAL_DEFINE_5(MAKE_ENUMERATOR)
+		NUM_GLOBAL_DEFINES
+	};
+#undef MAKE_ENUMERATOR
+	inline int getDefineINT(GlobalDefines eVar) const
+	{
+		FAssert(eVar >= 0 && eVar < NUM_GLOBAL_DEFINES);
+		return m_aiGlobalDefines[eVar];
+	}
+	/*  Called once all global defines have been loaded (incl. those set by
+		CvXMLLoadUtility::SetPostGlobalsGlobalDefines) and whenever a define
+		changes. A name that isn't defined in XML fails an assertion here. */
+	void cacheIntGlobalDefines(); // </advc.003ah>
 
 	inline int getEXTRA_YIELD() { return m_iEXTRA_YIELD; } // K-Mod (why aren't all these functions inline?)
 	// advc.130s: Cached for performance reasons
@@ -1197,6 +1575,7 @@ protected:
 	//////////////////////////////////////////////////////////////////////////
 
 	FVariableSystem* m_VarSystem;
+	int m_aiGlobalDefines[NUM_GLOBAL_DEFINES]; // advc.003ah
 
 	int m_iEXTRA_YIELD; // K-Mod
 	bool m_bJOIN_WAR_DIPLO_BONUS; // advc.130s
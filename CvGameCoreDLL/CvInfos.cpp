@@ -39,6 +39,13 @@ m_bGraphicalOnly(false)
 CvInfoBase::~CvInfoBase()
 {
 }
+
+/*  advc.003ai: Has to be defined in this file, where the stream functions are
+	defined, so that it changes whenever they get recompiled. */
+char const* CvInfoBase::getStreamBuildStamp()
+{
+	return __DATE__ " " __TIME__;
+}
 #if SERIALIZE_CVINFOS
 void CvInfoBase::read(FDataStreamBase* pStream)
 {
@@ -58,10 +58,16 @@ public:
 	const wchar* getStrategy() const;	
 
 	bool isMatchForLink(std::wstring szLink, bool bKeysOnly) const;
+	/*  advc.003ai: Any change to a read(FDataStreamBase*) or write function of
+		the info classes requires incrementing iINFO_CACHE_VERSION (CvGlobals.cpp);
+		otherwise, a cache written by an earlier build may get read with the
+		new layout. */
 	#if SERIALIZE_CVINFOS
 	virtual void read(FDataStreamBase* pStream);
 	virtual void write(FDataStreamBase* pStream);
 	#endif
+	// advc.003ai: Compile time of CvInfos.cpp, for the XML cache signature
+	static char const* getStreamBuildStamp();
 	virtual bool read(CvXMLLoadUtility* pXML);
 	virtual bool readPass2(CvXMLLoadUtility* pXML) { pXML; FAssertMsg(false, "Override this"); return false; }
 	virtual bool readPass3() { FAssertMsg(false, "Override this"); return false; }
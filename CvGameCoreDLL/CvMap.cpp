@@ -25,6 +25,7 @@
 #include "CvDLLFAStarIFaceBase.h"
 #include "CvDLLPythonIFaceBase.h"
 #include "CvDLLInterfaceIFaceBase.h" // K-Mod
+#include "KmodPathFinder.h" // advc.003x
 #include <stack> // advc.030
 
 
@@ -36,6 +37,9 @@ CvMap::CvMap()
 	m_paiNumBonusOnLand = NULL;
 
 	m_pMapPlots = NULL;
+	// <advc.003y>
+	m_iPlotChangeSerial = 0;
+	m_iPlotChangeResetSerial = 0; // </advc.003y>
 
 	reset(&defaultMapData);
 }
@@ -105,6 +109,7 @@ void CvMap::reset(CvMapInitData* pInitInfo)
 	//--------------------------------
 	// Uninit class
 	uninit();
+	KmodPathFinder::InvalidateLandmarks(); // advc.003x
 
 	//
 	// set grid size
@@ -234,6 +239,10 @@ void CvMap::setup()
 	gDLL->getFAStarIFace()->Initialize(&GC.getBorderFinder(), getGridWidthINLINE(), getGridHeightINLINE(), isWrapXINLINE(), isWrapYINLINE(), NULL, NULL, NULL, borderValid, NULL, NULL, NULL);
 	gDLL->getFAStarIFace()->Initialize(&GC.getAreaFinder(), getGridWidthINLINE(), getGridHeightINLINE(), isWrapXINLINE(), isWrapYINLINE(), NULL, NULL, NULL, areaValid, NULL, joinArea, NULL);
 	gDLL->getFAStarIFace()->Initialize(&GC.getPlotGroupFinder(), getGridWidthINLINE(), getGridHeightINLINE(), isWrapXINLINE(), isWrapYINLINE(), NULL, NULL, NULL, plotGroupValid, NULL, countPlotGroup, NULL);
+	// <advc.003y> Start a new journal; any entries recorded so far are void.
+	m_iPlotChangeResetSerial = ++m_iPlotChangeSerial;
+	m_aiPlotChangeSerial.assign(numPlotsINLINE(), 0);
+	m_aiWidePlotChangeSerial.assign(numPlotsINLINE(), 0); // </advc.003y>
 }
 
 
@@ -323,6 +332,28 @@ void CvMap::setFlagsDirty()
 }
 // K-Mod end
 
+// <advc.003y>
+void CvMap::logPlotChange(CvPlot const& kPlot, bool bWide) {
+
+	int iPlotIndex = plotNumINLINE(kPlot.getX_INLINE(), kPlot.getY_INLINE());
+	/*  Plots can change while the map is being (re-)initialized; setup will
+		start a new journal afterwards. */
+	if(iPlotIndex >= (int)m_aiPlotChangeSerial.size())
+		return;
+	m_iPlotChangeSerial++;
+	m_aiPlotChangeSerial[iPlotIndex] = m_iPlotChangeSerial;
+	if(bWide)
+		m_aiWidePlotChangeSerial[iPlotIndex] = m_iPlotChangeSerial;
+}
+
+
+int CvMap::getPlotChangeSerial(int iPlotIndex, bool bWide) const {
+
+	FAssert(iPlotIndex >= 0 && iPlotIndex < (int)m_aiPlotChangeSerial.size());
+	return (bWide ? m_aiWidePlotChangeSerial[iPlotIndex] :
+			m_aiPlotChangeSerial[iPlotIndex]);
+} // </advc.003y>
+
 void CvMap::updateFlagSymbols()
 {
 	PROFILE_FUNC();
@@ -560,13 +591,13 @@ void CvMap::combinePlotGroups(PlayerTypes ePlayer, CvPlotGroup* pPlotGroup1, CvP
 		pOldPlotGroup = pPlotGroup1;
 	}
 
-	CLLNode<XYCoords>* pPlotNode = pOldPlotGroup->headPlotsNode();
-	while (pPlotNode != NULL)
+	// <advc.003ag> Move all plots, then delete pOldPlotGroup through clearPlots.
+	for (int i = 0; i < pOldPlotGroup->getLengthPlots(); i++)
 	{
-		CvPlot* pPlot = plotSorenINLINE(pPlotNode->m_data.iX, pPlotNode->m_data.iY);
-		pNewPlotGroup->addPlot(pPlot);
-		pPlotNode = pOldPlotGroup->deletePlotsNode(pPlotNode);
+		XYCoords const& xy = pOldPlotGroup->getPlotCoords(i);
+		pNewPlotGroup->addPlot(plotSorenINLINE(xy.iX, xy.iY));
 	}
+	pOldPlotGroup->clearPlots(); // </advc.003ag>
 }
 
 CvPlot* CvMap::syncRandPlot(int iFlags, int iArea, int iMinUnitDistance, int iTimeout,
@@ -1368,8 +1399,10 @@ void CvMap::rebuild(int iGridW, int iGridH, int iTopLatitude, int iBottomLatitud
 
 void CvMap::calculateAreas()
 {
-	PROFILE("CvMap::calculateAreas"); // <advc.030>
-	if(GC.getDefineINT("PASSABLE_AREAS") > 0) {
+	PROFILE("CvMap::calculateAreas");
+	KmodPathFinder::InvalidateLandmarks(); // advc.003x
+	// <advc.030>
+	if(GC.getDefineINT(CvGlobals::PASSABLE_AREAS) > 0) {
 		/*  Will recalculate from CvGame::setinitialItems once normalization is
 			through. But need preliminary areas because normalization is done
 			based on areas. Also, some scenarios don't call CvGame::
@@ -226,6 +226,19 @@ public: // advc.003: made several functions const
 	void doTurn();
 
 	void setFlagsDirty(); // K-Mod
+	/*  <advc.003y> Journal of plot changes for incremental updates of
+		AI found values. bWide for changes that can also matter to city sites
+		that don't include kPlot in their radius (e.g. through canFound).
+		advc.003ad: All changes that can affect WarAndPeaceCache's path
+		distances also have to be wide. */
+	void logPlotChange(CvPlot const& kPlot, bool bWide = false);
+	// Serial number of the latest change
+	int getPlotChangeSerial() const { return m_iPlotChangeSerial; }
+	// Serial number of the latest change of the plot at iPlotIndex
+	int getPlotChangeSerial(int iPlotIndex, bool bWide) const;
+	// Any journal entries older than this have been lost
+	int getPlotChangeResetSerial() const { return m_iPlotChangeResetSerial; }
+	// </advc.003y>
 	DllExport void updateFlagSymbols();
 
 	DllExport void updateFog();
@@ -444,6 +457,12 @@ protected:
 	std::map<Shelf::Id,Shelf*> shelves; // advc.300
 
 	FFreeListTrashArray<CvArea> m_areas;
+	// <advc.003y> (not serialized)
+	int m_iPlotChangeSerial;
+	int m_iPlotChangeResetSerial;
+	std::vector<int> m_aiPlotChangeSerial;
+	std::vector<int> m_aiWidePlotChangeSerial;
+	// </advc.003y>
 	void calculateAreas();
 	// <advc.030>
 	void calculateAreas_030();
@@ -15,6 +15,7 @@
 #include "CvGameTextMgr.h"
 #include "RiseFall.h" // advc.700
 #include "AdvCiv4lerts.h" // advc.210
+#include "TurnTimer.h" // advc.003s
 #include "CyCity.h"
 #include "CyPlot.h"
 #include "CyUnit.h"
@@ -184,7 +185,7 @@ bool CvPlayer::initOtherData() {
 		int iBestValue = 0;
 		LeaderHeadTypes eBestPersonality = NO_LEADER;
 		for (iI = 0; iI < GC.getNumLeaderHeadInfos(); iI++) {
-			if (iI == GC.getDefineINT("BARBARIAN_LEADER")) // XXX minor civ???
+			if (iI == GC.getDefineINT(CvGlobals::BARBARIAN_LEADER)) // XXX minor civ???
 				continue;
 	
 			int iValue = (1 + GC.getGameINLINE().getSorenRandNum(10000, "Choosing Personality"));
@@ -203,14 +204,14 @@ bool CvPlayer::initOtherData() {
 			setPersonalityType(eBestPersonality);
 	}
 
-	changeBaseFreeUnits(GC.getDefineINT("INITIAL_BASE_FREE_UNITS"));
-	changeBaseFreeMilitaryUnits(GC.getDefineINT("INITIAL_BASE_FREE_MILITARY_UNITS"));
-	changeFreeUnitsPopulationPercent(GC.getDefineINT("INITIAL_FREE_UNITS_POPULATION_PERCENT"));
-	changeFreeMilitaryUnitsPopulationPercent(GC.getDefineINT("INITIAL_FREE_MILITARY_UNITS_POPULATION_PERCENT"));
-	changeGoldPerUnit(GC.getDefineINT("INITIAL_GOLD_PER_UNIT"));
-	changeTradeRoutes(GC.getDefineINT("INITIAL_TRADE_ROUTES"));
-	changeStateReligionHappiness(GC.getDefineINT("INITIAL_STATE_RELIGION_HAPPINESS"));
-	changeNonStateReligionHappiness(GC.getDefineINT("INITIAL_NON_STATE_RELIGION_HAPPINESS"));
+	changeBaseFreeUnits(GC.getDefineINT(CvGlobals::INITIAL_BASE_FREE_UNITS));
+	changeBaseFreeMilitaryUnits(GC.getDefineINT(CvGlobals::INITIAL_BASE_FREE_MILITARY_UNITS));
+	changeFreeUnitsPopulationPercent(GC.getDefineINT(CvGlobals::INITIAL_FREE_UNITS_POPULATION_PERCENT));
+	changeFreeMilitaryUnitsPopulationPercent(GC.getDefineINT(CvGlobals::INITIAL_FREE_MILITARY_UNITS_POPULATION_PERCENT));
+	changeGoldPerUnit(GC.getDefineINT(CvGlobals::INITIAL_GOLD_PER_UNIT));
+	changeTradeRoutes(GC.getDefineINT(CvGlobals::INITIAL_TRADE_ROUTES));
+	changeStateReligionHappiness(GC.getDefineINT(CvGlobals::INITIAL_STATE_RELIGION_HAPPINESS));
+	changeNonStateReligionHappiness(GC.getDefineINT(CvGlobals::INITIAL_NON_STATE_RELIGION_HAPPINESS));
 
 	for (iI = 0; iI < NUM_YIELD_TYPES; iI++) {
 		YieldTypes eYield = (YieldTypes)iI;
@@ -346,6 +347,7 @@ void CvPlayer::uninit()
 
 	SAFE_DELETE_ARRAY(m_pabResearchingTech);
 	SAFE_DELETE_ARRAY(m_pabLoyalMember);
+	m_aiTechPathLength.clear(); // advc.003al
 
 	SAFE_DELETE_ARRAY(m_paeCivics);
 
@@ -868,7 +870,7 @@ void CvPlayer::changePersonalityType( )
 
 	for (int iI = 0; iI < GC.getNumLeaderHeadInfos(); iI++)
 	{
-		if (iI != GC.getDefineINT("BARBARIAN_LEADER")) // XXX minor civ???
+		if (iI != GC.getDefineINT(CvGlobals::BARBARIAN_LEADER)) // XXX minor civ???
 		{
 			int iValue = (1 + GC.getGameINLINE().getSorenRandNum(10000, "Choosing Personality"));
 
@@ -1001,7 +1003,7 @@ void CvPlayer::changeCiv( CivilizationTypes eNewCiv )
 		{
 			for (int iK = 0; iK < GC.getNumPlayerColorInfos(); iK++)
 			{
-				if (iK != GC.getCivilizationInfo((CivilizationTypes)GC.getDefineINT("BARBARIAN_CIVILIZATION")).getDefaultPlayerColor())
+				if (iK != GC.getCivilizationInfo((CivilizationTypes)GC.getDefineINT(CvGlobals::BARBARIAN_CIVILIZATION)).getDefaultPlayerColor())
 				{
 					bool bValid = true;
 
@@ -1195,7 +1197,7 @@ void CvPlayer::initFreeUnits()
 			/* advc.108: BtS code moved into a new function (b/c I need the same
 		       behavior elsewhere). */
 			TEAMREF(getID()).revealSurroundingPlots(*pStartingPlot,
-					GC.getDefineINT("ADVANCED_START_SIGHT_RANGE"));
+					GC.getDefineINT(CvGlobals::ADVANCED_START_SIGHT_RANGE));
 		}
 	}
 	else
@@ -1393,7 +1395,7 @@ void CvPlayer::addFreeUnit(UnitTypes eUnit, UnitAITypes eUnitAI)
 	if(bFound)
 	{
 		TEAMREF(getID()).revealSurroundingPlots(*pBestPlot,
-				GC.getDefineINT("START_SIGHT_RANGE"));
+				GC.getDefineINT(CvGlobals::START_SIGHT_RANGE));
 	} // </advc.108>
 	initUnit(eUnit, pBestPlot->getX_INLINE(), pBestPlot->getY_INLINE(), eUnitAI);
 }
@@ -1404,7 +1406,7 @@ int CvPlayer::startingPlotRange() const
 
 	iRange = (GC.getMapINLINE().maxStepDistance() + 10);
 
-	iRange *= GC.getDefineINT("STARTING_DISTANCE_PERCENT");
+	iRange *= GC.getDefineINT(CvGlobals::STARTING_DISTANCE_PERCENT);
 	iRange /= 100;
 
 	iRange *= (GC.getMapINLINE().getLandPlots() / (GC.getWorldInfo(GC.getMapINLINE().getWorldSize()).getTargetNumCities() * GC.getGameINLINE().countCivPlayersAlive()));
@@ -1419,7 +1421,7 @@ int CvPlayer::startingPlotRange() const
 		iRange /= 100;
 	}
 
-	return std::max(iRange, GC.getDefineINT("MIN_CIV_STARTING_DISTANCE"));
+	return std::max(iRange, GC.getDefineINT(CvGlobals::MIN_CIV_STARTING_DISTANCE));
 }
 
 
@@ -1448,12 +1450,12 @@ int CvPlayer::startingPlotDistanceFactor(CvPlot* pPlot, PlayerTypes ePlayer, int
 	{
 		if (GET_PLAYER(ePlayer).getTeam() == getTeam())
 		{
-			iRange *= GC.getDefineINT("OWN_TEAM_STARTING_MODIFIER");
+			iRange *= GC.getDefineINT(CvGlobals::OWN_TEAM_STARTING_MODIFIER);
 			iRange /= 100;
 		}
 		else
 		{
-			iRange *= GC.getDefineINT("RIVAL_TEAM_STARTING_MODIFIER");
+			iRange *= GC.getDefineINT(CvGlobals::RIVAL_TEAM_STARTING_MODIFIER);
 			iRange /= 100;
 		}
 	}
@@ -1710,6 +1712,7 @@ CvCity* CvPlayer::initCity(int iX, int iY, bool bBumpUnits, bool bUpdatePlotGrou
 	/*  advc.104: Moved out of CvCity::init so that the new city is
 		already fully initialized */
 	setFoundedFirstCity(true);
+	getWPAI.invalidateTurnCache(); // advc.003z
 	return pCity;
 }
 
@@ -1785,7 +1788,7 @@ void CvPlayer::acquireCity(CvCity* pOldCity, bool bConquest, bool bTrade, bool b
 
 								if (bForceUnowned)
 								{
-									pLoopPlot->setForceUnownedTimer(GC.getDefineINT("FORCE_UNOWNED_CITY_TIMER"));
+									pLoopPlot->setForceUnownedTimer(GC.getDefineINT(CvGlobals::FORCE_UNOWNED_CITY_TIMER));
 								}
 							}
 						}
@@ -2146,9 +2149,9 @@ void CvPlayer::acquireCity(CvCity* pOldCity, bool bConquest, bool bTrade, bool b
 	{
 		int iTeamCulturePercent = pNewCity->calculateTeamCulturePercent(getTeam());
 
-		if (iTeamCulturePercent < GC.getDefineINT("OCCUPATION_CULTURE_PERCENT_THRESHOLD"))
+		if (iTeamCulturePercent < GC.getDefineINT(CvGlobals::OCCUPATION_CULTURE_PERCENT_THRESHOLD))
 		{
-			int iPopPercent = GC.getDefineINT("OCCUPATION_TURNS_POPULATION_PERCENT");
+			int iPopPercent = GC.getDefineINT(CvGlobals::OCCUPATION_TURNS_POPULATION_PERCENT);
 			pNewCity->changeOccupationTimer(
 				/*  advc.023: Population size as upper bound, and iPopPercent set to
 					0 through XML. (Im multiplying by 1+100*iPopPercent so that the
@@ -2156,7 +2159,7 @@ void CvPlayer::acquireCity(CvCity* pOldCity, bool bConquest, bool bTrade, bool b
 					NB: iTeamCulturePercent is city culture, not tile culture;
 					only relevant when a city is reconquered. */
 				std::min(pNewCity->getPopulation() * (1 + iPopPercent * 100),
-				((GC.getDefineINT("BASE_OCCUPATION_TURNS") + 
+				((GC.getDefineINT(CvGlobals::BASE_OCCUPATION_TURNS) + 
 				((pNewCity->getPopulation() * iPopPercent) / 100)) * 
 				(100 - iTeamCulturePercent)) / 100));
 		}
@@ -3080,6 +3083,7 @@ const TCHAR* CvPlayer::getUnitButton(UnitTypes eUnit) const
 void CvPlayer::doTurn()  // advc.003: style changes
 {
 	PROFILE_FUNC();
+	TurnTimer::Scope kTurnTimer(TurnTimer::PLAYER_DO_TURN); // advc.003s
 
 	FAssertMsg(isAlive(), "isAlive is expected to be true");
 	FAssertMsg(!hasBusyUnit() || GC.getGameINLINE().isMPOption(MPOPTION_SIMULTANEOUS_TURNS)  || GC.getGameINLINE().isSimultaneousTeamTurns(), "End of turn with busy units in a sequential-turn game");
@@ -3165,7 +3169,7 @@ void CvPlayer::doTurn()  // advc.003: style changes
 	// </advc.004l>
 	/*  <advc.034> Cancel disengagement agreements at the end of a round, i.e.
 		at the end of the barb turn. */
-	int iDisengageLength = (GC.getDefineINT("DISENGAGE_LENGTH") > 0);
+	int iDisengageLength = (GC.getDefineINT(CvGlobals::DISENGAGE_LENGTH) > 0);
 	if(isBarbarian() && iDisengageLength > 0) {
 		for(CvDeal* d = g.firstDeal(&foo); d != NULL; d = g.nextDeal(&foo)) {
 			if(d->isDisengage() && d->turnsToCancel() <= 1) {
@@ -3532,14 +3536,52 @@ void CvPlayer::updateTradeRoutes()
 		}
 	}
 
+	// <advc.003af> Look up the candidates once for all our cities
+	std::map<CvPlotGroup*,std::vector<CvCity*> > candidates;
+	getTradeRouteCandidates(candidates);
+	bool bIgnorePlotGroups = (GC.getDefineINT(CvGlobals::IGNORE_PLOT_GROUP_FOR_TRADE_ROUTES) > 0);
+	std::vector<CvCity*> const noCandidates; // </advc.003af>
 	CLLNode<int>* pCityNode = cityList.head();
 	while (pCityNode != NULL)
 	{
-		getCity(pCityNode->m_data)->updateTradeRoutes();
+		CvCity* pCity = getCity(pCityNode->m_data);
+		// <advc.003af>
+		std::map<CvPlotGroup*,std::vector<CvCity*> >::const_iterator pos =
+				candidates.find(bIgnorePlotGroups ? NULL : pCity->plotGroup(getID()));
+		pCity->updateTradeRoutes(pos == candidates.end() ? &noCandidates :
+				&pos->second); // </advc.003af>
 		pCityNode = cityList.next(pCityNode);
 	}
 }
 
+/*  advc.003af: Cut from CvCity::updateTradeRoutes. The candidates don't depend
+	on which of our cities is looking for trade partners except through the
+	plot group. The order of the candidates is the same as in the original
+	loop, which matters for breaking ties between routes of equal value. */
+void CvPlayer::getTradeRouteCandidates(std::map<CvPlotGroup*,std::vector<CvCity*> >& r) const
+{
+	PROFILE_FUNC();
+	bool bIgnorePlotGroups = (GC.getDefineINT(CvGlobals::IGNORE_PLOT_GROUP_FOR_TRADE_ROUTES) > 0);
+	for(int iI = 0; iI < MAX_CIV_PLAYERS; iI++)
+	{
+		CvPlayer const& kPartner = GET_PLAYER((PlayerTypes)iI);
+		if(!canHaveTradeRoutesWith(kPartner.getID()))
+			continue;
+		int iLoop;
+		for(CvCity* pLoopCity = kPartner.firstCity(&iLoop);
+				pLoopCity != NULL; pLoopCity = kPartner.nextCity(&iLoop))
+		{
+			/*  <advc.124> A connection along revealed tiles ensures that the
+				city tile is revealed, but this doesn't imply that the city is
+				also revealed: The tile could've been explored before the city
+				existed. Need to check CvCity::isRevealed explicitly. */
+			if(pLoopCity->isDisorder() || !pLoopCity->isRevealed(getTeam(), false))
+				continue; // <advc.124>
+			r[bIgnorePlotGroups ? NULL : pLoopCity->plotGroup(getID())].push_back(pLoopCity);
+		}
+	}
+}
+
 void CvPlayer::updatePlunder(int iChange, bool bUpdatePlotGroups)
 {
 	int iLoop;
@@ -5017,7 +5059,7 @@ void CvPlayer::findNewCapital()  // advc.003 style changes
 {
 	BuildingTypes eCapitalBuilding = (BuildingTypes)
 			GC.getCivilizationInfo(getCivilizationType()).
-			getCivilizationBuildings(GC.getDefineINT("CAPITAL_BUILDINGCLASS"));
+			getCivilizationBuildings(GC.getDefineINT(CvGlobals::CAPITAL_BUILDINGCLASS));
 	if (eCapitalBuilding == NO_BUILDING)
 		return;
 
@@ -5082,7 +5124,7 @@ bool CvPlayer::canRaze(CvCity* pCity) const
 		if (pCity->getOwnerINLINE() != getID())
 			return false;
 
-		if (pCity->calculateTeamCulturePercent(getTeam()) >= GC.getDefineINT("RAZING_CULTURAL_PERCENT_THRESHOLD"))
+		if (pCity->calculateTeamCulturePercent(getTeam()) >= GC.getDefineINT(CvGlobals::RAZING_CULTURAL_PERCENT_THRESHOLD))
 			return false;
 	}
 
@@ -5549,7 +5591,7 @@ void CvPlayer::doGoody(CvPlot* pPlot, CvUnit* pUnit, /* advc.314: */ GoodyTypes
 		FAssertMsg(pPlot->isOwned(), "Barbarians should remove hut only when receiving a city");
 		return;
 	} // </advc.003>
-	for (int iI = 0; iI < GC.getDefineINT("NUM_DO_GOODY_ATTEMPTS"); iI++)
+	for (int iI = 0; iI < GC.getDefineINT(CvGlobals::NUM_DO_GOODY_ATTEMPTS); iI++)
 	{
 		if (GC.getHandicapInfo(getHandicapType()).getNumGoodies() <= 0)
 			continue; // advc.003
@@ -5940,7 +5982,7 @@ bool CvPlayer::canConstruct(BuildingTypes eBuilding, bool bContinue, bool bTestV
 	}
 	// <dlph.19>
 	if(eBuilding == (BuildingTypes)(GC.getCivilizationInfo(getCivilizationType()).
-			getCivilizationBuildings(GC.getDefineINT("CAPITAL_BUILDINGCLASS")))) {
+			getCivilizationBuildings(GC.getDefineINT(CvGlobals::CAPITAL_BUILDINGCLASS)))) {
         for(int i = 0; i < GC.getNumVictoryInfos(); i++) {
             if(kOurTeam.getVictoryCountdown((VictoryTypes)i) >= 0 &&
 					GC.getGameINLINE().getGameState() == GAMESTATE_ON)
@@ -6201,7 +6243,7 @@ int CvPlayer::getProductionNeeded(UnitTypes eUnit) const
 	iProductionNeeded *= 100 + getUnitClassCount(eUnitClass) * GC.getUnitClassInfo(eUnitClass).getInstanceCostModifier();
 	iProductionNeeded /= 100;
 
-	iProductionNeeded *= GC.getDefineINT("UNIT_PRODUCTION_PERCENT");
+	iProductionNeeded *= GC.getDefineINT(CvGlobals::UNIT_PRODUCTION_PERCENT);
 	iProductionNeeded /= 100;
 
 	iProductionNeeded *= GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getTrainPercent();
@@ -6239,7 +6281,7 @@ int CvPlayer::getProductionNeeded(BuildingTypes eBuilding) const
 	CvGame const& g = GC.getGameINLINE(); // advc.003
 	int iProductionNeeded = GC.getBuildingInfo(eBuilding).getProductionCost();
 
-	iProductionNeeded *= GC.getDefineINT("BUILDING_PRODUCTION_PERCENT");
+	iProductionNeeded *= GC.getDefineINT(CvGlobals::BUILDING_PRODUCTION_PERCENT);
 	iProductionNeeded /= 100;
 
 	iProductionNeeded *= GC.getGameSpeedInfo(g.getGameSpeedType()).getConstructPercent();
@@ -6273,7 +6315,7 @@ int CvPlayer::getProductionNeeded(ProjectTypes eProject) const
 	int const iBaseCost = GC.getProjectInfo(eProject).getProductionCost();
 	int iProductionNeeded = iBaseCost; // </advc.251>
 
-	iProductionNeeded *= GC.getDefineINT("PROJECT_PRODUCTION_PERCENT");
+	iProductionNeeded *= GC.getDefineINT(CvGlobals::PROJECT_PRODUCTION_PERCENT);
 	iProductionNeeded /= 100;
 
 	iProductionNeeded *= GC.getGameSpeedInfo(g.getGameSpeedType()).getCreatePercent();
@@ -6763,10 +6805,10 @@ int CvPlayer::calculatePollution(int iTypes) const
 {
 	int iTotal = 0;
 
-	int iBuildingWeight = ((iTypes & POLLUTION_BUILDINGS) == 0)?0 :GC.getDefineINT("GLOBAL_WARMING_BUILDING_WEIGHT");
-	int iBonusWeight = ((iTypes & POLLUTION_BONUSES) == 0)?0 :GC.getDefineINT("GLOBAL_WARMING_BONUS_WEIGHT");
-	int iPowerWeight = ((iTypes & POLLUTION_POWER) == 0)?0 :GC.getDefineINT("GLOBAL_WARMING_POWER_WEIGHT");
-	int iPopWeight = ((iTypes & POLLUTION_POPULATION) == 0)?0 :GC.getDefineINT("GLOBAL_WARMING_POPULATION_WEIGHT");
+	int iBuildingWeight = ((iTypes & POLLUTION_BUILDINGS) == 0)?0 :GC.getDefineINT(CvGlobals::GLOBAL_WARMING_BUILDING_WEIGHT);
+	int iBonusWeight = ((iTypes & POLLUTION_BONUSES) == 0)?0 :GC.getDefineINT(CvGlobals::GLOBAL_WARMING_BONUS_WEIGHT);
+	int iPowerWeight = ((iTypes & POLLUTION_POWER) == 0)?0 :GC.getDefineINT(CvGlobals::GLOBAL_WARMING_POWER_WEIGHT);
+	int iPopWeight = ((iTypes & POLLUTION_POPULATION) == 0)?0 :GC.getDefineINT(CvGlobals::GLOBAL_WARMING_POPULATION_WEIGHT);
 
 	int iLoop;
 	for (CvCity* pCity = firstCity(&iLoop); pCity != NULL; pCity = nextCity(&iLoop))
@@ -6914,9 +6956,9 @@ int CvPlayer::calculateUnitSupply(int& iPaidUnits, int& iBaseSupplyCost,
 {
 	iPaidUnits = std::max(0, getNumOutsideUnits()
 		+ iExtraOutsideUnits // advc.004b
-		- GC.getDefineINT("INITIAL_FREE_OUTSIDE_UNITS"));
+		- GC.getDefineINT(CvGlobals::INITIAL_FREE_OUTSIDE_UNITS));
 
-	iBaseSupplyCost = iPaidUnits * GC.getDefineINT("INITIAL_OUTSIDE_UNIT_GOLD_PERCENT");
+	iBaseSupplyCost = iPaidUnits * GC.getDefineINT(CvGlobals::INITIAL_OUTSIDE_UNIT_GOLD_PERCENT);
 	iBaseSupplyCost /= 100;
 	int iSupply = iBaseSupplyCost;
 	if (!isHuman() && !isBarbarian())
@@ -7150,7 +7192,7 @@ int CvPlayer::calculateResearchModifier(TechTypes eTech,
 	if(eTech != NO_TECH)
 		eResearchTech = eTech;
 	else eResearchTech = getCurrentResearch();
-	return (((GC.getDefineINT("BASE_RESEARCH_RATE") + getCommerceRate(COMMERCE_RESEARCH)) * calculateResearchModifier(eResearchTech)) / 100);
+	return (((GC.getDefineINT(CvGlobals::BASE_RESEARCH_RATE) + getCommerceRate(COMMERCE_RESEARCH)) * calculateResearchModifier(eResearchTech)) / 100);
 } */
 
 
@@ -7664,7 +7706,7 @@ void CvPlayer::revolution(CivicTypes* paeNewCivics, bool bForce)
 		}
 	}
 
-	setRevolutionTimer(std::max(1, ((100 + getAnarchyModifier()) * GC.getDefineINT("MIN_REVOLUTION_TURNS")) / 100) + iAnarchyLength);
+	setRevolutionTimer(std::max(1, ((100 + getAnarchyModifier()) * GC.getDefineINT(CvGlobals::MIN_REVOLUTION_TURNS)) / 100) + iAnarchyLength);
 
 	if (getID() == GC.getGameINLINE().getActivePlayer())
 	{
@@ -7793,7 +7835,7 @@ void CvPlayer::convert(ReligionTypes eReligion, // <advc.001v>
 
 	setLastStateReligion(eReligion);
 
-	setConversionTimer(std::max(1, ((100 + getAnarchyModifier()) * GC.getDefineINT("MIN_CONVERSION_TURNS")) / 100) + iAnarchyLength);
+	setConversionTimer(std::max(1, ((100 + getAnarchyModifier()) * GC.getDefineINT(CvGlobals::MIN_CONVERSION_TURNS)) / 100) + iAnarchyLength);
 	// <advc.004x>
 	if(getID() == GC.getGameINLINE().getActivePlayer()) {
 		killAll(BUTTONPOPUP_CHANGERELIGION);
@@ -7872,7 +7914,7 @@ void CvPlayer::foundReligion(ReligionTypes eReligion, ReligionTypes eSlotReligio
 		{
 			int iValue = 10;
 			iValue += pLoopCity->getPopulation();
-			iValue += GC.getGameINLINE().getSorenRandNum(GC.getDefineINT("FOUND_RELIGION_CITY_RAND"), "Found Religion");
+			iValue += GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(CvGlobals::FOUND_RELIGION_CITY_RAND), "Found Religion");
 
 			iValue /= (pLoopCity->getReligionCount() + 1);
 
@@ -7993,7 +8035,7 @@ void CvPlayer::foundCorporation(CorporationTypes eCorporation)
 				}
 			}
 
-			iValue += GC.getGameINLINE().getSorenRandNum(GC.getDefineINT("FOUND_CORPORATION_CITY_RAND"), "Found Corporation");
+			iValue += GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(CvGlobals::FOUND_CORPORATION_CITY_RAND), "Found Corporation");
 
 			iValue /= (pLoopCity->getCorporationCount() + 1);
 
@@ -8039,7 +8081,7 @@ int CvPlayer::getCivicAnarchyLength(CivicTypes* paeNewCivics,
 
 	if (bChange)
 	{
-		iAnarchyLength += GC.getDefineINT("BASE_CIVIC_ANARCHY_LENGTH");
+		iAnarchyLength += GC.getDefineINT(CvGlobals::BASE_CIVIC_ANARCHY_LENGTH);
 
 		iAnarchyLength += ((getNumCities() * GC.getWorldInfo(GC.getMapINLINE().
 				getWorldSize()).getNumCitiesAnarchyPercent()) / 100);
@@ -8071,7 +8113,7 @@ int CvPlayer::getReligionAnarchyLength(
 	if(/* <advc.132> */ !ignoreGoldenAge && /* </advc.132> */ isGoldenAge())
 		return 0;
 
-	int iAnarchyLength = GC.getDefineINT("BASE_RELIGION_ANARCHY_LENGTH");
+	int iAnarchyLength = GC.getDefineINT(CvGlobals::BASE_RELIGION_ANARCHY_LENGTH);
 
 	iAnarchyLength += ((getNumCities() * GC.getWorldInfo(GC.getMapINLINE().
 			getWorldSize()).getNumCitiesAnarchyPercent()) / 100);
@@ -8096,7 +8138,7 @@ int CvPlayer::getReligionAnarchyLength(
 
 int CvPlayer::unitsRequiredForGoldenAge() const
 {
-	return (GC.getDefineINT("BASE_GOLDEN_AGE_UNITS") + (getNumUnitGoldenAges() * GC.getDefineINT("GOLDEN_AGE_UNITS_MULTIPLIER")));
+	return (GC.getDefineINT(CvGlobals::BASE_GOLDEN_AGE_UNITS) + (getNumUnitGoldenAges() * GC.getDefineINT(CvGlobals::GOLDEN_AGE_UNITS_MULTIPLIER)));
 }
 
 
@@ -8201,12 +8243,12 @@ int CvPlayer::greatPeopleThreshold(bool bMilitary) const
 
 	if (bMilitary)
 	{
-		iThreshold = ((GC.getDefineINT("GREAT_GENERALS_THRESHOLD") *
+		iThreshold = ((GC.getDefineINT(CvGlobals::GREAT_GENERALS_THRESHOLD) *
 				std::max(0, (getGreatGeneralsThresholdModifier() + 100))) / 100);
 	}
 	else
 	{
-		iThreshold = ((GC.getDefineINT("GREAT_PEOPLE_THRESHOLD") *
+		iThreshold = ((GC.getDefineINT(CvGlobals::GREAT_PEOPLE_THRESHOLD) *
 				std::max(0, (getGreatPeopleThresholdModifier() + 100))) / 100);
 	}
 	CvGame const& g = GC.getGameINLINE(); // advc.003
@@ -8641,7 +8683,7 @@ int CvPlayer::getMaxAnarchyTurns() const
 
 void CvPlayer::updateMaxAnarchyTurns()
 {
-	int iBestValue = GC.getDefineINT("MAX_ANARCHY_TURNS");
+	int iBestValue = GC.getDefineINT(CvGlobals::MAX_ANARCHY_TURNS);
 
 	FAssertMsg((GC.getNumTraitInfos() > 0), "GC.getNumTraitInfos() is less than or equal to zero but is expected to be larger than zero in CvPlayer::updateMaxAnarchyTurns");
 	for (int iI = 0; iI < GC.getNumTraitInfos(); iI++)
@@ -8785,7 +8827,7 @@ void CvPlayer::changeGreatGeneralRateModifier(int iChange)
 
 int CvPlayer::getDomesticGreatGeneralRateModifier() const
 {
-	return (GC.getDefineINT("COMBAT_EXPERIENCE_IN_BORDERS_PERCENT") + m_iDomesticGreatGeneralRateModifier);
+	return (GC.getDefineINT(CvGlobals::COMBAT_EXPERIENCE_IN_BORDERS_PERCENT) + m_iDomesticGreatGeneralRateModifier);
 }
 
 
@@ -9599,17 +9641,17 @@ void CvPlayer::updateWarWearinessPercentAnger()
 
 int CvPlayer::getModifiedWarWearinessPercentAnger(int iWarWearinessPercentAnger) const			
 {
-	iWarWearinessPercentAnger *= GC.getDefineINT("BASE_WAR_WEARINESS_MULTIPLIER");
+	iWarWearinessPercentAnger *= GC.getDefineINT(CvGlobals::BASE_WAR_WEARINESS_MULTIPLIER);
 
 	if (GC.getGameINLINE().isOption(GAMEOPTION_ALWAYS_WAR) || GC.getGameINLINE().isOption(GAMEOPTION_NO_CHANGING_WAR_PEACE))
 	{
-		iWarWearinessPercentAnger *= std::max(0, (GC.getDefineINT("FORCED_WAR_WAR_WEARINESS_MODIFIER") + 100));
+		iWarWearinessPercentAnger *= std::max(0, (GC.getDefineINT(CvGlobals::FORCED_WAR_WAR_WEARINESS_MODIFIER) + 100));
 		iWarWearinessPercentAnger /= 100;
 	}
 
 	if (GC.getGameINLINE().isGameMultiPlayer())
 	{
-		iWarWearinessPercentAnger *= std::max(0, (GC.getDefineINT("MULTIPLAYER_WAR_WEARINESS_MODIFIER") + 100));
+		iWarWearinessPercentAnger *= std::max(0, (GC.getDefineINT(CvGlobals::MULTIPLAYER_WAR_WEARINESS_MODIFIER) + 100));
 		iWarWearinessPercentAnger /= 100;
 	}
 
@@ -11112,7 +11154,7 @@ void CvPlayer::setCurrentEra(EraTypes eNewValue)
 			}
 		}
 	} // <advc.106>
-	if(GC.getDefineINT("SHOW_ENTERED_ERA_IN_REPLAY") > 0) {
+	if(GC.getDefineINT(CvGlobals::SHOW_ENTERED_ERA_IN_REPLAY) > 0) {
 		CvWString szBuffer = gDLL->getText("TXT_KEY_SOMEONE_ENTERED_ERA",
 				getNameKey(), GC.getEraInfo(eNewValue).getTextKeyWide());
 		GC.getGameINLINE().addReplayMessage(REPLAY_MESSAGE_MAJOR_EVENT,
@@ -11283,6 +11325,7 @@ void CvPlayer::setTeam(TeamTypes eTeam)
 	GET_TEAM(getTeam()).changeTotalLand(-(getTotalLand()));
 
 	GC.getInitCore().setTeam(getID(), eTeam);
+	invalidateTechPathLengthCache(); // advc.003al
 
 	GET_TEAM(getTeam()).changeNumMembers(1);
 	if (isAlive())
@@ -11300,6 +11343,9 @@ void CvPlayer::setTeam(TeamTypes eTeam)
 	GET_TEAM(getTeam()).changeNumCities(getNumCities());
 	GET_TEAM(getTeam()).changeTotalPopulation(getTotalPopulation());
 	GET_TEAM(getTeam()).changeTotalLand(getTotalLand());
+	// <advc.003u> Our units may have become hostile to different teams
+	for(int i = 0; i < MAX_TEAMS; i++)
+		GET_TEAM((TeamTypes)i).AI_setHostileUnitDistDirty(); // </advc.003u>
 	// <advc.104t>
 	if(getWPAI.isEnabled())
 		getWPAI.update(); // </advc.104t>
@@ -12574,6 +12620,7 @@ void CvPlayer::setResearchingTech(TechTypes eIndex, bool bNewValue)
 	if (isResearchingTech(eIndex) != bNewValue)
 	{
 		m_pabResearchingTech[eIndex] = bNewValue;
+		invalidateTechPathLengthCache(); // advc.003al
 
 		if (getID() == GC.getGameINLINE().getActivePlayer())
 		{
@@ -12642,10 +12689,10 @@ int CvPlayer::getSingleCivicUpkeep(CivicTypes eCivic, bool bIgnoreAnarchy,
 
 	iUpkeep += ((std::max(0, (getTotalPopulation() +
 			(iExtraCities * CvCity::initialPopulation()) + // advc.004b
-			GC.getDefineINT("UPKEEP_POPULATION_OFFSET") - GC.getCivicInfo(eCivic).getCivicOptionType())) * GC.getUpkeepInfo((UpkeepTypes)(GC.getCivicInfo(eCivic).getUpkeep())).getPopulationPercent()) / 100);
+			GC.getDefineINT(CvGlobals::UPKEEP_POPULATION_OFFSET) - GC.getCivicInfo(eCivic).getCivicOptionType())) * GC.getUpkeepInfo((UpkeepTypes)(GC.getCivicInfo(eCivic).getUpkeep())).getPopulationPercent()) / 100);
 	iUpkeep += ((std::max(0, (getNumCities() + 
 			iExtraCities + // advc.004b
-			GC.getDefineINT("UPKEEP_CITY_OFFSET") + GC.getCivicInfo(eCivic).getCivicOptionType() - (GC.getNumCivicOptionInfos() / 2))) * GC.getUpkeepInfo((UpkeepTypes)(GC.getCivicInfo(eCivic).getUpkeep())).getCityPercent()) / 100);
+			GC.getDefineINT(CvGlobals::UPKEEP_CITY_OFFSET) + GC.getCivicInfo(eCivic).getCivicOptionType() - (GC.getNumCivicOptionInfos() / 2))) * GC.getUpkeepInfo((UpkeepTypes)(GC.getCivicInfo(eCivic).getUpkeep())).getCityPercent()) / 100);
 
 	iUpkeep *= std::max(0, (getUpkeepModifier() + 100));
 	iUpkeep /= 100;
@@ -12981,6 +13028,24 @@ CLLNode<int>* CvPlayer::tailGroupCycleNode() const
 //	Finds the path length from this tech type to one you already know
 int CvPlayer::findPathLength(TechTypes eTech, bool bCost) const
 {
+	/*  <advc.003al> The recursion below visits shared prereqs once per path
+		leading to them. Memoize the result of each tech; the path lengths
+		(not the costs) are also kept between calls. */
+	if (bCost)
+	{
+		std::vector<int> aiMemo(GC.getNumTechInfos(), -1);
+		return findPathLength(eTech, bCost, aiMemo);
+	}
+	if (m_aiTechPathLength.empty())
+		m_aiTechPathLength.resize(GC.getNumTechInfos(), -1);
+	return findPathLength(eTech, bCost, m_aiTechPathLength);
+}
+
+// advc.003al: Cut from the public findPathLength. aiMemo is indexed by TechTypes; -1 means not yet computed.
+int CvPlayer::findPathLength(TechTypes eTech, bool bCost, std::vector<int>& aiMemo) const
+{
+	if (aiMemo[eTech] >= 0)
+		return aiMemo[eTech]; // </advc.003al>
 	int iNumSteps = 0;
 	int iShortestPath = 0;
 	int iPathLength = 0;
@@ -12988,6 +13053,7 @@ int CvPlayer::findPathLength(TechTypes eTech, bool bCost) const
 	{
 		//	We have this tech, no reason to add this to the pre-reqs
 		//	Base case return 0, we know it...
+		aiMemo[eTech] = 0; // advc.003al
 		return 0;
 	}
 
@@ -12998,7 +13064,7 @@ int CvPlayer::findPathLength(TechTypes eTech, bool bCost) const
 
 		if (ePreReq != NO_TECH)
 		{
-			iPathLength += findPathLength(ePreReq, bCost);
+			iPathLength += findPathLength(ePreReq, bCost, aiMemo); // advc.003al
 		}
 	}
 
@@ -13015,7 +13081,7 @@ int CvPlayer::findPathLength(TechTypes eTech, bool bCost) const
 		{
 			//	Recursively find the path length (takes into account all ANDs)
 			// k146 (note): This will double-count any shared AND-prepreqs.
-			iNumSteps = findPathLength(ePreReq, bCost);
+			iNumSteps = findPathLength(ePreReq, bCost, aiMemo); // advc.003al
 
 			//	If the prereq is a valid tech and its the current shortest, mark it as such
 			if (iNumSteps < iShortestPath)
@@ -13032,7 +13098,10 @@ int CvPlayer::findPathLength(TechTypes eTech, bool bCost) const
 		iPathLength += iShortestPath;
 	}
 
-	return (iPathLength + ((bCost) ? GET_TEAM(getTeam()).getResearchCost(eTech) : 1));
+	// <advc.003al>
+	int r = iPathLength + ((bCost) ? GET_TEAM(getTeam()).getResearchCost(eTech) : 1);
+	aiMemo[eTech] = r;
+	return r; // </advc.003al>
 }
 
 
@@ -13340,6 +13409,7 @@ CvCity* CvPlayer::addCity()
 void CvPlayer::deleteCity(int iID)
 {
 	m_cities.removeAt(iID);
+	getWPAI.invalidateTurnCache(); // advc.003z
 }
 
 
@@ -13567,7 +13637,7 @@ int CvPlayer::getStartOfTurnMessageLimit() const {
 		return -1;
 	int r = getBugOptionINT("MainInterface__MessageLimit", 3);
 	if(!isOption(PLAYEROPTION_MINIMIZE_POP_UPS) &&
-			GC.getDefineINT("MESSAGE_LIMIT_WITHOUT_MPU") == 0)
+			GC.getDefineINT(CvGlobals::MESSAGE_LIMIT_WITHOUT_MPU) == 0)
 		return -1;
 	return r;
 } // </advc.106b>
@@ -14424,7 +14494,7 @@ int CvPlayer::adjustMissionCostToTeamSize(int iBaseCost, PlayerTypes eTargetPlay
 	if(iOurTeamSize == iTheirTeamSize)
 		return iBaseCost;
 	// Tie it to the tech cost modifier
-	double extraTeamMemberModifier = GC.getDefineINT("TECH_COST_EXTRA_TEAM_MEMBER_MODIFIER") / 100.f;
+	double extraTeamMemberModifier = GC.getDefineINT(CvGlobals::TECH_COST_EXTRA_TEAM_MEMBER_MODIFIER) / 100.f;
 	/* <dlph.33> "New formula for espionage costs in team. Essentially, I want costs
 		to scale with 1+0.5(number of members - 1), but since there are two teams
 		(and two directions) involved, it will scale with the square root of the
@@ -14889,13 +14959,13 @@ int CvPlayer::getEspionageMissionCostModifier(EspionageMissionTypes eMission, Pl
 	if (pCity != NULL && (eMission == NO_ESPIONAGEMISSION || GC.getEspionageMissionInfo(eMission).isTargetsCity()))
 	{
 		// City Population
-		iModifier *= 100 + (GC.getDefineINT("ESPIONAGE_CITY_POP_EACH_MOD") * (pCity->getPopulation() - 1));
+		iModifier *= 100 + (GC.getDefineINT(CvGlobals::ESPIONAGE_CITY_POP_EACH_MOD) * (pCity->getPopulation() - 1));
 		iModifier /= 100;
 
 		// Trade Route
 		if (pCity->isTradeRoute(getID()))
 		{
-			iModifier *= 100 + GC.getDefineINT("ESPIONAGE_CITY_TRADE_ROUTE_MOD");
+			iModifier *= 100 + GC.getDefineINT(CvGlobals::ESPIONAGE_CITY_TRADE_ROUTE_MOD);
 			iModifier /= 100;
 		}
 
@@ -14909,12 +14979,12 @@ int CvPlayer::getEspionageMissionCostModifier(EspionageMissionTypes eMission, Pl
 			{
 				if (GET_PLAYER(eTargetPlayer).getStateReligion() != eReligion)
 				{
-					iReligionModifier += GC.getDefineINT("ESPIONAGE_CITY_RELIGION_STATE_MOD");
+					iReligionModifier += GC.getDefineINT(CvGlobals::ESPIONAGE_CITY_RELIGION_STATE_MOD);
 				}
 
 				if (hasHolyCity(eReligion))
 				{
-					iReligionModifier += GC.getDefineINT("ESPIONAGE_CITY_HOLY_CITY_MOD");
+					iReligionModifier += GC.getDefineINT(CvGlobals::ESPIONAGE_CITY_HOLY_CITY_MOD);
 				}
 			}
 
@@ -14925,7 +14995,7 @@ int CvPlayer::getEspionageMissionCostModifier(EspionageMissionTypes eMission, Pl
 
 		// City's culture affects cost
 		/* original bts code
-		iModifier *= 100 - (pCity->getCultureTimes100(getID()) * GC.getDefineINT("ESPIONAGE_CULTURE_MULTIPLIER_MOD")) / std::max(1, pCity->getCultureTimes100(eTargetPlayer) + pCity->getCultureTimes100(getID()));
+		iModifier *= 100 - (pCity->getCultureTimes100(getID()) * GC.getDefineINT(CvGlobals::ESPIONAGE_CULTURE_MULTIPLIER_MOD)) / std::max(1, pCity->getCultureTimes100(eTargetPlayer) + pCity->getCultureTimes100(getID()));
 		iModifier /= 100; */
 
 		iModifier *= 100 + pCity->getEspionageDefenseModifier();
@@ -14937,7 +15007,7 @@ int CvPlayer::getEspionageMissionCostModifier(EspionageMissionTypes eMission, Pl
 		// K-Mod. Culture Mod. (Based on plot culture rather than city culture.)
 		if (eMission == NO_ESPIONAGEMISSION || GC.getEspionageMissionInfo(eMission).isSelectPlot() || GC.getEspionageMissionInfo(eMission).isTargetsCity())
 		{
-			iModifier *= 100 - (pPlot->getCulture(getID()) * GC.getDefineINT("ESPIONAGE_CULTURE_MULTIPLIER_MOD")) / std::max(1, pPlot->getCulture(eTargetPlayer) + pPlot->getCulture(getID()));
+			iModifier *= 100 - (pPlot->getCulture(getID()) * GC.getDefineINT(CvGlobals::ESPIONAGE_CULTURE_MULTIPLIER_MOD)) / std::max(1, pPlot->getCulture(eTargetPlayer) + pPlot->getCulture(getID()));
 			iModifier /= 100;
 		}
 		// K-Mod end
@@ -14963,14 +15033,14 @@ int CvPlayer::getEspionageMissionCostModifier(EspionageMissionTypes eMission, Pl
 			}
 		}
 
-		iModifier *= (iDistance + GC.getMapINLINE().maxPlotDistance()) * GC.getDefineINT("ESPIONAGE_DISTANCE_MULTIPLIER_MOD") / GC.getMapINLINE().maxPlotDistance();
+		iModifier *= (iDistance + GC.getMapINLINE().maxPlotDistance()) * GC.getDefineINT(CvGlobals::ESPIONAGE_DISTANCE_MULTIPLIER_MOD) / GC.getMapINLINE().maxPlotDistance();
 		iModifier /= 100;
 	}
 
 	// Spy presence mission cost alteration
 	if (NULL != pSpyUnit)
 	{
-		iModifier *= 100 - (pSpyUnit->getFortifyTurns() * GC.getDefineINT("ESPIONAGE_EACH_TURN_UNIT_COST_DECREASE"));
+		iModifier *= 100 - (pSpyUnit->getFortifyTurns() * GC.getDefineINT(CvGlobals::ESPIONAGE_EACH_TURN_UNIT_COST_DECREASE));
 		iModifier /= 100;
 	}
 
@@ -14978,7 +15048,7 @@ int CvPlayer::getEspionageMissionCostModifier(EspionageMissionTypes eMission, Pl
 	/* original bts code
 	int iTargetPoints = kTargetTeam.getEspionagePointsEver();
 	int iOurPoints = GET_TEAM(getTeam()).getEspionagePointsEver();
-		iModifier *= (GC.getDefineINT("ESPIONAGE_SPENDING_MULTIPLIER") * (2 * iTargetPoints + iOurPoints)) / std::max(1, iTargetPoints + 2 * iOurPoints);
+		iModifier *= (GC.getDefineINT(CvGlobals::ESPIONAGE_SPENDING_MULTIPLIER) * (2 * iTargetPoints + iOurPoints)) / std::max(1, iTargetPoints + 2 * iOurPoints);
 		iModifier /= 100;
 	} */
 	// K-Mod. use the dedicated function that exists for this modifier, for consistency.
@@ -15210,7 +15280,7 @@ bool CvPlayer::doEspionageMission(EspionageMissionTypes eMission, PlayerTypes eT
 				int iCultureAmount = kMission.getCityInsertCultureAmountFactor() * pCity->countTotalCultureTimes100();
 				iCultureAmount /= 10000;
 				iCultureAmount = std::max(1, iCultureAmount);
-				int iNumTurnsApplied = (GC.getDefineINT("GREAT_WORKS_CULTURE_TURNS") * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getUnitGreatWorkPercent()) / 100;
+				int iNumTurnsApplied = (GC.getDefineINT(CvGlobals::GREAT_WORKS_CULTURE_TURNS) * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getUnitGreatWorkPercent()) / 100;
 				for (int i = 0; i < iNumTurnsApplied; ++i)
 					pCity->changeCulture(getID(), iCultureAmount / iNumTurnsApplied, true, true);
 				if (iNumTurnsApplied > 0)
@@ -15356,7 +15426,7 @@ bool CvPlayer::doEspionageMission(EspionageMissionTypes eMission, PlayerTypes eT
 			int iCivic = iExtraData;
 			szBuffer = gDLL->getText("TXT_KEY_ESPIONAGE_TARGET_SWITCH_CIVIC", GC.getCivicInfo((CivicTypes) iCivic).getDescription()).GetCString();
 			GET_PLAYER(eTargetPlayer).setCivics((CivicOptionTypes) GC.getCivicInfo((CivicTypes) iCivic).getCivicOptionType(), (CivicTypes) iCivic);
-			GET_PLAYER(eTargetPlayer).setRevolutionTimer(std::max(1, ((100 + GET_PLAYER(eTargetPlayer).getAnarchyModifier()) * GC.getDefineINT("MIN_REVOLUTION_TURNS")) / 100));
+			GET_PLAYER(eTargetPlayer).setRevolutionTimer(std::max(1, ((100 + GET_PLAYER(eTargetPlayer).getAnarchyModifier()) * GC.getDefineINT(CvGlobals::MIN_REVOLUTION_TURNS)) / 100));
 			bSomethingHappened = true;
 		}
 	}
@@ -15372,7 +15442,7 @@ bool CvPlayer::doEspionageMission(EspionageMissionTypes eMission, PlayerTypes eT
 			int iReligion = iExtraData;
 			szBuffer = gDLL->getText("TXT_KEY_ESPIONAGE_TARGET_SWITCH_RELIGION", GC.getReligionInfo((ReligionTypes) iReligion).getDescription()).GetCString();
 			GET_PLAYER(eTargetPlayer).setLastStateReligion((ReligionTypes) iReligion);
-			GET_PLAYER(eTargetPlayer).setConversionTimer(std::max(1, ((100 + GET_PLAYER(eTargetPlayer).getAnarchyModifier()) * GC.getDefineINT("MIN_CONVERSION_TURNS")) / 100));
+			GET_PLAYER(eTargetPlayer).setConversionTimer(std::max(1, ((100 + GET_PLAYER(eTargetPlayer).getAnarchyModifier()) * GC.getDefineINT(CvGlobals::MIN_CONVERSION_TURNS)) / 100));
 			bSomethingHappened = true;
 		}
 	}
@@ -16122,7 +16192,7 @@ int CvPlayer::getAdvancedStartUnitCost(UnitTypes eUnit, bool bAdd, CvPlot* pPlot
 	{
 		CvCity* pCity = NULL;
 
-		if (0 == GC.getDefineINT("ADVANCED_START_ALLOW_UNITS_OUTSIDE_CITIES"))
+		if (0 == GC.getDefineINT(CvGlobals::ADVANCED_START_ALLOW_UNITS_OUTSIDE_CITIES))
 		{
 			pCity = pPlot->getPlotCity();
 
@@ -16148,7 +16218,7 @@ int CvPlayer::getAdvancedStartUnitCost(UnitTypes eUnit, bool bAdd, CvPlot* pPlot
 
 		if (bAdd)
 		{
-			int iMaxUnitsPerCity = GC.getDefineINT("ADVANCED_START_MAX_UNITS_PER_CITY");
+			int iMaxUnitsPerCity = GC.getDefineINT(CvGlobals::ADVANCED_START_MAX_UNITS_PER_CITY);
 			if (iMaxUnitsPerCity >= 0)
 			{
 				if (GC.getUnitInfo(eUnit).isMilitarySupport() && getNumMilitaryUnits() >= iMaxUnitsPerCity * getNumCities())
@@ -16294,7 +16364,7 @@ int CvPlayer::getAdvancedStartCityCost(bool bAdd, CvPlot* pPlot) const
 		}
 
 		// Is there a distance limit on how far a city can be placed from a player's start/another city?
-		if (GC.getDefineINT("ADVANCED_START_CITY_PLACEMENT_MAX_RANGE") > 0)
+		if (GC.getDefineINT(CvGlobals::ADVANCED_START_CITY_PLACEMENT_MAX_RANGE) > 0)
 		{
 			PlayerTypes eClosestPlayer = NO_PLAYER;
 			int iClosestDistance = MAX_INT;
@@ -16310,7 +16380,7 @@ int CvPlayer::getAdvancedStartCityCost(bool bAdd, CvPlot* pPlot) const
 					if (NULL != pStartingPlot)
 					{
 						int iDistance = ::plotDistance(pPlot->getX_INLINE(), pPlot->getY_INLINE(), pStartingPlot->getX_INLINE(), pStartingPlot->getY_INLINE());
-						if (iDistance <= GC.getDefineINT("ADVANCED_START_CITY_PLACEMENT_MAX_RANGE"))
+						if (iDistance <= GC.getDefineINT(CvGlobals::ADVANCED_START_CITY_PLACEMENT_MAX_RANGE))
 						{
 							if (iDistance < iClosestDistance || (iDistance == iClosestDistance && getTeam() != kPlayer.getTeam()))
 							{
@@ -16336,7 +16406,7 @@ int CvPlayer::getAdvancedStartCityCost(bool bAdd, CvPlot* pPlot) const
 	}
 
 	// Increase cost if the XML defines that additional units will cost more
-	if (0 != GC.getDefineINT("ADVANCED_START_CITY_COST_INCREASE"))
+	if (0 != GC.getDefineINT(CvGlobals::ADVANCED_START_CITY_COST_INCREASE))
 	{
 		if (!bAdd)
 		{
@@ -16345,7 +16415,7 @@ int CvPlayer::getAdvancedStartCityCost(bool bAdd, CvPlot* pPlot) const
 
 		if (iNumCities > 0)
 		{
-			iCost *= 100 + GC.getDefineINT("ADVANCED_START_CITY_COST_INCREASE") * iNumCities;
+			iCost *= 100 + GC.getDefineINT(CvGlobals::ADVANCED_START_CITY_COST_INCREASE) * iNumCities;
 			iCost /= 100;
 		}
 	} // <advc.250c>
@@ -16372,7 +16442,7 @@ int CvPlayer::getAdvancedStartPopCost(bool bAdd, CvCity* pCity) const
 		return -1;
 	}
 
-	int iCost = (getGrowthThreshold(1) * GC.getDefineINT("ADVANCED_START_POPULATION_COST")) / 100;
+	int iCost = (getGrowthThreshold(1) * GC.getDefineINT(CvGlobals::ADVANCED_START_POPULATION_COST)) / 100;
 
 	if (NULL != pCity)
 	{
@@ -16388,22 +16458,22 @@ int CvPlayer::getAdvancedStartPopCost(bool bAdd, CvCity* pCity) const
 		{
 			--iPopulation;
 
-			if (iPopulation < GC.getDefineINT("INITIAL_CITY_POPULATION") + GC.getEraInfo(GC.getGameINLINE().getStartEra()).getFreePopulation())
+			if (iPopulation < GC.getDefineINT(CvGlobals::INITIAL_CITY_POPULATION) + GC.getEraInfo(GC.getGameINLINE().getStartEra()).getFreePopulation())
 			{
 				return -1;
 			}
 		}
 
-		iCost = (getGrowthThreshold(iPopulation) * GC.getDefineINT("ADVANCED_START_POPULATION_COST")) / 100;
+		iCost = (getGrowthThreshold(iPopulation) * GC.getDefineINT(CvGlobals::ADVANCED_START_POPULATION_COST)) / 100;
 
 		// Increase cost if the XML defines that additional Pop will cost more
-		if (0 != GC.getDefineINT("ADVANCED_START_POPULATION_COST_INCREASE"))
+		if (0 != GC.getDefineINT(CvGlobals::ADVANCED_START_POPULATION_COST_INCREASE))
 		{
 			--iPopulation;
 
 			if (iPopulation > 0)
 			{
-				iCost *= 100 + GC.getDefineINT("ADVANCED_START_POPULATION_COST_INCREASE") * iPopulation;
+				iCost *= 100 + GC.getDefineINT(CvGlobals::ADVANCED_START_POPULATION_COST_INCREASE) * iPopulation;
 				iCost /= 100;
 			}
 		}
@@ -16419,7 +16489,7 @@ int CvPlayer::getAdvancedStartCultureCost(bool bAdd, CvCity* pCity) const
 {	// <advc.003>
 	if(getNumCities() == 0)
 		return -1;
-	int iCost = GC.getDefineINT("ADVANCED_START_CULTURE_COST");
+	int iCost = GC.getDefineINT(CvGlobals::ADVANCED_START_CULTURE_COST);
 	if(iCost < 0)
 		return -1;
 	if(pCity == NULL)
@@ -16572,7 +16642,7 @@ int CvPlayer::getAdvancedStartRouteCost(RouteTypes eRoute, bool bAdd, CvPlot* pP
 	int iCost = GC.getRouteInfo(eRoute).getAdvancedStartCost();
 
 	// <advc.250c>
-	iCost *= GC.getDefineINT("ADVANCED_START_WORKER_BUILD_MODIFIER");
+	iCost *= GC.getDefineINT(CvGlobals::ADVANCED_START_WORKER_BUILD_MODIFIER);
 	iCost /= 100; // </advc.250c>
 
 	// This denotes cities may not be purchased through Advanced Start
@@ -16675,7 +16745,7 @@ int CvPlayer::getAdvancedStartImprovementCost(ImprovementTypes eImprovement, boo
 	int iCost = GC.getImprovementInfo(eImprovement).getAdvancedStartCost();
 
 	// <advc.250c>
-	iCost *= GC.getDefineINT("ADVANCED_START_WORKER_BUILD_MODIFIER");
+	iCost *= GC.getDefineINT(CvGlobals::ADVANCED_START_WORKER_BUILD_MODIFIER);
 	iCost /= 100; // </advc.250c>
 	// This denotes cities may not be purchased through Advanced Start
 	if (iCost < 0)
@@ -16928,7 +16998,7 @@ int CvPlayer::getAdvancedStartVisibilityCost(bool bAdd, CvPlot* pPlot) const
 		return -1;
 
 	int iNumVisiblePlots = 0;
-	int iCost = GC.getDefineINT("ADVANCED_START_VISIBILITY_COST");
+	int iCost = GC.getDefineINT(CvGlobals::ADVANCED_START_VISIBILITY_COST);
 	// This denotes Visibility may not be purchased through Advanced Start
 	if (iCost == -1)
 		return -1;
@@ -16947,7 +17017,7 @@ int CvPlayer::getAdvancedStartVisibilityCost(bool bAdd, CvPlot* pPlot) const
 	}
 
 	// Increase cost if the XML defines that additional units will cost more
-	if (GC.getDefineINT("ADVANCED_START_VISIBILITY_COST_INCREASE") != 0)
+	if (GC.getDefineINT(CvGlobals::ADVANCED_START_VISIBILITY_COST_INCREASE) != 0)
 	{
 		int iPlotLoop = 0;
 		for (iPlotLoop = 0; iPlotLoop < GC.getMapINLINE().numPlots(); iPlotLoop++)
@@ -16967,7 +17037,7 @@ int CvPlayer::getAdvancedStartVisibilityCost(bool bAdd, CvPlot* pPlot) const
 		iNumVisiblePlots -= NUM_CITY_PLOTS; // advc.210c
 		if (iNumVisiblePlots > 0)
 		{
-			iCost *= 100 + GC.getDefineINT("ADVANCED_START_VISIBILITY_COST_INCREASE") * iNumVisiblePlots;
+			iCost *= 100 + GC.getDefineINT(CvGlobals::ADVANCED_START_VISIBILITY_COST_INCREASE) * iNumVisiblePlots;
 			iCost /= 100;
 		}
 	}
@@ -17039,7 +17109,7 @@ void CvPlayer::verifyGoldCommercePercent()
 {
 	/* original bts code
 	while ((getGold() + calculateGoldRate()) < 0) {
-		changeCommercePercent(COMMERCE_GOLD, GC.getDefineINT("COMMERCE_PERCENT_CHANGE_INCREMENTS"));
+		changeCommercePercent(COMMERCE_GOLD, GC.getDefineINT(CvGlobals::COMMERCE_PERCENT_CHANGE_INCREMENTS));
 		if (getCommercePercent(COMMERCE_GOLD) == 100)
 			break;
 	} */
@@ -17047,7 +17117,7 @@ void CvPlayer::verifyGoldCommercePercent()
 	bool bValid = isCommerceFlexible(COMMERCE_GOLD);
 	while (bValid && getCommercePercent(COMMERCE_GOLD) < 100 && getGold() + calculateGoldRate() < 0)
 	{
-		bValid = changeCommercePercent(COMMERCE_GOLD, GC.getDefineINT("COMMERCE_PERCENT_CHANGE_INCREMENTS"));
+		bValid = changeCommercePercent(COMMERCE_GOLD, GC.getDefineINT(CvGlobals::COMMERCE_PERCENT_CHANGE_INCREMENTS));
 	} // K-Mod end
 }
 
@@ -18168,7 +18238,7 @@ void CvPlayer::createGreatPeople(UnitTypes eGreatPersonUnit,
 		incrementGreatPeopleCreated();
 
 		changeGreatPeopleThresholdModifier(
-				GC.getDefineINT("GREAT_PEOPLE_THRESHOLD_INCREASE") *
+				GC.getDefineINT(CvGlobals::GREAT_PEOPLE_THRESHOLD_INCREASE) *
 				((getGreatPeopleCreated() / 10) + 1));
 
 		for (int iI = 0; iI < MAX_PLAYERS; iI++)
@@ -18176,7 +18246,7 @@ void CvPlayer::createGreatPeople(UnitTypes eGreatPersonUnit,
 			if (TEAMID((PlayerTypes)iI) == getTeam())
 			{
 				GET_PLAYER((PlayerTypes)iI).changeGreatPeopleThresholdModifier(
-						GC.getDefineINT("GREAT_PEOPLE_THRESHOLD_INCREASE_TEAM") *
+						GC.getDefineINT(CvGlobals::GREAT_PEOPLE_THRESHOLD_INCREASE_TEAM) *
 						((getGreatPeopleCreated() / 10) + 1));
 			}
 		}
@@ -18187,7 +18257,7 @@ void CvPlayer::createGreatPeople(UnitTypes eGreatPersonUnit,
 		incrementGreatGeneralsCreated();
 
 		changeGreatGeneralsThresholdModifier(
-				GC.getDefineINT("GREAT_GENERALS_THRESHOLD_INCREASE") *
+				GC.getDefineINT(CvGlobals::GREAT_GENERALS_THRESHOLD_INCREASE) *
 				((getGreatGeneralsCreated() / 10) + 1));
 
 		for (int iI = 0; iI < MAX_PLAYERS; iI++)
@@ -18195,7 +18265,7 @@ void CvPlayer::createGreatPeople(UnitTypes eGreatPersonUnit,
 			if (TEAMID((PlayerTypes)iI) == getTeam())
 			{
 				GET_PLAYER((PlayerTypes)iI).changeGreatGeneralsThresholdModifier(
-						GC.getDefineINT("GREAT_GENERALS_THRESHOLD_INCREASE_TEAM") *
+						GC.getDefineINT(CvGlobals::GREAT_GENERALS_THRESHOLD_INCREASE_TEAM) *
 						((getGreatGeneralsCreated() / 10) + 1));
 			}
 		}
@@ -20207,14 +20277,14 @@ void CvPlayer::doEvents()
 		}
 	}
 	bool bNewEventEligible = true;
-	if (GC.getGameINLINE().getElapsedGameTurns() < GC.getDefineINT("FIRST_EVENT_DELAY_TURNS"))
+	if (GC.getGameINLINE().getElapsedGameTurns() < GC.getDefineINT(CvGlobals::FIRST_EVENT_DELAY_TURNS))
 	{
 		bNewEventEligible = false;
 	}
 
 	if (bNewEventEligible)
 	{
-		if (GC.getGameINLINE().getSorenRandNum(GC.getDefineINT("EVENT_PROBABILITY_ROLL_SIDES"), "Global event check") >= GC.getEraInfo(getCurrentEra()).getEventChancePerTurn())
+		if (GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(CvGlobals::EVENT_PROBABILITY_ROLL_SIDES), "Global event check") >= GC.getEraInfo(getCurrentEra()).getEventChancePerTurn())
 		{
 			bNewEventEligible = false;
 		}
@@ -21179,7 +21249,7 @@ bool CvPlayer::splitEmpire(int iAreaId)
 						unit placement into a separate loop. */
 					apAcquiredCities.push_back(pCity);
 				}
-				/*for (int i = 0; i < GC.getDefineINT("COLONY_NUM_FREE_DEFENDERS"); ++i)
+				/*for (int i = 0; i < GC.getDefineINT(CvGlobals::COLONY_NUM_FREE_DEFENDERS); ++i)
 					pCity->initConscriptedUnit();*/ // </advc.104r>
 			}
 		}
@@ -21213,7 +21283,7 @@ bool CvPlayer::splitEmpire(int iAreaId)
 	if(getWPAI.isEnabled())
 		getWPAI.processNewCivInGame(eNewPlayer);
 	for(size_t i = 0; i < apAcquiredCities.size(); i++)
-		for(int j = 0; j < GC.getDefineINT("COLONY_NUM_FREE_DEFENDERS"); j++)
+		for(int j = 0; j < GC.getDefineINT(CvGlobals::COLONY_NUM_FREE_DEFENDERS); j++)
 			apAcquiredCities[i]->initConscriptedUnit();
 	// </advc.104r>
 	/*  <advc.127b> Cut and pasted here b/c I want the announcement to point
@@ -22295,15 +22365,15 @@ int CvPlayer::getNewCityProductionValue() const
 		}
 	}
 
-	iValue *= 100 + GC.getDefineINT("NEW_CITY_BUILDING_VALUE_MODIFIER");
+	iValue *= 100 + GC.getDefineINT(CvGlobals::NEW_CITY_BUILDING_VALUE_MODIFIER);
 	iValue /= 100;
 
-	iValue += (GC.getDefineINT("ADVANCED_START_CITY_COST") * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getGrowthPercent()) / 100;
+	iValue += (GC.getDefineINT(CvGlobals::ADVANCED_START_CITY_COST) * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getGrowthPercent()) / 100;
 
-	int iPopulation = GC.getDefineINT("INITIAL_CITY_POPULATION") + GC.getEraInfo(GC.getGameINLINE().getStartEra()).getFreePopulation();
+	int iPopulation = GC.getDefineINT(CvGlobals::INITIAL_CITY_POPULATION) + GC.getEraInfo(GC.getGameINLINE().getStartEra()).getFreePopulation();
 	for (int i = 1; i <= iPopulation; ++i)
 	{
-		iValue += (getGrowthThreshold(i) * GC.getDefineINT("ADVANCED_START_POPULATION_COST")) / 100;
+		iValue += (getGrowthThreshold(i) * GC.getDefineINT(CvGlobals::ADVANCED_START_POPULATION_COST)) / 100;
 	}
 	// <advc.251>
 	iValue = ::roundToMultiple(iValue *
@@ -22317,11 +22387,11 @@ int CvPlayer::getGrowthThreshold(int iPopulation) const
 {
 	CvGame const& g = GC.getGameINLINE(); // advc.003
 	// <advc.251>
-	int iBaseThreshold = GC.getDefineINT("BASE_CITY_GROWTH_THRESHOLD");
+	int iBaseThreshold = GC.getDefineINT(CvGlobals::BASE_CITY_GROWTH_THRESHOLD);
 	iBaseThreshold = ::round(0.01 * iBaseThreshold * GC.getHandicapInfo(
 			getHandicapType()).getBaseGrowthThresholdPercent());
 	int iThreshold = iBaseThreshold + // </advc.251>
-			(iPopulation * GC.getDefineINT("CITY_GROWTH_MULTIPLIER"));
+			(iPopulation * GC.getDefineINT(CvGlobals::CITY_GROWTH_MULTIPLIER));
 	// <advc.251>
 	int iAIModifier = 100;
 	if(!isHuman()) { // Also apply it to Barbarians
@@ -23052,8 +23122,8 @@ void CvPlayer::getTradeLayerColors(std::vector<NiColorA>& aColors, std::vector<C
 	aColors.resize(m.numPlotsINLINE(), NiColorA(0, 0, 0, 0));
 	aIndicators.clear();
 	// <advc.004z>
-	bool bShowForeign = (GC.getDefineINT("FOREIGN_GROUPS_ON_TRADE_LAYER") > 0);
-	bool bShowCapitalConn = (GC.getDefineINT("CONNECTION_TO_CAPITAL_ON_TRADE_LAYER") > 0);
+	bool bShowForeign = (GC.getDefineINT(CvGlobals::FOREIGN_GROUPS_ON_TRADE_LAYER) > 0);
+	bool bShowCapitalConn = (GC.getDefineINT(CvGlobals::CONNECTION_TO_CAPITAL_ON_TRADE_LAYER) > 0);
 	// </advc.004z>
 	typedef std::map< int, std::vector<int> > PlotGroupMap;
 	PlotGroupMap mapPlotGroups;
@@ -23631,7 +23701,7 @@ const CvArtInfoUnit* CvPlayer::getUnitArtInfo(UnitTypes eUnit, int iMeshGroup) c
 	CivilizationTypes eCivilization = getCivilizationType();
 	if (eCivilization == NO_CIVILIZATION)
 	{
-		eCivilization = (CivilizationTypes) GC.getDefineINT("BARBARIAN_CIVILIZATION");
+		eCivilization = (CivilizationTypes) GC.getDefineINT(CvGlobals::BARBARIAN_CIVILIZATION);
 	}
 	// <advc.001> Redirect the call to the city owner
 	if(gDLL->getInterfaceIFace()->isCityScreenUp())
@@ -23846,7 +23916,7 @@ void CvPlayer::announceEspionageToThirdParties(EspionageMissionTypes eMission, P
 		x = pCapital->getX_INLINE();
 		y = pCapital->getY_INLINE();
 	}
-	if(GC.getDefineINT("ANNOUNCE_ESPIONAGE_REVOLUTION") > 0) {
+	if(GC.getDefineINT(CvGlobals::ANNOUNCE_ESPIONAGE_REVOLUTION) > 0) {
 		for(int i = 0; i < MAX_CIV_PLAYERS; i++) {
 			CvPlayer const& kObs = GET_PLAYER((PlayerTypes)i);
 			if(kObs.isAlive() && kObs.getID() != getID() && kObs.getID() != eTarget &&
@@ -145,6 +145,9 @@ public:
 	//void updateCityPlotYield(); // advc.003j
 	void updateCitySight(bool bIncrement, bool bUpdatePlotGroups);
 	void updateTradeRoutes();
+	/*  advc.003af: The cities that our cities could have trade routes with,
+		grouped by our plot group (all under NULL if plot groups are ignored) */
+	void getTradeRouteCandidates(std::map<CvPlotGroup*,std::vector<CvCity*> >& r) const;
 	void updatePlunder(int iChange, bool bUpdatePlotGroups);
 
 	void updateTimers();
@@ -928,6 +931,7 @@ public:
 	CLLNode<int>* tailGroupCycleNode() const;
 
 	int findPathLength(TechTypes eTech, bool bCost = true) const;																			// Exposed to Python
+	void invalidateTechPathLengthCache() { m_aiTechPathLength.clear(); } // advc.003al
 	int getQueuePosition(TechTypes eTech) const;																											// Exposed to Python
 	DllExport void clearResearchQueue();																												// Exposed to Python
 	DllExport bool pushResearch(TechTypes eTech, bool bClear = false) {													// Exposed to Python
@@ -1396,6 +1400,9 @@ protected:
 
 	bool* m_pabResearchingTech;
 	bool* m_pabLoyalMember;
+	/*  advc.003al: findPathLength without cost. Depends only on the techs
+		of our team and on isResearchingTech. Not serialized. */
+	mutable std::vector<int> m_aiTechPathLength;
 
 	std::vector<EventTriggerTypes> m_triggersFired;
 	std::vector<AdvCiv4lert*> m_paAlerts; // advc.210
@@ -1476,6 +1483,8 @@ protected:
 	bool isValidEventTech(TechTypes eTech, EventTypes eEvent, PlayerTypes eOtherPlayer) const;
 
 	void verifyGoldCommercePercent();
+	// advc.003al:
+	int findPathLength(TechTypes eTech, bool bCost, std::vector<int>& aiMemo) const;
 
 	void processCivics(CivicTypes eCivic, int iChange);
 
@@ -7,6 +7,7 @@
 #include "AI_Defines.h" // BBAI
 #include "WarAndPeaceAgent.h" // advc.104
 #include "RiseFall.h" // advc.705
+#include "TurnTimer.h" // advc.003s
 #include "CvMap.h"
 #include "CvDiploParameters.h"
 #include "CvInitCore.h"
@@ -159,7 +160,7 @@ void CvPlayerAI::AI_init()
 	AI_setEspionageWeight(GC.getLeaderHeadInfo(getPersonalityType()).getEspionageWeight()
 			// K-Mod. (I've changed the meaning of this value)
 			*GC.getCommerceInfo(COMMERCE_ESPIONAGE).getAIWeightPercent()/100);
-	//AI_setCivicTimer(((getMaxAnarchyTurns() == 0) ? (GC.getDefineINT("MIN_REVOLUTION_TURNS") * 2) : CIVIC_CHANGE_DELAY) / 2);  // This was commented out by the BtS expansion
+	//AI_setCivicTimer(((getMaxAnarchyTurns() == 0) ? (GC.getDefineINT(CvGlobals::MIN_REVOLUTION_TURNS) * 2) : CIVIC_CHANGE_DELAY) / 2);  // This was commented out by the BtS expansion
 	AI_setReligionTimer(1);
 	AI_setCivicTimer((getMaxAnarchyTurns() == 0) ? 1 : 2);
 	AI_initStrategyRand(); // K-Mod
@@ -291,6 +292,15 @@ void CvPlayerAI::AI_reset(bool bConstructor)
 	m_iAvailableIncome = 0; // K-Mod
 
 	m_aiAICitySites.clear();
+	// <advc.003v>
+	m_missionTargetPlots.clear();
+	m_missionTargetUnits.clear();
+	m_bMissionTargetIndexDirty = false; // </advc.003v>
+	// <advc.003y>
+	m_iFoundValueSerial = -1;
+	m_aiFoundValueInputs.clear();
+	m_aiFoundValueCityInputs.clear();
+	m_aiFoundValueAreaInputs.clear(); // </advc.003y>
 	
 	FAssert(m_aiBonusValue == NULL);
 	m_aiBonusValue = new int[GC.getNumBonusInfos()];
@@ -388,6 +398,10 @@ void CvPlayerAI::updateCacheData()
 void CvPlayerAI::AI_doTurnPre()
 {
 	PROFILE_FUNC();
+	TurnTimer::Scope kTurnTimer(TurnTimer::AI_DO_TURN_PRE); // advc.003s
+	/*  advc.003z: Cached war utilities never outlive the AI turn pass of a
+		player, whatever else the invalidateTurnCache call sites miss. */
+	getWPAI.invalidateTurnCache();
 
 	FAssertMsg(getPersonalityType() != NO_LEADER, "getPersonalityType() is not expected to be equal with NO_LEADER");
 	FAssertMsg(getLeaderType() != NO_LEADER, "getLeaderType() is not expected to be equal with NO_LEADER");
@@ -433,6 +447,7 @@ void CvPlayerAI::AI_doTurnPre()
 void CvPlayerAI::AI_doTurnPost()
 {
 	PROFILE_FUNC();
+	TurnTimer::Scope kTurnTimer(TurnTimer::AI_DO_TURN_POST); // advc.003s
 
 	if (isHuman() || isMinorCiv())
 		return;
@@ -987,10 +1002,18 @@ void CvPlayerAI::AI_updateFoundValues(bool bStartingLoc) {  // advc.003: refacto
 	if(bStartingLoc) {
 		for(int iI = 0; iI < GC.getMapINLINE().numPlotsINLINE(); iI++)
 			GC.getMapINLINE().plotByIndexINLINE(iI)->setFoundValue(getID(), -1);
+		m_iFoundValueSerial = -1; // advc.003y
 		return;
 	}
 
 	CvFoundSettings kFoundSet(*this, false); // K-Mod
+	/*  <advc.003y> Only recompute the found values that could've changed since
+		the previous update. Needs to happen before the city sites from the
+		previous update get cleared. abDirty remains empty if all values need
+		to be recomputed. */
+	std::vector<bool> abDirty;
+	if(!AI_findDirtyFoundValues(kFoundSet, abDirty))
+		abDirty.clear(); // </advc.003y>
 	AI_invalidateCitySites(/*AI_getMinFoundValue()*/-1); // K-Mod
 	// <advc.108>
 	int iCities = getNumCities();
@@ -1006,6 +1029,13 @@ void CvPlayerAI::AI_updateFoundValues(bool bStartingLoc) {  // advc.003: refacto
 			kLoopPlot.setFoundValue(getID(), 0);
 			continue;
 		}
+		// <advc.003y>
+		if(!abDirty.empty() && !abDirty[iI]) {
+			int iValue = kLoopPlot.getFoundValue(getID());
+			if(iValue > kLoopPlot.area()->getBestFoundValue(getID()))
+				kLoopPlot.area()->setBestFoundValue(getID(), iValue);
+			continue;
+		} // </advc.003y>
 		long iValue = -1;
 		if(GC.getUSE_GET_CITY_FOUND_VALUE_CALLBACK()) {
 			CyArgsList argsList;
@@ -1037,6 +1067,220 @@ void CvPlayerAI::AI_updateFoundValues(bool bStartingLoc) {  // advc.003: refacto
 	AI_updateCitySites(AI_getMinFoundValue(), iMaxCityCount);
 }
 
+// advc.003y: Number of entries per city in m_aiFoundValueCityInputs
+#define FOUND_VALUE_CITY_INPUTS 5
+
+/*  advc.003y: Sets abDirty[i] to true for each plot index i whose found value
+	may have changed since the last call to AI_updateFoundValues, i.e. for the
+	plots near journaled plot changes (CvMap::logPlotChange), near cities
+	whose tile assignments have changed and near the city sites chosen in the
+	previous update (AI_recalculateFoundValues). Returns false if all found
+	values need to be recomputed. */
+bool CvPlayerAI::AI_findDirtyFoundValues(CvFoundSettings const& kSet,
+		std::vector<bool>& abDirty) {
+
+	PROFILE_FUNC();
+	CvMap const& m = GC.getMapINLINE();
+	std::vector<int> aiOldInputs;
+	std::vector<int> aiOldCityInputs;
+	std::vector<int> aiOldAreaInputs;
+	m_aiFoundValueInputs.swap(aiOldInputs);
+	m_aiFoundValueCityInputs.swap(aiOldCityInputs);
+	m_aiFoundValueAreaInputs.swap(aiOldAreaInputs);
+	AI_foundValueInputs(kSet, m_aiFoundValueInputs, m_aiFoundValueCityInputs,
+			m_aiFoundValueAreaInputs);
+	int const iLastSerial = m_iFoundValueSerial;
+	m_iFoundValueSerial = m.getPlotChangeSerial();
+	if(iLastSerial < m.getPlotChangeResetSerial() ||
+			m_aiFoundValueInputs != aiOldInputs ||
+			m_aiFoundValueCityInputs.size() != aiOldCityInputs.size() ||
+			m_aiFoundValueAreaInputs.size() != aiOldAreaInputs.size() ||
+			// Python may not be restricted to the vicinity of the site
+			GC.getUSE_GET_CITY_FOUND_VALUE_CALLBACK() ||
+			GC.getUSE_CANNOT_FOUND_CITY_CALLBACK() ||
+			GC.getUSE_CAN_FOUND_CITIES_ON_WATER_CALLBACK())
+		return false;
+
+	abDirty.resize(m.numPlotsINLINE(), false);
+	/*  Most plot changes only matter to sites whose city radius contains the
+		changed plot. Changes that can affect canFound, the bonus deadlock check
+		(AI_countDeadlockedBonuses) or properties that depend on adjacent plots
+		(fresh water, coast) also matter to sites farther away. */
+	int const iWideRange = 2 * GC.getMIN_CITY_RANGE() + CITY_PLOTS_RADIUS + 1;
+	std::vector<std::pair<CvPlot const*,int> > apDirtyCenters;
+	for(int i = 0; i < m.numPlotsINLINE(); i++) {
+		if(m.getPlotChangeSerial(i, true) > iLastSerial)
+			apDirtyCenters.push_back(std::make_pair(m.plotByIndexINLINE(i), iWideRange));
+		else if(m.getPlotChangeSerial(i, false) > iLastSerial)
+			apDirtyCenters.push_back(std::make_pair(m.plotByIndexINLINE(i), CITY_PLOTS_RADIUS));
+	}
+	// AI_recalculateFoundValues has overwritten the values around these
+	for(size_t i = 0; i < m_aiAICitySites.size(); i++) {
+		apDirtyCenters.push_back(std::make_pair(m.plotByIndexINLINE(
+				m_aiAICitySites[i]), 2 * CITY_PLOTS_RADIUS));
+	}
+	/*  Worked tiles and good tiles of cities matter to sites that overlap
+		with the city radius. (The cities themselves are the same as in the
+		previous update; otherwise, aiInputs wouldn't have matched.) */
+	int iCity = 0;
+	for(int i = 0; i < MAX_PLAYERS; i++) {
+		CvPlayer const& kLoopPlayer = GET_PLAYER((PlayerTypes)i);
+		if(!kLoopPlayer.isAlive())
+			continue;
+		int foo=-1;
+		for(CvCity const* c = kLoopPlayer.firstCity(&foo); c != NULL;
+				c = kLoopPlayer.nextCity(&foo)) {
+			bool bChanged = false;
+			for(int j = 0; j < FOUND_VALUE_CITY_INPUTS; j++) {
+				int iIndex = FOUND_VALUE_CITY_INPUTS * iCity + j;
+				if(m_aiFoundValueCityInputs[iIndex] != aiOldCityInputs[iIndex])
+					bChanged = true;
+			}
+			if(bChanged)
+				apDirtyCenters.push_back(std::make_pair(c->plot(), 2 * CITY_PLOTS_RADIUS));
+			iCity++;
+		}
+	}
+	for(size_t i = 0; i < apDirtyCenters.size(); i++) {
+		CvPlot const& kCenter = *apDirtyCenters[i].first;
+		int const iRange = apDirtyCenters[i].second;
+		for(int iDX = -iRange; iDX <= iRange; iDX++) {
+			for(int iDY = -iRange; iDY <= iRange; iDY++) {
+				CvPlot const* p = plotXY(kCenter.getX_INLINE(), kCenter.getY_INLINE(), iDX, iDY);
+				if(p != NULL)
+					abDirty[m.plotNumINLINE(p->getX_INLINE(), p->getY_INLINE())] = true;
+			}
+		}
+	}
+	/*  The number of revealed tiles in an area matters to all sites in that
+		area if no civ has settled there yet */
+	int iArea = 0; int foo=-1;
+	for(CvArea const* a = m.firstArea(&foo); a != NULL; a = m.nextArea(&foo)) {
+		if(m_aiFoundValueAreaInputs[iArea] != aiOldAreaInputs[iArea] &&
+				a->countCivCities() <= 0) {
+			for(int i = 0; i < m.numPlotsINLINE(); i++) {
+				if(m.plotByIndexINLINE(i)->getArea() == a->getID())
+					abDirty[i] = true;
+			}
+		}
+		iArea++;
+	}
+	return true;
+}
+
+/*  advc.003y: Inputs of AI_foundValue_bulk that aren't tied to the plots
+	around the site. If any entry of aiGlobal changes, all found values need
+	to be recomputed. aiCities has FOUND_VALUE_CITY_INPUTS entries per city
+	about the tiles the city works; changes only matter to sites near the
+	city. aiAreas has one entry per area: the number of tiles we've revealed. */
+void CvPlayerAI::AI_foundValueInputs(CvFoundSettings const& kSet,
+		std::vector<int>& aiGlobal, std::vector<int>& aiCities,
+		std::vector<int>& aiAreas) const {
+
+	CvMap const& m = GC.getMapINLINE();
+	CvTeamAI const& kOurTeam = GET_TEAM(getTeam());
+	aiGlobal.push_back(kSet.iBarbDiscouragedRange);
+	aiGlobal.push_back(kSet.iMinRivalRange);
+	aiGlobal.push_back(kSet.bStartingLoc);
+	aiGlobal.push_back(kSet.iClaimThreshold);
+	aiGlobal.push_back(kSet.iGreed);
+	aiGlobal.push_back(kSet.bEasyCulture);
+	aiGlobal.push_back(kSet.bAmbitious);
+	aiGlobal.push_back(kSet.bFinancial);
+	aiGlobal.push_back(kSet.bDefensive);
+	aiGlobal.push_back(kSet.bSeafaring);
+	aiGlobal.push_back(kSet.bExpansive);
+	aiGlobal.push_back(kSet.bAllSeeing);
+	aiGlobal.push_back(kSet.bDebug);
+	aiGlobal.push_back(isHuman());
+	aiGlobal.push_back(GC.getGameINLINE().isFinalInitialized()); // for canFound
+	aiGlobal.push_back(getPersonalityType());
+	aiGlobal.push_back(getNumCities());
+	aiGlobal.push_back(getCurrentEra());
+	aiGlobal.push_back(getCurrentResearch());
+	aiGlobal.push_back(getAdvancedStartPoints());
+	aiGlobal.push_back(kOurTeam.isCapitulated());
+	CvPlot const* pStartPlot = getStartingPlot();
+	aiGlobal.push_back(pStartPlot == NULL ? -1 :
+			m.plotNumINLINE(pStartPlot->getX_INLINE(), pStartPlot->getY_INLINE()));
+	CvCity const* pCapital = getCapitalCity();
+	aiGlobal.push_back(pCapital == NULL ? -1 : pCapital->getID());
+	aiGlobal.push_back(pCapital == NULL ? 0 : pCapital->getBonusGoodHealth());
+	// AI_foundValue_bulk treats the first few turns specially
+	aiGlobal.push_back(std::min(6, GC.getGameINLINE().getElapsedGameTurns()));
+	for(int i = 0; i < MAX_TEAMS; i++) {
+		TeamTypes eLoopTeam = (TeamTypes)i;
+		aiGlobal.push_back((kOurTeam.isHasMet(eLoopTeam) ? 1 : 0) +
+				(kOurTeam.isVassal(eLoopTeam) ? 2 : 0) +
+				(GET_TEAM(eLoopTeam).isVassal(getTeam()) ? 4 : 0));
+	}
+	for(int i = 0; i < GC.getNumTechInfos(); i++)
+		aiGlobal.push_back(kOurTeam.isHasTech((TechTypes)i));
+	for(int i = 0; i < GC.getNumImprovementInfos(); i++) {
+		ImprovementTypes eLoopImprov = (ImprovementTypes)i;
+		aiGlobal.push_back(getImprovementCount(eLoopImprov) > 0);
+		for(int j = 0; j < NUM_YIELD_TYPES; j++)
+			aiGlobal.push_back(kOurTeam.getImprovementYieldChange(eLoopImprov, (YieldTypes)j));
+	}
+	for(int i = 0; i < NUM_YIELD_TYPES; i++)
+		aiGlobal.push_back(getExtraYieldThreshold((YieldTypes)i));
+	for(int i = 0; i < GC.getNumBonusInfos(); i++) {
+		BonusTypes eLoopBonus = (BonusTypes)i;
+		aiGlobal.push_back(getNumAvailableBonuses(eLoopBonus));
+		aiGlobal.push_back(getNumTradeableBonuses(eLoopBonus));
+		aiGlobal.push_back(AI_bonusVal(eLoopBonus, 1));
+		aiGlobal.push_back(AI_bonusVal(eLoopBonus, 1, true));
+		/*  The advc.031 Oil check in AI_foundValue_bulk depends on the plots
+			around all our cities, so it's global to the found values. */
+		bool bCounted = false;
+		if(getNumAvailableBonuses(eLoopBonus) <= 0) { int foo=-1;
+			for(CvCity* c = firstCity(&foo); c != NULL; c = nextCity(&foo)) {
+				if(c->AI_countNumBonuses(eLoopBonus, true, true, -1) > 0) {
+					bCounted = true;
+					break;
+				}
+			}
+		}
+		aiGlobal.push_back(bCounted);
+	}
+	int foo=-1;
+	for(CvArea const* a = m.firstArea(&foo); a != NULL; a = m.nextArea(&foo)) {
+		aiGlobal.push_back(a->getID());
+		aiGlobal.push_back(a->getNumTiles());
+		aiGlobal.push_back(a->getNumStartingPlots());
+		for(int i = 0; i < GC.getNumBonusInfos(); i++)
+			aiGlobal.push_back(a->getNumBonuses((BonusTypes)i));
+		aiAreas.push_back(a->getNumRevealedTiles(getTeam()));
+	}
+	for(int i = 0; i < MAX_PLAYERS; i++) {
+		CvPlayer const& kLoopPlayer = GET_PLAYER((PlayerTypes)i);
+		if(!kLoopPlayer.isAlive())
+			continue;
+		for(CvCity const* c = kLoopPlayer.firstCity(&foo); c != NULL;
+				c = kLoopPlayer.nextCity(&foo)) {
+			aiGlobal.push_back(c->getOwnerINLINE());
+			aiGlobal.push_back(c->getID());
+			aiGlobal.push_back(m.plotNumINLINE(c->getX_INLINE(), c->getY_INLINE()));
+			aiGlobal.push_back(c->getCultureLevel());
+			aiGlobal.push_back(c->isCapital());
+			aiGlobal.push_back(AI_deduceCitySite(c));
+			int iWorked = 0;
+			int iGood = 0;
+			for(int j = 0; j < NUM_CITY_PLOTS; j++) {
+				if(c->isWorkingPlot(j))
+					iWorked |= (1 << j);
+				if(kLoopPlayer.getID() == getID() && c->AI().AI_isGoodPlot(j))
+					iGood |= (1 << j);
+			}
+			aiCities.push_back(iWorked);
+			aiCities.push_back(iGood);
+			aiCities.push_back(c->getPopulation());
+			aiCities.push_back(c->getSpecialistPopulation());
+			aiCities.push_back(kLoopPlayer.getID() == getID() ? c->AI_countGoodPlots() : 0);
+		}
+	}
+}
+
 
 void CvPlayerAI::AI_updateAreaTargets()
 {
@@ -1251,6 +1495,7 @@ int CvPlayerAI::AI_movementPriority(CvSelectionGroup* pGroup) const
 void CvPlayerAI::AI_unitUpdate()
 {
 	PROFILE_FUNC();
+	TurnTimer::Scope kTurnTimer(TurnTimer::AI_UNIT_UPDATE); // advc.003s
 
 	FAssert(m_groupCycle.getLength() == m_selectionGroups.getCount());
 
@@ -2929,13 +3174,15 @@ short CvPlayerAI::AI_foundValue_bulk(int iX, int iY, const CvFoundSettings& kSet
 		treated as if it's within an existing city radius */
 	/*  advc.031: Changed to int in order to store the site id
 		(though it seems I won't need it after all) */
-	std::vector<int> aiCitySiteRadius(NUM_CITY_PLOTS, -1);
+	// advc.003b: Arrays on the stack rather than vectors (heap allocation per plot)
+	int aiCitySiteRadius[NUM_CITY_PLOTS];
+	std::fill_n(aiCitySiteRadius, NUM_CITY_PLOTS, -1);
 	/*  <advc.035>
 		Need to distinguish tiles within the radius of one of our team's cities
 		from those within just any city radius. */
-	std::vector<bool> abOwnCityRadius(NUM_CITY_PLOTS, false);
+	bool abOwnCityRadius[NUM_CITY_PLOTS] = { false };
 	// Whether the tile flips to us once we settle near it
-	std::vector<bool> abFlip(NUM_CITY_PLOTS, false); // </advc.035>
+	bool abFlip[NUM_CITY_PLOTS] = { false }; // </advc.035>
 	// K-Mod. bug fixes etc. (original code deleted)
 	if (!kSet.bStartingLoc &&
 			!kSet.bDebug && // advc.007
@@ -2970,7 +3217,7 @@ short CvPlayerAI::AI_foundValue_bulk(int iX, int iY, const CvFoundSettings& kSet
 	} // K-Mod (bugfixes etc.) end
 	// <advc.035>
 	if(!kSet.bStartingLoc && !isBarbarian()) { // (Also using this for advc.031 now)
-		int foo=-1;
+		/*int foo=-1;
 		for(CvCity* c = firstCity(&foo); c != NULL; c = nextCity(&foo)) {
 			for(int i = 0; i < NUM_CITY_PLOTS; i++) {
 				CvPlot* p = plotCity(iX, iY, i);
@@ -2978,6 +3225,13 @@ short CvPlayerAI::AI_foundValue_bulk(int iX, int iY, const CvFoundSettings& kSet
 						c->getX_INLINE(), c->getY_INLINE()) <= CITY_PLOTS_RADIUS)
 					abOwnCityRadius[i] = true;
 			}
+		}*/
+		/*  advc.003b: The plots maintain a count of the cities of each player
+			whose radius covers them. Same result w/o looping over our cities. */
+		for(int i = 0; i < NUM_CITY_PLOTS; i++) {
+			CvPlot* p = plotCity(iX, iY, i);
+			if(p != NULL && p->isPlayerCityRadius(getID()))
+				abOwnCityRadius[i] = true;
 		}
 		if(GC.getOWN_EXCLUSIVE_RADIUS() > 0) {
 			for(int i = 0; i < NUM_CITY_PLOTS; i++) {
@@ -3154,7 +3408,7 @@ short CvPlayerAI::AI_foundValue_bulk(int iX, int iY, const CvFoundSettings& kSet
 	// <advc.031>
 	int iRiver = 0;
 	int iGreen = 0;
-	std::vector<int> aiPlotValues(NUM_CITY_PLOTS, 0);
+	int aiPlotValues[NUM_CITY_PLOTS] = { 0 }; // advc.003b: was a vector
 	int iStealPercent = 0; // </advc.031>
 	int iYieldLostHere = 0;
 	int iResourceValue = 0;
@@ -3820,7 +4074,7 @@ short CvPlayerAI::AI_foundValue_bulk(int iX, int iY, const CvFoundSettings& kSet
 // END OF PLOT EVALUATION LOOP
 // WEIGHTING OF PLOT VALUES
 	// <advc.031>
-	std::sort(aiPlotValues.begin(), aiPlotValues.end(), std::greater<int>());
+	std::sort(aiPlotValues, aiPlotValues + NUM_CITY_PLOTS, std::greater<int>());
 	// CITY_HOME_PLOT should have 0 value here, others could have negative values.
 	FAssert(aiPlotValues[NUM_CITY_PLOTS - 1] <= 0);
 	/*  advc.test:
@@ -4072,7 +4326,7 @@ short CvPlayerAI::AI_foundValue_bulk(int iX, int iY, const CvFoundSettings& kSet
 	if (pPlot->isFreshWater())
 	{
 		// iValue += 40; // K-Mod (commented this out, compensated by the river bonuses I added.)
-		iValue += (GC.getDefineINT("FRESH_WATER_HEALTH_CHANGE") * 30);
+		iValue += (GC.getDefineINT(CvGlobals::FRESH_WATER_HEALTH_CHANGE) * 30);
 	}
 // END OF NON-YIELD BENEFITS
 // SURROUNDINGS OF STARTING LOCATION
@@ -4948,11 +5202,17 @@ bool CvPlayerAI::AI_getAnyPlotDanger(CvPlot* pPlot, int iRange, bool bTestMoves,
 		if(iRange >= BORDER_DANGER_RANGE && pPlot->getBorderDangerCache(eTeam)) // K-Mod. border danger doesn't count anything further than range 2.
 			return true;
 	}
-
+	/*  <advc.003u> If no potentially hostile unit is in range, only the border
+		check needs to look at the (nearby) plots. */
+	bool bUnitsInRange = (GET_TEAM(eTeam).AI_getHostileUnitDist(*pPlot) <= iRange);
+	int iScanRange = iRange;
+	if(!bUnitsInRange)
+		iScanRange = (bCheckBorder ? std::min(iRange, (int)BORDER_DANGER_RANGE) : -1);
+	// </advc.003u>
 	CvArea* pPlotArea = pPlot->area();
-	for(int iDX = -(iRange); iDX <= iRange; iDX++)
+	for(int iDX = -iScanRange; iDX <= iScanRange; iDX++)
 	{
-		for(int iDY = -(iRange); iDY <= iRange; iDY++)
+		for(int iDY = -iScanRange; iDY <= iScanRange; iDY++)
 		{
 			CvPlot* pLoopPlot = plotXY(pPlot->getX_INLINE(), pPlot->getY_INLINE(), iDX, iDY);
 			if(pLoopPlot == NULL)
@@ -5017,6 +5277,8 @@ bool CvPlayerAI::AI_getAnyPlotDanger(CvPlot* pPlot, int iRange, bool bTestMoves,
 					} // K-Mod end
 				}
 			}
+			if(!bUnitsInRange) // advc.003u
+				continue;
 			bool bFirst = true; // advc.128
 			CLLNode<IDInfo>* pUnitNode = pLoopPlot->headUnitNode();
 			while (pUnitNode != NULL)
@@ -5120,12 +5382,33 @@ int CvPlayerAI::AI_getPlotDanger(CvPlot* pPlot, int iRange, bool bTestMoves,
 		return 0;
 	// K-Mod end
 
+	// <advc.003u> See AI_getAnyPlotDanger
+	bool bUnitsInRange = (GET_TEAM(getTeam()).AI_getHostileUnitDist(*pPlot) <= iRange);
+	int iScanRange = iRange;
+	if(!bUnitsInRange)
+		iScanRange = (bCheckBorder ? std::min(iRange, (int)BORDER_DANGER_RANGE) : -1);
+	std::vector<CvUnit*> aPlotUnits; // Moved out of the loop
+	// </advc.003u>
+	/*  <advc.003ak> Units of our own team can't be enemies. Plots that only
+		have units of our team get skipped without checking visibility; the
+		loop below would stop at the first (visible) unit anyway. */
+	CvPlot::UnitOwnerMask uiEnemies = 0;
+	if (eEnemyPlayer != NO_PLAYER)
+		uiEnemies = CvPlot::unitOwnerBit(eEnemyPlayer);
+	else
+	{
+		for (int iI = 0; iI < MAX_PLAYERS; iI++)
+		{
+			if (GET_PLAYER((PlayerTypes)iI).getTeam() != getTeam())
+				uiEnemies |= CvPlot::unitOwnerBit((PlayerTypes)iI);
+		}
+	} // </advc.003ak>
 	CvArea* pPlotArea = pPlot->area();
 	int iBorderDanger = 0;
 	int iCount = 0;
-	for(int iDX = -(iRange); iDX <= iRange; iDX++)
+	for(int iDX = -iScanRange; iDX <= iScanRange; iDX++)
 	{
-		for(int iDY = -(iRange); iDY <= iRange; iDY++)
+		for(int iDY = -iScanRange; iDY <= iScanRange; iDY++)
 		{
 			CvPlot* pLoopPlot = plotXY(pPlot->getX_INLINE(), pPlot->getY_INLINE(), iDX, iDY);
 			if(pLoopPlot == NULL)
@@ -5152,7 +5435,13 @@ int CvPlayerAI::AI_getPlotDanger(CvPlot* pPlot, int iRange, bool bTestMoves,
 						iBorderDanger++;
 				}
 			}
-			std::vector<CvUnit*> aPlotUnits; // advc.104
+			// <advc.003u>
+			if(!bUnitsInRange)
+				continue;
+			// advc.003ak:
+			if((pLoopPlot->getUnitOwners() & uiEnemies) == 0)
+				continue;
+			aPlotUnits.clear(); // </advc.003u>
 			bool bFirst = true; // advc.128
 			CLLNode<IDInfo>* pUnitNode = pLoopPlot->headUnitNode();
 			while (pUnitNode != NULL)
@@ -8595,7 +8884,7 @@ void CvPlayerAI::AI_chooseResearch()
 
 	if(getCurrentResearch() == NO_TECH
 			// advc.156:
-			&& GC.getDefineINT("RESEARCH_MODIFIER_EXTRA_TEAM_MEMBER") > -5) {
+			&& GC.getDefineINT(CvGlobals::RESEARCH_MODIFIER_EXTRA_TEAM_MEMBER) > -5) {
 		for(int iPass = 0; iPass < 2; iPass++) {
 			for (int iI = 0; iI < MAX_PLAYERS; iI++) {
 				if(iI == getID())
@@ -8986,7 +9275,11 @@ void CvPlayerAI::AI_updateAttitudeCache(PlayerTypes ePlayer,
 		iAttitude now factors in. */
 	iAttitude += AI_getWarAttitude(ePlayer, iAttitude);
 
-	m_aiAttitudeCache[ePlayer] = range(iAttitude, -100, 100);
+	// <advc.003z>
+	iAttitude = range(iAttitude, -100, 100);
+	if(m_aiAttitudeCache[ePlayer] != iAttitude)
+		getWPAI.invalidateTurnCache(); // </advc.003z>
+	m_aiAttitudeCache[ePlayer] = iAttitude;
 	// <advc.130e>
 	if(bUpdateWorstEnemy)
 		GET_TEAM(getTeam()).AI_updateWorstEnemy(); // </advc.130e>
@@ -8997,6 +9290,8 @@ void CvPlayerAI::AI_changeCachedAttitude(PlayerTypes ePlayer, int iChange)
 {
 	FAssert(ePlayer >= 0 && ePlayer < MAX_PLAYERS);
 	m_aiAttitudeCache[ePlayer] += iChange;
+	if(iChange != 0)
+		getWPAI.invalidateTurnCache(); // advc.003z
 }
 // K-Mod end
 
@@ -9231,7 +9526,7 @@ int CvPlayerAI::AI_getWarAttitude(PlayerTypes ePlayer,
 	if(!::atWar(getTeam(), TEAMID(ePlayer)))
 		return 0; // advc.003
 	// advc.130g: Was hardcoded as iAttitude-=3; no functional change.
-	iAttitude += GC.getDefineINT("AT_WAR_ATTITUDE_CHANGE");
+	iAttitude += GC.getDefineINT(CvGlobals::AT_WAR_ATTITUDE_CHANGE);
 
 	if (GC.getLeaderHeadInfo(getPersonalityType()).getAtWarAttitudeDivisor() != 0)
 	{
@@ -9746,7 +10041,7 @@ int CvPlayerAI::AI_getFirstImpressionAttitude(PlayerTypes ePlayer) const {
 		personalityModifier += h.getAIAttitudeChangePercent() / 100.0; // advc.148
 		/*  advc.104x: Low UWAI_PERSONALITY_PERCENT makes the peace weights and
 			respect values more similar; don't want that to increase the relations bonus. */
-		personalityModifier *= GC.getDefineINT("UWAI_PERSONALITY_PERCENT") / 100.0;
+		personalityModifier *= GC.getDefineINT(CvGlobals::UWAI_PERSONALITY_PERCENT) / 100.0;
 		iAttitude += ::round(personalityModifier);
 		// </advc.130b>
 	}
@@ -10156,7 +10451,7 @@ PlayerVoteTypes CvPlayerAI::AI_diploVote(const VoteSelectionSubData& kVoteData,
 				bool bWinningBig = false;
 				bool bThisPlayerWinning = false;
 
-				int iSuccessScale = GET_PLAYER(kVoteData.ePlayer).getNumMilitaryUnits() * GC.getDefineINT("WAR_SUCCESS_ATTACKING") / 5;
+				int iSuccessScale = GET_PLAYER(kVoteData.ePlayer).getNumMilitaryUnits() * GC.getDefineINT(CvGlobals::WAR_SUCCESS_ATTACKING) / 5;
 				bool const bAggressiveAI = g.isOption(GAMEOPTION_AGGRESSIVE_AI);
 				if (bAggressiveAI)
 				{
@@ -11977,7 +12272,7 @@ int CvPlayerAI::AI_maxGoldTrade(PlayerTypes ePlayer,
 	iResearchBuffer /= 100;
 	iMaxGold = std::min(iMaxGold, getGold() - iResearchBuffer);
 	iMaxGold = std::min(iMaxGold, getGold());
-	iMaxGold -= (iMaxGold % GC.getDefineINT("DIPLOMACY_VALUE_REMAINDER")); */
+	iMaxGold -= (iMaxGold % GC.getDefineINT(CvGlobals::DIPLOMACY_VALUE_REMAINDER)); */
 	
 	// K-Mod. Similar, but with more personality, and with better handling of situations where the AI has lots of spare gold.
 	int iTradePercent = GC.getLeaderHeadInfo(getPersonalityType()).getMaxGoldTradePercent();
@@ -13233,7 +13528,7 @@ return DENIAL_NEVER;
 		return DENIAL_ATTITUDE;
 	if(!bLib && pCity->plot()->calculateCulturePercent(getID()) >
 			// Tbd.: Mention this use of the threshold in a comment in GlobalDefines
-			GC.getDefineINT("CITY_TRADE_CULTURE_THRESH") &&
+			GC.getDefineINT(CvGlobals::CITY_TRADE_CULTURE_THRESH) &&
 			eTowardThem < ATTITUDE_FRIENDLY)
 		return DENIAL_ATTITUDE;
 	return NO_DENIAL;
@@ -15293,6 +15588,8 @@ int CvPlayerAI::AI_adjacentPotentialAttackers(CvPlot* pPlot, bool bTestCanMove)
 		// Replacing the above (negated):
 		if(!kPlotArea.canBeEntered(kFromArea))
 			continue; // </advc.030>
+		if (!pLoopPlot->isAnyUnitOwnedBy(getID()))
+			continue; // advc.003ak
 		CLLNode<IDInfo>* pUnitNode = pLoopPlot->headUnitNode();
 		while (pUnitNode != NULL)
 		{
@@ -15767,6 +16064,50 @@ int CvPlayerAI::AI_plotTargetMissionAIs(CvPlot* pPlot, MissionAITypes* aeMission
 	//PROFILE_FUNC(); // advc.003o
 	int iCount = 0;
 	iClosestTargetRange = MAX_INT;
+	/*  <advc.003v> Look the groups up by mission plot unless that means visiting
+		more plots than we have groups. The range mustn't wrap around the map
+		either; that would visit some plots twice. */
+	if (m_bMissionTargetIndexDirty)
+		AI_rebuildMissionTargetIndex();
+	CvMap const& kMap = GC.getMapINLINE();
+	int iDiameter = 2 * iRange + 1;
+	if (iDiameter * iDiameter < getNumSelectionGroups() &&
+		iDiameter <= kMap.getGridWidthINLINE() && iDiameter <= kMap.getGridHeightINLINE())
+	{
+		for (int iDX = -iRange; iDX <= iRange; iDX++)
+		{
+			for (int iDY = -iRange; iDY <= iRange; iDY++)
+			{
+				CvPlot* pLoopPlot = plotXY(pPlot->getX_INLINE(), pPlot->getY_INLINE(), iDX, iDY);
+				if (pLoopPlot == NULL)
+					continue;
+				MissionTargetIndex::const_iterator it = m_missionTargetPlots.find(
+						kMap.plotNumINLINE(pLoopPlot->getX_INLINE(), pLoopPlot->getY_INLINE()));
+				if (it == m_missionTargetPlots.end())
+					continue;
+				int iDistance = ::stepDistance(pPlot->getX_INLINE(), pPlot->getY_INLINE(),
+						pLoopPlot->getX_INLINE(), pLoopPlot->getY_INLINE());
+				for (size_t i = 0; i < it->second.size(); i++)
+				{
+					CvSelectionGroup* pLoopSelectionGroup = getSelectionGroup(it->second[i]);
+					if (pLoopSelectionGroup == NULL || pLoopSelectionGroup == pSkipSelectionGroup ||
+							pLoopSelectionGroup->AI_getMissionAIPlot() != pLoopPlot)
+						continue;
+					MissionAITypes eGroupMissionAI = pLoopSelectionGroup->AI_getMissionAIType();
+					for (int iMissionAIIndex = 0; iMissionAIIndex < iMissionAICount; iMissionAIIndex++)
+					{
+						if (eGroupMissionAI == aeMissionAI[iMissionAIIndex] || aeMissionAI[iMissionAIIndex] == NO_MISSIONAI)
+						{
+							iCount += pLoopSelectionGroup->getNumUnits();
+							if (iDistance < iClosestTargetRange)
+								iClosestTargetRange = iDistance;
+						}
+					}
+				}
+			}
+		}
+		return iCount;
+	} // </advc.003v>
 
 	int iLoop;
 	for(CvSelectionGroup* pLoopSelectionGroup = firstSelectionGroup(&iLoop); pLoopSelectionGroup; pLoopSelectionGroup = nextSelectionGroup(&iLoop))
@@ -15813,6 +16154,20 @@ int CvPlayerAI::AI_localDefenceStrength(const CvPlot* pDefencePlot, TeamTypes eD
 
 	FAssert(bAtTarget || !bCheckMoves); // it doesn't make much sense to check moves if the defenders are meant to stay put.
 
+	// <advc.003ak> Owners of the units that the loop below counts
+	CvPlot::UnitOwnerMask uiDefenders = 0;
+	for (int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		CvPlayer const& kLoopPlayer = GET_PLAYER((PlayerTypes)iI);
+		if (!kLoopPlayer.isAlive())
+			continue;
+		TeamTypes eLoopTeam = kLoopPlayer.getTeam();
+		if (eLoopTeam == eDefenceTeam
+			|| (eDefenceTeam != NO_TEAM && GET_TEAM(eLoopTeam).isVassal(eDefenceTeam))
+			|| (eDefenceTeam == NO_TEAM && isPotentialEnemy(getTeam(), eLoopTeam)))
+			uiDefenders |= CvPlot::unitOwnerBit(kLoopPlayer.getID());
+	} // </advc.003ak>
+
 	for (int iDX = -iRange; iDX <= iRange; iDX++)
 	{
 		for (int iDY = -iRange; iDY <= iRange; iDY++)
@@ -15821,7 +16176,8 @@ int CvPlayerAI::AI_localDefenceStrength(const CvPlot* pDefencePlot, TeamTypes eD
 			if (pLoopPlot == NULL || !pLoopPlot->isVisible(getTeam(), false))
 				continue;
 
-			CLLNode<IDInfo>* pUnitNode = pLoopPlot->headUnitNode();
+			CLLNode<IDInfo>* pUnitNode = ((pLoopPlot->getUnitOwners() & uiDefenders) == 0 ? NULL : // advc.003ak
+					pLoopPlot->headUnitNode());
 
 			int iPlotTotal = 0;
 			while (pUnitNode != NULL)
@@ -15883,6 +16239,18 @@ int CvPlayerAI::AI_localAttackStrength(const CvPlot* pTargetPlot, TeamTypes eAtt
 
 	int	iTotal = 0;
 
+	// <advc.003ak> Owners of the units that the loop below counts
+	CvPlot::UnitOwnerMask uiAttackers = 0;
+	for (int iI = 0; iI < MAX_PLAYERS; iI++)
+	{
+		CvPlayer const& kLoopPlayer = GET_PLAYER((PlayerTypes)iI);
+		if (!kLoopPlayer.isAlive())
+			continue;
+		TeamTypes eLoopTeam = kLoopPlayer.getTeam();
+		if (eLoopTeam == eAttackTeam || (eAttackTeam == NO_TEAM && atWar(getTeam(), eLoopTeam)))
+			uiAttackers |= CvPlot::unitOwnerBit(kLoopPlayer.getID());
+	} // </advc.003ak>
+
 	for (int iDX = -iRange; iDX <= iRange; iDX++)
 	{
 		for (int iDY = -iRange; iDY <= iRange; iDY++)
@@ -15890,6 +16258,9 @@ int CvPlayerAI::AI_localAttackStrength(const CvPlot* pTargetPlot, TeamTypes eAtt
 			CvPlot* pLoopPlot = plotXY(pTargetPlot->getX_INLINE(), pTargetPlot->getY_INLINE(), iDX, iDY);
 			if (pLoopPlot == NULL || !pLoopPlot->isVisible(getTeam(), false))
 				continue;
+			// advc.003ak:
+			if ((pLoopPlot->getUnitOwners() & uiAttackers) == 0)
+				continue;
 
 			CLLNode<IDInfo>* pUnitNode = pLoopPlot->headUnitNode();
 
@@ -16024,10 +16395,20 @@ int CvPlayerAI::AI_unitTargetMissionAIs(CvUnit* pUnit, MissionAITypes* aeMission
 {
 	PROFILE_FUNC();
 
-	int iCount = 0; int iLoop;
-	for(CvSelectionGroup*  pLoopSelectionGroup = firstSelectionGroup(&iLoop); pLoopSelectionGroup; pLoopSelectionGroup = nextSelectionGroup(&iLoop))
+	int iCount = 0;
+	// <advc.003v> Only visit the groups that the index associates with pUnit
+	FAssert(pUnit != NULL);
+	if (m_bMissionTargetIndexDirty)
+		AI_rebuildMissionTargetIndex();
+	MissionTargetIndex::const_iterator it = m_missionTargetUnits.find(pUnit->getID());
+	if (it == m_missionTargetUnits.end())
+		return 0;
+	std::vector<int> const& aiGroups = it->second;
+	for (size_t iGroup = 0; iGroup < aiGroups.size(); iGroup++)
 	{
-		if (pLoopSelectionGroup == pSkipSelectionGroup ||
+		CvSelectionGroup* pLoopSelectionGroup = getSelectionGroup(aiGroups[iGroup]);
+		if (pLoopSelectionGroup == NULL || // </advc.003v>
+				pLoopSelectionGroup == pSkipSelectionGroup ||
 				pLoopSelectionGroup->AI_getMissionAIUnit() != pUnit)
 			continue;
 
@@ -16156,11 +16537,19 @@ int CvPlayerAI::AI_wakePlotTargetMissionAIs(CvPlot* pPlot, MissionAITypes eMissi
 	FAssert(pPlot != NULL);
 	
 	int iCount = 0;
-
-	int iLoop;
-	for(CvSelectionGroup* pLoopSelectionGroup = firstSelectionGroup(&iLoop); pLoopSelectionGroup; pLoopSelectionGroup = nextSelectionGroup(&iLoop))
+	// <advc.003v>
+	if (m_bMissionTargetIndexDirty)
+		AI_rebuildMissionTargetIndex();
+	MissionTargetIndex::const_iterator it = m_missionTargetPlots.find(
+			GC.getMapINLINE().plotNumINLINE(pPlot->getX_INLINE(), pPlot->getY_INLINE()));
+	if (it == m_missionTargetPlots.end())
+		return 0;
+	std::vector<int> const& aiGroups = it->second;
+	for (size_t iGroup = 0; iGroup < aiGroups.size(); iGroup++)
 	{
-		if (pLoopSelectionGroup != pSkipSelectionGroup)
+		CvSelectionGroup* pLoopSelectionGroup = getSelectionGroup(aiGroups[iGroup]);
+		if (pLoopSelectionGroup != NULL && // </advc.003v>
+				pLoopSelectionGroup != pSkipSelectionGroup)
 		{
 			MissionAITypes eGroupMissionAI = pLoopSelectionGroup->AI_getMissionAIType();
 			if (eMissionAI == NO_MISSIONAI || eMissionAI == eGroupMissionAI)
@@ -16178,6 +16567,58 @@ int CvPlayerAI::AI_wakePlotTargetMissionAIs(CvPlot* pPlot, MissionAITypes eMissi
 	return iCount;
 }
 
+// <advc.003v>
+void CvPlayerAI::AI_updateMissionTargetIndex(int iGroupID, CvPlot const* pPlot, int iUnitID, bool bAdd)
+{
+	if (m_bMissionTargetIndexDirty)
+		return;
+	for (int iPass = 0; iPass < 2; iPass++)
+	{
+		int iKey = -1;
+		if (iPass == 0 && pPlot != NULL)
+			iKey = GC.getMapINLINE().plotNumINLINE(pPlot->getX_INLINE(), pPlot->getY_INLINE());
+		else if (iPass == 1)
+			iKey = iUnitID;
+		if (iKey < 0)
+			continue;
+		MissionTargetIndex& kIndex = (iPass == 0 ? m_missionTargetPlots : m_missionTargetUnits);
+		if (bAdd)
+		{
+			std::vector<int>& aiGroups = kIndex[iKey];
+			if (std::find(aiGroups.begin(), aiGroups.end(), iGroupID) == aiGroups.end())
+				aiGroups.push_back(iGroupID);
+			continue;
+		}
+		MissionTargetIndex::iterator it = kIndex.find(iKey);
+		if (it == kIndex.end())
+			continue;
+		std::vector<int>& aiGroups = it->second;
+		std::vector<int>::iterator pos = std::find(aiGroups.begin(), aiGroups.end(), iGroupID);
+		if (pos != aiGroups.end())
+		{
+			*pos = aiGroups.back();
+			aiGroups.pop_back();
+		}
+		if (aiGroups.empty())
+			kIndex.erase(it);
+	}
+}
+
+void CvPlayerAI::AI_rebuildMissionTargetIndex() const
+{
+	m_missionTargetPlots.clear();
+	m_missionTargetUnits.clear();
+	m_bMissionTargetIndexDirty = false;
+	int iLoop;
+	for (CvSelectionGroup* pLoopSelectionGroup = firstSelectionGroup(&iLoop); pLoopSelectionGroup != NULL; pLoopSelectionGroup = nextSelectionGroup(&iLoop))
+	{
+		CvUnit* pMissionUnit = pLoopSelectionGroup->AI_getMissionAIUnit();
+		const_cast<CvPlayerAI*>(this)->AI_updateMissionTargetIndex(pLoopSelectionGroup->getID(),
+				pLoopSelectionGroup->AI_getMissionAIPlot(),
+				pMissionUnit == NULL ? -1 : pMissionUnit->getID(), true);
+	}
+} // </advc.003v>
+
 // K-Mod, I've added piBestValue, and tidied up some stuff.
 CivicTypes CvPlayerAI::AI_bestCivic(CivicOptionTypes eCivicOption, int* piBestValue) const
 {
@@ -16470,9 +16911,9 @@ int CvPlayerAI::AI_civicValue(CivicTypes eCivic) const
 				}
 				// K-Mod. (What's with all the "losing means we need drafting" mentality in the BBAI code? It's... not the right way to look at it.)
 				// (NOTE: "conscript_population_per_cost" is actually "production_per_conscript_population". The developers didn't know what "per" means.)
-				int iConscriptPop = std::max(1, GC.getUnitInfo(eConscript).getProductionCost() / GC.getDefineINT("CONSCRIPT_POPULATION_PER_COST"));
+				int iConscriptPop = std::max(1, GC.getUnitInfo(eConscript).getProductionCost() / GC.getDefineINT(CvGlobals::CONSCRIPT_POPULATION_PER_COST));
 				int iProductionFactor = 100 * GC.getUnitInfo(eConscript).getProductionCost();
-				iProductionFactor /= iConscriptPop * GC.getDefineINT("CONSCRIPT_POPULATION_PER_COST");
+				iProductionFactor /= iConscriptPop * GC.getDefineINT(CvGlobals::CONSCRIPT_POPULATION_PER_COST);
 				iTempValue *= iProductionFactor;
 				iTempValue /= 100;
 				iTempValue *= std::min(iCities, iMaxConscript*3);
@@ -18278,6 +18719,7 @@ void CvPlayerAI::AI_setMemoryCount(PlayerTypes eAboutPlayer, MemoryTypes eMemory
 	FAssert(iValue >= 0);
 	int iAttitude = AI_getMemoryAttitude(eAboutPlayer, eMemoryType); // K-Mod
 	m_aaiMemoryCount[eAboutPlayer][eMemoryType] = iValue;
+	getWPAI.invalidateTurnCache(); // advc.003z
 	AI_changeCachedAttitude(eAboutPlayer, AI_getMemoryAttitude(eAboutPlayer, eMemoryType) - iAttitude); // K-Mod
 }
 
@@ -18324,7 +18766,7 @@ void CvPlayerAI::AI_rememberEvent(PlayerTypes ePlayer, MemoryTypes eMemoryType)
 		delta--; // </advc.130f>
 	AI_changeMemoryCount(ePlayer, eMemoryType, delta);
 	// <advc.130l>
-	if(GC.getDefineINT("ENABLE_130L") <= 0)
+	if(GC.getDefineINT(CvGlobals::ENABLE_130L) <= 0)
 		return;
 	int const iPairs = 6;
 	MemoryTypes coupledRequests[iPairs][2] = {
@@ -18604,7 +19046,7 @@ void CvPlayerAI::AI_doCounter()  // advc.003: style changes
 		}
 	}
 
-	int iBaseWarAttitude = GC.getDefineINT("AT_WAR_ATTITUDE_CHANGE"); // advc.130g
+	int iBaseWarAttitude = GC.getDefineINT(CvGlobals::AT_WAR_ATTITUDE_CHANGE); // advc.130g
 	for (iI = 0; iI < MAX_CIV_PLAYERS; iI++)
 	{
 		PlayerTypes eCiv = (PlayerTypes)iI; 
@@ -18819,7 +19261,7 @@ void CvPlayerAI::AI_doCommerce()
 		return;
 	}
 
-	const static int iCommerceIncrement = GC.getDefineINT("COMMERCE_PERCENT_CHANGE_INCREMENTS");
+	const static int iCommerceIncrement = GC.getDefineINT(CvGlobals::COMMERCE_PERCENT_CHANGE_INCREMENTS);
 	CvTeamAI& kTeam = GET_TEAM(getTeam());
 
 	int iGoldTarget = AI_goldTarget();
@@ -19173,7 +19615,7 @@ void CvPlayerAI::AI_doCommerce()
 		{
 			if (eStealTechMission != NO_ESPIONAGEMISSION)
 			{
-				iMinModifier *= 100 - GC.getDefineINT("MAX_FORTIFY_TURNS") * GC.getDefineINT("ESPIONAGE_EACH_TURN_UNIT_COST_DECREASE");
+				iMinModifier *= 100 - GC.getDefineINT(CvGlobals::MAX_FORTIFY_TURNS) * GC.getDefineINT(CvGlobals::ESPIONAGE_EACH_TURN_UNIT_COST_DECREASE);
 				iMinModifier /= 100;
 				iMinModifier *= 100 + GC.getEspionageMissionInfo(eStealTechMission).getBuyTechCostFactor();
 				iMinModifier /= 100;
@@ -19464,7 +19906,7 @@ void CvPlayerAI::AI_doCivics()
 	if (canRevolution(&aeBestCivic[0]))
 	{
 		revolution(&aeBestCivic[0]);
-		AI_setCivicTimer((getMaxAnarchyTurns() == 0) ? (GC.getDefineINT("MIN_REVOLUTION_TURNS") * 2) : CIVIC_CHANGE_DELAY);
+		AI_setCivicTimer((getMaxAnarchyTurns() == 0) ? (GC.getDefineINT(CvGlobals::MIN_REVOLUTION_TURNS) * 2) : CIVIC_CHANGE_DELAY);
 	}
 }
 
@@ -19516,7 +19958,7 @@ void CvPlayerAI::AI_doReligion()
 			if (gPlayerLogLevel > 0) 
 				logBBAI("    %S decides to convert to %S (value: %d vs %d)", getCivilizationDescription(0), GC.getReligionInfo(eBestReligion).getDescription(0), eBestReligion == NO_RELIGION ? 0 : AI_religionValue(eBestReligion), getStateReligion() == NO_RELIGION ? 0 : AI_religionValue(getStateReligion()));
 			convert(eBestReligion);
-			AI_setReligionTimer((getMaxAnarchyTurns() == 0) ? (GC.getDefineINT("MIN_CONVERSION_TURNS") * 2) : RELIGION_CHANGE_DELAY);
+			AI_setReligionTimer((getMaxAnarchyTurns() == 0) ? (GC.getDefineINT(CvGlobals::MIN_CONVERSION_TURNS) * 2) : RELIGION_CHANGE_DELAY);
 		}
 	}
 }
@@ -19671,7 +20113,7 @@ bool CvPlayerAI::AI_doDeals(PlayerTypes eOther) {
 // <advc.026>
 int CvPlayerAI::AI_maxGoldTradeGenerous(PlayerTypes eTo) const {
 
-	double multiplier = 1 + GC.getDefineINT("AI_OFFER_EXTRA_GOLD_PERCENT") / 100.0;
+	double multiplier = 1 + GC.getDefineINT(CvGlobals::AI_OFFER_EXTRA_GOLD_PERCENT) / 100.0;
 	int r = ::round(AI_maxGoldTrade(eTo) * multiplier);
 	r = std::min(getGold(), r);
 	return std::max(0, r - (r % GC.getDIPLOMACY_VALUE_REMAINDER()));
@@ -19680,7 +20122,7 @@ int CvPlayerAI::AI_maxGoldTradeGenerous(PlayerTypes eTo) const {
 int CvPlayerAI::AI_maxGoldPerTurnTradeGenerous(PlayerTypes eTo) const {
 
 	double r = AI_maxGoldPerTurnTrade(eTo);
-	double multiplier = 1 + GC.getDefineINT("AI_OFFER_EXTRA_GOLD_PERCENT") / 100.0;
+	double multiplier = 1 + GC.getDefineINT(CvGlobals::AI_OFFER_EXTRA_GOLD_PERCENT) / 100.0;
 	r *= multiplier;
 	return std::max(0, ::round(r));
 }
@@ -21388,6 +21830,8 @@ double CvPlayerAI::AI_amortizationMultiplier(int iDelay) const {
 void CvPlayerAI::read(FDataStreamBase* pStream)
 {
 	CvPlayer::read(pStream);	// read base class data first
+	m_bMissionTargetIndexDirty = true; // advc.003v
+	m_iFoundValueSerial = -1; // advc.003y
 
 	uint uiFlag=0;
 	pStream->Read(&uiFlag);	// flags for expansion
@@ -21898,7 +22342,7 @@ int CvPlayerAI::AI_eventValue(EventTypes eEvent, const EventTriggeredData& kTrig
 		iValue += kEvent.getFoodPercent() / 4;
 		iValue += kEvent.getPopulationChange() * 30;
 		iValue -= kEvent.getRevoltTurns() * (12 + iCityPopulation * 16);
-		iValue -= (kEvent.getHurryAnger() * 6 * GC.getDefineINT("HURRY_ANGER_DIVISOR") * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getHurryConscriptAngerPercent()) / 100;
+		iValue -= (kEvent.getHurryAnger() * 6 * GC.getDefineINT(CvGlobals::HURRY_ANGER_DIVISOR) * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getHurryConscriptAngerPercent()) / 100;
 		iValue += kEvent.getHappyTurns() * 10;
 		iValue += kEvent.getCulture() / 2;
 	}
@@ -21913,7 +22357,7 @@ int CvPlayerAI::AI_eventValue(EventTypes eEvent, const EventTriggeredData& kTrig
 		iValue += (kEvent.getFood() * iNumCities);
 		iValue += (kEvent.getFoodPercent() * iNumCities) / 4;
 		iValue += (kEvent.getPopulationChange() * iNumCities * 40);
-		iValue -= (iNumCities * kEvent.getHurryAnger() * 6 * GC.getDefineINT("HURRY_ANGER_DIVISOR") * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getHurryConscriptAngerPercent()) / 100;
+		iValue -= (iNumCities * kEvent.getHurryAnger() * 6 * GC.getDefineINT(CvGlobals::HURRY_ANGER_DIVISOR) * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getHurryConscriptAngerPercent()) / 100;
 		iValue += iNumCities * kEvent.getHappyTurns() * 10;
 		iValue += iNumCities * kEvent.getCulture() / 2;
 	}
@@ -22442,7 +22886,7 @@ int CvPlayerAI::AI_calculateCultureVictoryStage(  // advc.003: a few style chang
 {
 	PROFILE_FUNC();
 
-	if(GC.getDefineINT("BBAI_VICTORY_STRATEGY_CULTURE") <= 0
+	if(GC.getDefineINT(CvGlobals::BBAI_VICTORY_STRATEGY_CULTURE) <= 0
 			&& !isHuman()) // advc.115
 		return 0;
 
@@ -22674,7 +23118,7 @@ int CvPlayerAI::AI_calculateCultureVictoryStage(  // advc.003: a few style chang
 int CvPlayerAI::AI_calculateSpaceVictoryStage() const
 {
 	if(!isHuman() && // advc.115
-			GC.getDefineINT("BBAI_VICTORY_STRATEGY_SPACE") <= 0 )
+			GC.getDefineINT(CvGlobals::BBAI_VICTORY_STRATEGY_SPACE) <= 0 )
 		return 0;
 
 	if (getCapitalCity() == NULL)
@@ -22864,7 +23308,7 @@ int CvPlayerAI::AI_calculateConquestVictoryStage() const
 
 	// check for validity of conquest victory
 	if (GC.getGameINLINE().isOption(GAMEOPTION_ALWAYS_PEACE) || kTeam.isAVassal() ||
-			(GC.getDefineINT("BBAI_VICTORY_STRATEGY_CONQUEST") <= 0 &&
+			(GC.getDefineINT(CvGlobals::BBAI_VICTORY_STRATEGY_CONQUEST) <= 0 &&
 			!isHuman())) // advc.115
 		return 0;
 
@@ -23044,7 +23488,7 @@ int CvPlayerAI::AI_calculateDominationVictoryStage() const
 	if (isAVassal())
 		return 0;
 
-	if (GC.getDefineINT("BBAI_VICTORY_STRATEGY_DOMINATION") <= 0
+	if (GC.getDefineINT(CvGlobals::BBAI_VICTORY_STRATEGY_DOMINATION) <= 0
 			&& !isHuman()) // advc.115
 		return 0;
 
@@ -23139,7 +23583,7 @@ int CvPlayerAI::AI_calculateDiplomacyVictoryStage() const
 {
 	//int iValue = 0; // advc.115b
 	CvGame const& g = GC.getGameINLINE(); // advc.003
-	if (GC.getDefineINT("BBAI_VICTORY_STRATEGY_DIPLOMACY") <= 0
+	if (GC.getDefineINT(CvGlobals::BBAI_VICTORY_STRATEGY_DIPLOMACY) <= 0
 			&& !isHuman()) // advc.115
 		return 0;
 	// <advc.115c>
@@ -23789,7 +24233,7 @@ void CvPlayerAI::AI_updateStrategyHash()
 		// Are we losing badly or recently attacked?
 		if( iWarSuccessRating < -50 || iMaxWarCounter < 10 )
 		{
-			if( kTeam.AI_getEnemyPowerPercent(true) > std::max(150, GC.getDefineINT("BBAI_TURTLE_ENEMY_POWER_RATIO")) 
+			if( kTeam.AI_getEnemyPowerPercent(true) > std::max(150, GC.getDefineINT(CvGlobals::BBAI_TURTLE_ENEMY_POWER_RATIO)) 
 					// advc.107
 					&& getNumMilitaryUnits() < (5 + getCurrentEra() * 1.5) * getNumCities())
 				m_iStrategyHash |= AI_STRATEGY_TURTLE;
@@ -24492,7 +24936,7 @@ void CvPlayerAI::AI_updateGreatPersonWeights()
 			continue;
 
 		/* I've disabled the validity check, because 'invalid' specialists still affect the value of the things that enable them.
-		bool bValid = isSpecialistValid((SpecialistTypes)i) || i == GC.getDefineINT("DEFAULT_SPECIALIST");
+		bool bValid = isSpecialistValid((SpecialistTypes)i) || i == GC.getDefineINT(CvGlobals::DEFAULT_SPECIALIST);
 		int iLoop; // moved.
 		for (CvCity* pLoopCity = firstCity(&iLoop); pLoopCity && !bValid; pLoopCity = nextCity(&iLoop)) {
 			if (pLoopCity->getMaxSpecialistCount((SpecialistTypes)i) > 0) {
@@ -26038,8 +26482,8 @@ void CvPlayerAI::AI_doAdvancedStart(bool bNoExit)
 	//int iRevealPoints = (iStartingPoints * 10) / 100;
 	// <advc.250c> Replacing the above
 	int iRevealPoints = ::round((1.5 *
-			GC.getDefineINT("ADVANCED_START_VISIBILITY_COST") *
-			GC.getDefineINT("ADVANCED_START_VISIBILITY_COST_INCREASE")) / 100.0);
+			GC.getDefineINT(CvGlobals::ADVANCED_START_VISIBILITY_COST) *
+			GC.getDefineINT(CvGlobals::ADVANCED_START_VISIBILITY_COST_INCREASE)) / 100.0);
 	// </advc.250c>
 	int iMilitaryPoints = (iStartingPoints * (isHuman() ? 17 : (10 + (GC.getLeaderHeadInfo(getPersonalityType()).getBuildUnitProb() / 3)))) / 100;
 	int iCityPoints = iStartingPoints - (iMilitaryPoints + iRevealPoints);
@@ -26075,7 +26519,7 @@ void CvPlayerAI::AI_doAdvancedStart(bool bNoExit)
 					{
 						CvPlot* pPlot = GC.getMapINLINE().plotByIndex(iPlotLoop);
 
-						if (plotDistance(pPlot->getX_INLINE(), pPlot->getY_INLINE(), pStartingPlot->getX_INLINE(), pStartingPlot->getY_INLINE()) <= GC.getDefineINT("ADVANCED_START_SIGHT_RANGE"))
+						if (plotDistance(pPlot->getX_INLINE(), pPlot->getY_INLINE(), pStartingPlot->getX_INLINE(), pStartingPlot->getY_INLINE()) <= GC.getDefineINT(CvGlobals::ADVANCED_START_SIGHT_RANGE))
 						{
 							pPlot->setRevealed(getTeam(), true, false, NO_TEAM, false);
 						}
@@ -26399,7 +26843,7 @@ int CvPlayerAI::AI_getMinFoundValue() const
 {
 	PROFILE_FUNC();
 	//int iValue = 600;
-	int iValue = GC.getDefineINT("BBAI_MINIMUM_FOUND_VALUE"); // K-Mod
+	int iValue = GC.getDefineINT(CvGlobals::BBAI_MINIMUM_FOUND_VALUE); // K-Mod
 	//int iNetCommerce = 1 + getCommerceRate(COMMERCE_GOLD) + getCommerceRate(COMMERCE_RESEARCH) + std::max(0, getGoldPerTurn());
 	int iNetCommerce = AI_getAvailableIncome(); // K-Mod
 	int iNetExpenses = calculateInflatedCosts() + std::max(0, -getGoldPerTurn());
@@ -323,6 +323,8 @@ public:
 	int AI_enemyTargetMissionAIs(MissionAITypes eMissionAI, CvSelectionGroup* pSkipSelectionGroup = NULL) const;
 	int AI_enemyTargetMissionAIs(MissionAITypes* aeMissionAI, int iMissionAICount, CvSelectionGroup* pSkipSelectionGroup = NULL) const;
 	int AI_wakePlotTargetMissionAIs(CvPlot* pPlot, MissionAITypes eMissionAI, CvSelectionGroup* pSkipSelectionGroup = NULL) const;
+	// advc.003v: Keeps the mission target index in sync; for CvSelectionGroupAI::AI_setMissionAI.
+	void AI_updateMissionTargetIndex(int iGroupID, CvPlot const* pPlot, int iUnitID, bool bAdd);
 	// K-Mod start
 	int AI_localDefenceStrength(const CvPlot* pDefencePlot, TeamTypes eDefenceTeam, DomainTypes eDomainType = DOMAIN_LAND, int iRange = 0, bool bAtTarget = true, bool bCheckMoves = false, bool bNoCache = false) const;
 	int AI_localAttackStrength(const CvPlot* pTargetPlot, TeamTypes eAttackTeam, DomainTypes eDomainType = DOMAIN_LAND, int iRange = 2, bool bUseTarget = true, bool bCheckMoves = false, bool bCheckCanAttack = false,
@@ -670,6 +672,29 @@ protected:
 	int** m_aaiMemoryCount;
 
 	std::vector<int> m_aiAICitySites;
+	/*  <advc.003v> IDs of our selection groups by mission plot (plot index) and by
+		mission unit (unit ID; units of different players can share a key).
+		Entries are verified against the groups when queried. Not serialized;
+		rebuilt upon the first query after loading (once all units exist). */
+	typedef stdext::hash_map<int,std::vector<int> > MissionTargetIndex;
+	mutable MissionTargetIndex m_missionTargetPlots;
+	mutable MissionTargetIndex m_missionTargetUnits;
+	mutable bool m_bMissionTargetIndexDirty;
+	void AI_rebuildMissionTargetIndex() const;
+	// </advc.003v>
+	/*  <advc.003y> Map change serial (CvMap::getPlotChangeSerial) as of our
+		last update of found values; -1 if all found values are out of date.
+		And the inputs of AI_foundValue that don't belong to any particular
+		plot, as of that update. Not serialized. */
+	int m_iFoundValueSerial;
+	std::vector<int> m_aiFoundValueInputs;
+	std::vector<int> m_aiFoundValueCityInputs;
+	std::vector<int> m_aiFoundValueAreaInputs;
+	bool AI_findDirtyFoundValues(CvFoundSettings const& kSet,
+			std::vector<bool>& abDirty);
+	void AI_foundValueInputs(CvFoundSettings const& kSet, std::vector<int>& aiGlobal,
+			std::vector<int>& aiCities, std::vector<int>& aiAreas) const;
+	// </advc.003y>
 
 	bool m_bWasFinancialTrouble;
 	int m_iTurnLastProductionDirty;
@@ -8,6 +8,7 @@
 #include "CvArtFileMgr.h"
 #include "CyArgsList.h"
 #include "CvEventReporter.h"
+#include "WarAndPeaceAI.h" // advc.003z
 #include "FAStarNode.h" // BETTER_BTS_AI_MOD, General AI, 11/30/08, jdog5000
 #include "CvDLLFAStarIFaceBase.h"
 #include "CvDLLPythonIFaceBase.h"
@@ -137,6 +138,7 @@ void CvPlot::uninit()
 	}
 
 	m_units.clear();
+	m_uiUnitOwners = 0; // advc.003ak
 }
 
 // FUNCTION: reset()
@@ -522,7 +524,7 @@ void CvPlot::updateFog()
 		}
 		else
 		{
-			int cityScreenFogEnabled = GC.getDefineINT("CITY_SCREEN_FOG_ENABLED");
+			int cityScreenFogEnabled = GC.getDefineINT(CvGlobals::CITY_SCREEN_FOG_ENABLED);
 			if (cityScreenFogEnabled && gDLL->getInterfaceIFace()->isCityScreenUp() && (gDLL->getInterfaceIFace()->getHeadSelectedCity() != getWorkingCity()))
 			{
 				gDLL->getEngineIFace()->DarkenVisibility(getFOWIndex());
@@ -652,7 +654,7 @@ void CvPlot::updateSymbols()
 
 	if(maxYield>0)
 	{
-		int maxYieldStack = GC.getDefineINT("MAX_YIELD_STACK");
+		int maxYieldStack = GC.getDefineINT(CvGlobals::MAX_YIELD_STACK);
 		int layers = maxYield /maxYieldStack + 1;
 		
 		CvSymbol *pSymbol= NULL;
@@ -953,10 +955,10 @@ void CvPlot::nukeExplosion(int iRange, CvUnit* pNukeUnit, bool bBomb)
 				{
 					if (NO_FEATURE == pLoopPlot->getFeatureType() || !GC.getFeatureInfo(pLoopPlot->getFeatureType()).isNukeImmune())
 					{
-						if (GC.getGameINLINE().getSorenRandNum(100, "Nuke Fallout") < GC.getDefineINT("NUKE_FALLOUT_PROB"))
+						if (GC.getGameINLINE().getSorenRandNum(100, "Nuke Fallout") < GC.getDefineINT(CvGlobals::NUKE_FALLOUT_PROB))
 						{
 							pLoopPlot->setImprovementType(NO_IMPROVEMENT);
-							pLoopPlot->setFeatureType((FeatureTypes)(GC.getDefineINT("NUKE_FEATURE")));
+							pLoopPlot->setFeatureType((FeatureTypes)(GC.getDefineINT(CvGlobals::NUKE_FEATURE)));
 						}
 					}
 				}
@@ -998,7 +1000,7 @@ void CvPlot::nukeExplosion(int iRange, CvUnit* pNukeUnit, bool bBomb)
 						eAttackingTeam == TEAMID(pLoopUnit->getOwnerINLINE())))
 						// </dlph.7>
 				{
-					int iNukeDamage = (GC.getDefineINT("NUKE_UNIT_DAMAGE_BASE") + GC.getGameINLINE().getSorenRandNum(GC.getDefineINT("NUKE_UNIT_DAMAGE_RAND_1"), "Nuke Damage 1") + GC.getGameINLINE().getSorenRandNum(GC.getDefineINT("NUKE_UNIT_DAMAGE_RAND_2"), "Nuke Damage 2"));
+					int iNukeDamage = (GC.getDefineINT(CvGlobals::NUKE_UNIT_DAMAGE_BASE) + GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(CvGlobals::NUKE_UNIT_DAMAGE_RAND_1), "Nuke Damage 1") + GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(CvGlobals::NUKE_UNIT_DAMAGE_RAND_2), "Nuke Damage 2"));
 
 					if (pLoopCity != NULL)
 					{
@@ -1010,15 +1012,15 @@ void CvPlot::nukeExplosion(int iRange, CvUnit* pNukeUnit, bool bBomb)
 					{
 						pLoopUnit->changeDamage(iNukeDamage, ((pNukeUnit != NULL) ? pNukeUnit->getOwnerINLINE() : NO_PLAYER));
 					}
-					//else if (iNukeDamage >= GC.getDefineINT("NUKE_NON_COMBAT_DEATH_THRESHOLD"))
+					//else if (iNukeDamage >= GC.getDefineINT(CvGlobals::NUKE_NON_COMBAT_DEATH_THRESHOLD))
 					// <dlph.20>
 					else if(GC.getGameINLINE().getSorenRandNum(100,
 							"Non-Combat Nuke Rand") * 100 <
 							std::max(0, ((pLoopCity == NULL ? 0 :
 							pLoopCity->getNukeModifier()) + 100)) *
-							(GC.getDefineINT("NUKE_UNIT_DAMAGE_BASE") - 1 +
-							(GC.getDefineINT("NUKE_UNIT_DAMAGE_RAND_1") +
-							GC.getDefineINT("NUKE_UNIT_DAMAGE_RAND_2") - 1) / 2))
+							(GC.getDefineINT(CvGlobals::NUKE_UNIT_DAMAGE_BASE) - 1 +
+							(GC.getDefineINT(CvGlobals::NUKE_UNIT_DAMAGE_RAND_1) +
+							GC.getDefineINT(CvGlobals::NUKE_UNIT_DAMAGE_RAND_2) - 1) / 2))
 							// </dlph.20>
 						pLoopUnit->kill(false, ((pNukeUnit != NULL) ? pNukeUnit->getOwnerINLINE() : NO_PLAYER));
 				}
@@ -1032,7 +1034,7 @@ void CvPlot::nukeExplosion(int iRange, CvUnit* pNukeUnit, bool bBomb)
 					{
 						if (!(GC.getBuildingInfo((BuildingTypes) iI).isNukeImmune()))
 						{
-							if (GC.getGameINLINE().getSorenRandNum(100, "Building Nuked") < GC.getDefineINT("NUKE_BUILDING_DESTRUCTION_PROB"))
+							if (GC.getGameINLINE().getSorenRandNum(100, "Building Nuked") < GC.getDefineINT(CvGlobals::NUKE_BUILDING_DESTRUCTION_PROB))
 							{
 								pLoopCity->setNumRealBuilding(((BuildingTypes)iI), pLoopCity->getNumRealBuilding((BuildingTypes)iI) - 1);
 							}
@@ -1040,7 +1042,7 @@ void CvPlot::nukeExplosion(int iRange, CvUnit* pNukeUnit, bool bBomb)
 					}
 				}
 
-				int iNukedPopulation = ((pLoopCity->getPopulation() * (GC.getDefineINT("NUKE_POPULATION_DEATH_BASE") + GC.getGameINLINE().getSorenRandNum(GC.getDefineINT("NUKE_POPULATION_DEATH_RAND_1"), "Population Nuked 1") + GC.getGameINLINE().getSorenRandNum(GC.getDefineINT("NUKE_POPULATION_DEATH_RAND_2"), "Population Nuked 2"))) / 100);
+				int iNukedPopulation = ((pLoopCity->getPopulation() * (GC.getDefineINT(CvGlobals::NUKE_POPULATION_DEATH_BASE) + GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(CvGlobals::NUKE_POPULATION_DEATH_RAND_1), "Population Nuked 1") + GC.getGameINLINE().getSorenRandNum(GC.getDefineINT(CvGlobals::NUKE_POPULATION_DEATH_RAND_2), "Population Nuked 2"))) / 100);
 
 				iNukedPopulation *= std::max(0, (pLoopCity->getNukeModifier() + 100));
 				iNukedPopulation /= 100;
@@ -1973,7 +1975,7 @@ void CvPlot::updateSight(bool bIncrement, bool bUpdatePlotGroups)
 				CvCity* pHolyCity = GC.getGameINLINE().getHolyCity((ReligionTypes)iI);
 				if (pHolyCity != NULL) {
 					if (GET_PLAYER(pHolyCity->getOwnerINLINE()).getStateReligion() == iI)
-						changeAdjacentSight(pHolyCity->getTeam(), GC.getDefineINT("PLOT_VISIBILITY_RANGE"), bIncrement, NULL, bUpdatePlotGroups);
+						changeAdjacentSight(pHolyCity->getTeam(), GC.getDefineINT(CvGlobals::PLOT_VISIBILITY_RANGE), bIncrement, NULL, bUpdatePlotGroups);
 				}
 			}
 		}*/
@@ -1983,7 +1985,7 @@ void CvPlot::updateSight(bool bIncrement, bool bUpdatePlotGroups)
 		{
 			if (GET_TEAM(getTeam()).isVassal((TeamTypes)iI))
 			{
-				changeAdjacentSight((TeamTypes)iI, GC.getDefineINT("PLOT_VISIBILITY_RANGE"), bIncrement, NULL, bUpdatePlotGroups);
+				changeAdjacentSight((TeamTypes)iI, GC.getDefineINT(CvGlobals::PLOT_VISIBILITY_RANGE), bIncrement, NULL, bUpdatePlotGroups);
 			}
 		}
 
@@ -1993,7 +1995,7 @@ void CvPlot::updateSight(bool bIncrement, bool bUpdatePlotGroups)
 			if (pCity->getEspionageVisibility((TeamTypes)iI))
 			{
 				// Passive Effect: enough EPs gives you visibility into someone's cities
-				changeAdjacentSight((TeamTypes)iI, GC.getDefineINT("PLOT_VISIBILITY_RANGE"), bIncrement, NULL, bUpdatePlotGroups);
+				changeAdjacentSight((TeamTypes)iI, GC.getDefineINT(CvGlobals::PLOT_VISIBILITY_RANGE), bIncrement, NULL, bUpdatePlotGroups);
 			}
 		}
 	}
@@ -2001,7 +2003,7 @@ void CvPlot::updateSight(bool bIncrement, bool bUpdatePlotGroups)
 	// Owned
 	if (isOwned())
 	{
-		changeAdjacentSight(getTeam(), GC.getDefineINT("PLOT_VISIBILITY_RANGE"), bIncrement, NULL, bUpdatePlotGroups);
+		changeAdjacentSight(getTeam(), GC.getDefineINT(CvGlobals::PLOT_VISIBILITY_RANGE), bIncrement, NULL, bUpdatePlotGroups);
 	}
 
 	// Unit
@@ -2015,7 +2017,7 @@ void CvPlot::updateSight(bool bIncrement, bool bUpdatePlotGroups)
 
 	if (getReconCount() > 0)
 	{
-		int iRange = GC.getDefineINT("RECON_VISIBILITY_RANGE");
+		int iRange = GC.getDefineINT(CvGlobals::RECON_VISIBILITY_RANGE);
 		for (int iI = 0; iI < MAX_PLAYERS; ++iI)
 		{
 			int iLoop;
@@ -2033,10 +2035,10 @@ void CvPlot::updateSight(bool bIncrement, bool bUpdatePlotGroups)
 // <advc.003h> Cut and pasted from CvPlot::updateSeeFromSight
 void CvPlot::setMaxVisibilityRangeCache() {
 
-	int iRange = GC.getDefineINT("UNIT_VISIBILITY_RANGE") + 1;
+	int iRange = GC.getDefineINT(CvGlobals::UNIT_VISIBILITY_RANGE) + 1;
 	for(int iPromotion = 0; iPromotion < GC.getNumPromotionInfos(); iPromotion++)
 		iRange += GC.getPromotionInfo((PromotionTypes)iPromotion).getVisibilityChange();
-	iRange = std::max(GC.getDefineINT("RECON_VISIBILITY_RANGE") + 1, iRange);
+	iRange = std::max(GC.getDefineINT(CvGlobals::RECON_VISIBILITY_RANGE) + 1, iRange);
 	iMaxVisibilityRangeCache = iRange;
 } // </advc.003h>
 
@@ -2615,12 +2617,12 @@ int CvPlot::getFeatureProduction(BuildTypes eBuild, TeamTypes eTeam, CvCity** pp
 	iProduction *= GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getFeatureProductionPercent();
 	iProduction /= 100;
 
-	iProduction *= std::min((GC.getDefineINT("BASE_FEATURE_PRODUCTION_PERCENT") + (GC.getDefineINT("FEATURE_PRODUCTION_PERCENT_MULTIPLIER") * (*ppCity)->getPopulation())), 100);
+	iProduction *= std::min((GC.getDefineINT(CvGlobals::BASE_FEATURE_PRODUCTION_PERCENT) + (GC.getDefineINT(CvGlobals::FEATURE_PRODUCTION_PERCENT_MULTIPLIER) * (*ppCity)->getPopulation())), 100);
 	iProduction /= 100;
 
 	if (getTeam() != eTeam)
 	{
-		iProduction *= GC.getDefineINT("DIFFERENT_TEAM_FEATURE_PRODUCTION_PERCENT");
+		iProduction *= GC.getDefineINT(CvGlobals::DIFFERENT_TEAM_FEATURE_PRODUCTION_PERCENT);
 		iProduction /= 100;
 	}
 
@@ -2632,6 +2634,9 @@ CvUnit* CvPlot::getBestDefender(PlayerTypes eOwner, PlayerTypes eAttackingPlayer
 		CvUnit const* pAttacker, bool bTestAtWar, bool bTestPotentialEnemy,
 		bool bTestCanMove, bool bVisible /* advc.028 */) const
 {
+	// <advc.003ak>
+	if (eOwner != NO_PLAYER && !isAnyUnitOwnedBy(eOwner))
+		return NULL; // </advc.003ak>
 	// BETTER_BTS_AI_MOD, Lead From Behind (UncutDragon), 02/21/10, jdog5000
 	int iBestUnitRank = -1;
 	CvUnit* pBestUnit = NULL;
@@ -4257,6 +4262,7 @@ void CvPlot::setArea(int iNewValue) {  // advc.003: style changes
 		processArea(area(), -1);
 	m_iArea = iNewValue;
 	m_pPlotArea = NULL;
+	GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 	if(area() != NULL) {
 		processArea(area(), 1);
 		updateIrrigated();
@@ -4281,7 +4287,7 @@ int CvPlot::getOwnershipDuration() const
 
 bool CvPlot::isOwnershipScore() const
 {
-	return (getOwnershipDuration() >= GC.getDefineINT("OWNERSHIP_SCORE_DURATION_THRESHOLD"));
+	return (getOwnershipDuration() >= GC.getDefineINT(CvGlobals::OWNERSHIP_SCORE_DURATION_THRESHOLD));
 }
 
 
@@ -4423,6 +4429,8 @@ bool CvPlot::isCityRadius() const
 void CvPlot::changeCityRadiusCount(int iChange)
 {
 	m_iCityRadiusCount = (m_iCityRadiusCount + iChange);
+	if(iChange != 0)
+		GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 	FAssert(getCityRadiusCount() >= 0);
 }
 
@@ -4454,6 +4462,7 @@ void CvPlot::setNOfRiver(bool bNewValue, CardinalDirectionTypes eRiverDir)
 	{
 		updatePlotGroupBonus(false);
 		m_bNOfRiver = bNewValue;
+		GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 		updatePlotGroupBonus(true);
 
 		updateRiverCrossing();
@@ -4500,6 +4509,7 @@ void CvPlot::setWOfRiver(bool bNewValue, CardinalDirectionTypes eRiverDir)
 	{
 		updatePlotGroupBonus(false);
 		m_bWOfRiver = bNewValue;
+		GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 		updatePlotGroupBonus(true);
 
 		updateRiverCrossing();
@@ -4707,7 +4717,7 @@ bool CvPlot::isPotentialCityWorkForArea(CvArea* pArea) const
 
 		if (pLoopPlot != NULL)
 		{
-			if (!(pLoopPlot->isWater()) || GC.getDefineINT("WATER_POTENTIAL_CITY_WORK_FOR_AREA"))
+			if (!(pLoopPlot->isWater()) || GC.getDefineINT(CvGlobals::WATER_POTENTIAL_CITY_WORK_FOR_AREA))
 			{
 				if (pLoopPlot->area() == pArea)
 				{
@@ -4814,6 +4824,7 @@ void CvPlot::setOwner(PlayerTypes eNewValue, bool bCheckUnits, bool bUpdatePlotG
 
 	if(getOwnerINLINE() == eNewValue)
 		return; // advc.003
+	getWPAI.invalidateTurnCache(); // advc.003z
 	GC.getGameINLINE().addReplayMessage(REPLAY_MESSAGE_PLOT_OWNER_CHANGE, eNewValue, (char*)NULL, getX_INLINE(), getY_INLINE());
 
 	CvCity* pOldCity = getPlotCity();
@@ -4903,7 +4914,7 @@ void CvPlot::setOwner(PlayerTypes eNewValue, bool bCheckUnits, bool bUpdatePlotG
 
 			if (eBestUnit != NO_UNIT)
 			{
-				int iFreeUnits = (GC.getDefineINT("BASE_REVOLT_FREE_UNITS") + ((pNewCity->getHighestPopulation() * GC.getDefineINT("REVOLT_FREE_UNITS_PERCENT")) / 100));
+				int iFreeUnits = (GC.getDefineINT(CvGlobals::BASE_REVOLT_FREE_UNITS) + ((pNewCity->getHighestPopulation() * GC.getDefineINT(CvGlobals::REVOLT_FREE_UNITS_PERCENT)) / 100));
 
 				for (iI = 0; iI < iFreeUnits; ++iI)
 				{
@@ -4918,7 +4929,7 @@ void CvPlot::setOwner(PlayerTypes eNewValue, bool bCheckUnits, bool bUpdatePlotG
 
 		if (isOwned())
 		{
-			changeAdjacentSight(getTeam(), GC.getDefineINT("PLOT_VISIBILITY_RANGE"), false, NULL, bUpdatePlotGroup);
+			changeAdjacentSight(getTeam(), GC.getDefineINT(CvGlobals::PLOT_VISIBILITY_RANGE), false, NULL, bUpdatePlotGroup);
 
 			if (area())
 			{
@@ -4969,13 +4980,14 @@ void CvPlot::setOwner(PlayerTypes eNewValue, bool bCheckUnits, bool bUpdatePlotG
 		}
 
 		m_eOwner = eNewValue;
+		GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 
 		setWorkingCityOverride(NULL);
 		updateWorkingCity();
 
 		if (isOwned())
 		{
-			changeAdjacentSight(getTeam(), GC.getDefineINT("PLOT_VISIBILITY_RANGE"), true, NULL, bUpdatePlotGroup);
+			changeAdjacentSight(getTeam(), GC.getDefineINT(CvGlobals::PLOT_VISIBILITY_RANGE), true, NULL, bUpdatePlotGroup);
 
 			if (area())
 			{
@@ -5083,7 +5095,10 @@ PlayerTypes CvPlot::getSecondOwner() const {
 
 void CvPlot::setSecondOwner(PlayerTypes eNewValue) {
 
+	if(m_eSecondOwner == eNewValue)
+		return; // advc.003y
 	m_eSecondOwner = (char)eNewValue;
+	GC.getMapINLINE().logPlotChange(*this); // advc.003y
 }
 
 
@@ -5179,6 +5194,7 @@ void CvPlot::setPlotType(PlotTypes eNewValue, bool bRecalculate, bool bRebuildGr
 		updateSeeFromSight(false, true);
 
 		m_ePlotType = eNewValue;
+		GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 
 		updateYield();
 		updatePlotGroup();
@@ -5191,16 +5207,16 @@ void CvPlot::setPlotType(PlotTypes eNewValue, bool bRecalculate, bool bRebuildGr
 			{
 				if (isAdjacentToLand())
 				{
-					setTerrainType(((TerrainTypes)(GC.getDefineINT("SHALLOW_WATER_TERRAIN"))), bRecalculate, bRebuildGraphics);
+					setTerrainType(((TerrainTypes)(GC.getDefineINT(CvGlobals::SHALLOW_WATER_TERRAIN))), bRecalculate, bRebuildGraphics);
 				}
 				else
 				{
-					setTerrainType(((TerrainTypes)(GC.getDefineINT("DEEP_WATER_TERRAIN"))), bRecalculate, bRebuildGraphics);
+					setTerrainType(((TerrainTypes)(GC.getDefineINT(CvGlobals::DEEP_WATER_TERRAIN))), bRecalculate, bRebuildGraphics);
 				}
 			}
 			else
 			{
-				setTerrainType(((TerrainTypes)(GC.getDefineINT("LAND_TERRAIN"))), bRecalculate, bRebuildGraphics);
+				setTerrainType(((TerrainTypes)(GC.getDefineINT(CvGlobals::LAND_TERRAIN))), bRecalculate, bRebuildGraphics);
 			}
 		}
 
@@ -5219,11 +5235,11 @@ void CvPlot::setPlotType(PlotTypes eNewValue, bool bRecalculate, bool bRebuildGr
 					{
 						if (pLoopPlot->isAdjacentToLand())
 						{
-							pLoopPlot->setTerrainType((TerrainTypes)(GC.getDefineINT("SHALLOW_WATER_TERRAIN")), bRecalculate, bRebuildGraphics);
+							pLoopPlot->setTerrainType((TerrainTypes)(GC.getDefineINT(CvGlobals::SHALLOW_WATER_TERRAIN)), bRecalculate, bRebuildGraphics);
 						}
 						else
 						{
-							pLoopPlot->setTerrainType((TerrainTypes)(GC.getDefineINT("DEEP_WATER_TERRAIN")), bRecalculate, bRebuildGraphics);
+							pLoopPlot->setTerrainType((TerrainTypes)(GC.getDefineINT(CvGlobals::DEEP_WATER_TERRAIN)), bRecalculate, bRebuildGraphics);
 						}
 					}
 				}
@@ -5428,6 +5444,7 @@ void CvPlot::setTerrainType(TerrainTypes eNewValue, bool bRecalculate, bool bReb
 	}
 
 	m_eTerrainType = eNewValue;
+	GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 
 	updateYield();
 	updatePlotGroup();
@@ -5494,6 +5511,7 @@ void CvPlot::setFeatureType(FeatureTypes eNewValue, int iVariety)
 
 	m_eFeatureType = eNewValue;
 	m_iFeatureVariety = iVariety;
+	GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 
 	updateYield();
 
@@ -5664,6 +5682,7 @@ void CvPlot::setBonusType(BonusTypes eNewValue)
 
 	updatePlotGroupBonus(false);
 	m_eBonusType = eNewValue;
+	GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 	updatePlotGroupBonus(true);
 
 	if (getBonusType() != NO_BONUS)
@@ -5715,6 +5734,12 @@ void CvPlot::setImprovementType(ImprovementTypes eNewValue)
 
 	updatePlotGroupBonus(false);
 	m_eImprovementType = eNewValue;
+	GC.getMapINLINE().logPlotChange(*this, // advc.003y
+			// advc.003ad: Forts matter to UWAI path distances
+			(eOldImprovement != NO_IMPROVEMENT &&
+			GC.getImprovementInfo(eOldImprovement).isActsAsCity()) ||
+			(eNewValue != NO_IMPROVEMENT &&
+			GC.getImprovementInfo(eNewValue).isActsAsCity()));
 	updatePlotGroupBonus(true);
 
 	if (getImprovementType() == NO_IMPROVEMENT)
@@ -5875,7 +5900,7 @@ void CvPlot::updateCityRoute(bool bUpdatePlotGroup)
 	eCityRoute = GET_PLAYER(getOwnerINLINE()).getBestRoute();
 	if (eCityRoute == NO_ROUTE)
 	{
-		eCityRoute = ((RouteTypes)(GC.getDefineINT("INITIAL_CITY_ROUTE_TYPE")));
+		eCityRoute = ((RouteTypes)(GC.getDefineINT(CvGlobals::INITIAL_CITY_ROUTE_TYPE)));
 	}
 	setRouteType(eCityRoute, bUpdatePlotGroup);
 }
@@ -5924,6 +5949,7 @@ void CvPlot::setPlotCity(CvCity* pNewValue)  // advc.003: style changes
 	if (pNewValue != NULL)
 		m_plotCity = pNewValue->getIDInfo();
 	else m_plotCity.reset();
+	GC.getMapINLINE().logPlotChange(*this, true); // advc.003y
 	if (isCity())
 	{
 		CvPlotGroup* pPlotGroup = getPlotGroup(getOwnerINLINE());
@@ -6032,6 +6058,7 @@ void CvPlot::updateWorkingCity()
 	{
 		m_workingCity.reset();
 	}
+	GC.getMapINLINE().logPlotChange(*this); // advc.003y
 
 	if (pOldWorkingCity != NULL)
 	{
@@ -6490,6 +6517,7 @@ void CvPlot::updateYield()
 
 		int iOldYield = getYield(eYield);
 		m_aiYield[iI] = iNewYield;
+		GC.getMapINLINE().logPlotChange(*this); // advc.003y
 		FAssert(getYield(eYield) >= 0);
 
 		CvCity* pWorkingCity = getWorkingCity();
@@ -6622,6 +6650,7 @@ void CvPlot::setCulture(PlayerTypes eIndex, int iNewValue, bool bUpdate, bool bU
 		m_iTotalCulture += iNewValue - m_aiCulture[eIndex]; // </advc.003b>
 	m_aiCulture[eIndex] = iNewValue;
 	FAssert(getCulture(eIndex) >= 0);
+	GC.getMapINLINE().logPlotChange(*this); // advc.003y
 
 	if(bUpdate)
 		updateCulture(true, bUpdatePlotGroups);
@@ -6756,6 +6785,7 @@ void CvPlot::changePlayerCityRadiusCount(PlayerTypes eIndex, int iChange)
 		m_aiPlayerCityRadiusCount = new char[MAX_PLAYERS](); // advc.003: value-initialize
 
 	m_aiPlayerCityRadiusCount[eIndex] += iChange;
+	GC.getMapINLINE().logPlotChange(*this); // advc.003y
 	FAssert(getPlayerCityRadiusCount(eIndex) >= 0);
 }
 
@@ -7418,6 +7448,7 @@ void CvPlot::setRevealed(TeamTypes eTeam, bool bNewValue, bool bTerrainOnly, Tea
 
 		if (area())
 			area()->changeNumRevealedTiles(eTeam, isRevealed(eTeam, false) ? 1 : -1);
+		GC.getMapINLINE().logPlotChange(*this); // advc.003y
 	} // <advc.124> Need to update plot group if any revealed info changes
 	if (bUpdatePlotGroup &&
 			(bOldValue != bNewValue ||
@@ -7504,7 +7535,7 @@ bool CvPlot::isAdjacentRevealed(TeamTypes eTeam,
 		if (pAdjacentPlot->isRevealed(eTeam, false)
 				// <advc.250c>
 				&& (!bSkipOcean || pAdjacentPlot->getTerrainType() !=
-				(TerrainTypes)GC.getDefineINT("DEEP_WATER_TERRAIN")))
+				(TerrainTypes)GC.getDefineINT(CvGlobals::DEEP_WATER_TERRAIN)))
 				// </advc.250c>
 			return true;
 	}
@@ -8214,7 +8245,11 @@ void CvPlot::addUnit(CvUnit* pUnit, bool bUpdate)
 	{
 		m_units.insertAtEnd(pUnit->getIDInfo());
 	}
-
+	m_uiUnitOwners |= unitOwnerBit(pUnit->getOwnerINLINE()); // advc.003ak
+	// <advc.003u>
+	for (int iI = 0; iI < MAX_TEAMS; iI++)
+		GET_TEAM((TeamTypes)iI).AI_updateHostileUnitDist(*this, *pUnit);
+	// </advc.003u>
 	if (bUpdate)
 	{
 		updateCenterUnit();
@@ -8241,6 +8276,7 @@ void CvPlot::removeUnit(CvUnit* pUnit, bool bUpdate)
 			pUnitNode = nextUnitNode(pUnitNode);
 		}
 	}
+	updateUnitOwners(); // advc.003ak
 
 	if (bUpdate)
 	{
@@ -8251,6 +8287,15 @@ void CvPlot::removeUnit(CvUnit* pUnit, bool bUpdate)
 }
 
 
+// advc.003ak: Only needs the IDInfo, so it also works while loading a game.
+void CvPlot::updateUnitOwners()
+{
+	m_uiUnitOwners = 0;
+	for (CLLNode<IDInfo>* pNode = m_units.head(); pNode != NULL; pNode = m_units.next(pNode))
+		m_uiUnitOwners |= unitOwnerBit(pNode->m_data.eOwner);
+}
+
+
 CLLNode<IDInfo>* CvPlot::nextUnitNode(CLLNode<IDInfo>* pNode) const
 {
 	return m_units.next(pNode);
@@ -8926,6 +8971,7 @@ void CvPlot::read(FDataStreamBase* pStream)
 	}
 
 	m_units.Read(pStream);
+	updateUnitOwners(); // advc.003ak
 }
 
 // write object to a stream
@@ -9249,11 +9295,11 @@ void CvPlot::getVisibleImprovementState(ImprovementTypes& eType, bool& bWorked)
 			{
 				if (isWater())
 				{
-					eType = ((ImprovementTypes)(GC.getDefineINT("WATER_IMPROVEMENT")));
+					eType = ((ImprovementTypes)(GC.getDefineINT(CvGlobals::WATER_IMPROVEMENT)));
 				}
 				else
 				{
-					eType = ((ImprovementTypes)(GC.getDefineINT("LAND_IMPROVEMENT")));
+					eType = ((ImprovementTypes)(GC.getDefineINT(CvGlobals::LAND_IMPROVEMENT)));
 				}
 			}
 		}
@@ -9919,7 +9965,7 @@ int CvPlot::airUnitSpaceAvailable(TeamTypes eTeam) const
 	}
 	else
 	{
-		iMaxUnits = GC.getDefineINT("CITY_AIR_UNIT_CAPACITY");
+		iMaxUnits = GC.getDefineINT(CvGlobals::CITY_AIR_UNIT_CAPACITY);
 	}
 
 	return (iMaxUnits - countNumAirUnits(eTeam));
@@ -543,6 +543,20 @@ public:
 	CLLNode<IDInfo>* prevUnitNode(CLLNode<IDInfo>* pNode) const;
 	DllExport CLLNode<IDInfo>* headUnitNode() const;
 	CLLNode<IDInfo>* tailUnitNode() const;
+	/*  <advc.003ak> Bit i is set iff a unit owned by player i is on this plot.
+		Lets scans over many plots skip unit lists that can't contain any
+		relevant units. */
+	typedef unsigned __int64 UnitOwnerMask;
+	static inline UnitOwnerMask unitOwnerBit(PlayerTypes ePlayer)
+	{
+		FAssert(ePlayer >= 0 && ePlayer < 64);
+		return ((UnitOwnerMask)1) << ePlayer;
+	}
+	inline UnitOwnerMask getUnitOwners() const { return m_uiUnitOwners; }
+	inline bool isAnyUnitOwnedBy(PlayerTypes ePlayer) const
+	{
+		return ((m_uiUnitOwners & unitOwnerBit(ePlayer)) != 0);
+	} // </advc.003ak>
 
 	int getNumSymbols() const;
 	CvSymbol* getSymbol(int iID) const;
@@ -660,6 +674,8 @@ protected:
 	short** m_apaiInvisibleVisibilityCount;
 
 	CLinkList<IDInfo> m_units;
+	UnitOwnerMask m_uiUnitOwners; // advc.003ak: Not serialized
+	void updateUnitOwners(); // advc.003ak
 
 	std::vector<CvSymbol*> m_symbols;
 
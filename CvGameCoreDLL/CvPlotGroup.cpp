@@ -71,12 +71,7 @@ void CvPlotGroup::reset(int iID, PlayerTypes eOwner, bool bConstructorCall)
 
 void CvPlotGroup::addPlot(CvPlot* pPlot)
 {
-	XYCoords xy;
-
-	xy.iX = pPlot->getX_INLINE();
-	xy.iY = pPlot->getY_INLINE();
-
-	insertAtEndPlots(xy);
+	m_plots.push_back(XYCoords(pPlot->getX_INLINE(), pPlot->getY_INLINE()));
 
 	pPlot->setPlotGroup(getOwnerINLINE(), this);
 }
@@ -84,23 +79,18 @@ void CvPlotGroup::addPlot(CvPlot* pPlot)
 
 void CvPlotGroup::removePlot(CvPlot* pPlot)
 {
-	CLLNode<XYCoords>* pPlotNode;
-
-	pPlotNode = headPlotsNode();
-
-	while (pPlotNode != NULL)
+	XYCoords xy(pPlot->getX_INLINE(), pPlot->getY_INLINE());
+	for (size_t i = 0; i < m_plots.size(); i++)
 	{
-		if (GC.getMapINLINE().plotSorenINLINE(pPlotNode->m_data.iX, pPlotNode->m_data.iY) == pPlot)
+		if (m_plots[i] == xy)
 		{
 			pPlot->setPlotGroup(getOwnerINLINE(), NULL);
-
-			pPlotNode = deletePlotsNode(pPlotNode); // can delete this PlotGroup...
+			// advc.003ag: Keep the order; recalculatePlots rebuilds in this order.
+			m_plots.erase(m_plots.begin() + i);
+			if (m_plots.empty())
+				GET_PLAYER(getOwnerINLINE()).deletePlotGroup(getID()); // deletes this
 			break;
 		}
-		else
-		{
-			pPlotNode = nextPlotsNode(pPlotNode);
-		}
 	}
 }
 
@@ -109,72 +99,77 @@ void CvPlotGroup::recalculatePlots()
 {
 	PROFILE_FUNC();
 
-	CLLNode<XYCoords>* pPlotNode;
-	CvPlot* pPlot;
-	CLinkList<XYCoords> oldPlotGroup;
-	XYCoords xy;
-	PlayerTypes eOwner;
-	int iCount;
-
-	eOwner = getOwnerINLINE();
-
-	pPlotNode = headPlotsNode();
-
-	if (pPlotNode != NULL)
-	{
-		pPlot = GC.getMapINLINE().plotSorenINLINE(pPlotNode->m_data.iX, pPlotNode->m_data.iY);
-
-		iCount = 0;
-
-		gDLL->getFAStarIFace()->SetData(&GC.getPlotGroupFinder(), &iCount);
-		gDLL->getFAStarIFace()->GeneratePath(&GC.getPlotGroupFinder(), pPlot->getX_INLINE(), pPlot->getY_INLINE(), -1, -1, false, eOwner);
-
-		if (iCount == getLengthPlots())
-		{
-			return;
-		}
-	}
+	/*  advc.003ag: Flood fill through countConnectedPlots instead of the
+		exe's plot group finder */
+	if (!m_plots.empty() && countConnectedPlots() == getLengthPlots())
+		return;
 
 	{
 		PROFILE("CvPlotGroup::recalculatePlots update");
 
-		oldPlotGroup.clear();
-
-		pPlotNode = headPlotsNode();
-
-		while (pPlotNode != NULL)
+		PlayerTypes eOwner = getOwnerINLINE();
+		CvMap const& kMap = GC.getMapINLINE();
+		// advc.003ag: Copy b/c clearPlots deletes this plot group
+		std::vector<XYCoords> aOldPlots(m_plots);
+		for (size_t i = 0; i < aOldPlots.size(); i++)
 		{
-			PROFILE("CvPlotGroup::recalculatePlots update 1");
-
-			pPlot = GC.getMapINLINE().plotSorenINLINE(pPlotNode->m_data.iX, pPlotNode->m_data.iY);
-
+			CvPlot* pPlot = kMap.plotSorenINLINE(aOldPlots[i].iX, aOldPlots[i].iY);
 			FAssertMsg(pPlot != NULL, "Plot is not assigned a valid value");
-
-			xy.iX = pPlot->getX_INLINE();
-			xy.iY = pPlot->getY_INLINE();
-
-			oldPlotGroup.insertAtEnd(xy);
-
 			pPlot->setPlotGroup(eOwner, NULL);
-
-			pPlotNode = deletePlotsNode(pPlotNode); // will delete this PlotGroup...
 		}
+		clearPlots(); // Can't access any members after this
 
-		pPlotNode = oldPlotGroup.head();
-
-		while (pPlotNode != NULL)
+		for (size_t i = 0; i < aOldPlots.size(); i++)
 		{
-			PROFILE("CvPlotGroup::recalculatePlots update 2");
-
-			pPlot = GC.getMapINLINE().plotSorenINLINE(pPlotNode->m_data.iX, pPlotNode->m_data.iY);
-
-			FAssertMsg(pPlot != NULL, "Plot is not assigned a valid value");
-
+			CvPlot* pPlot = kMap.plotSorenINLINE(aOldPlots[i].iX, aOldPlots[i].iY);
 			pPlot->updatePlotGroup(eOwner, true);
+		}
+	}
+}
+
+/*  advc.003ag: Replacing a flood fill through CvGlobals::getPlotGroupFinder.
+	Steps are valid under the same conditions as in ::plotGroupValid. */
+int CvPlotGroup::countConnectedPlots() const
+{
+	PROFILE_FUNC();
 
-			pPlotNode = oldPlotGroup.deleteNode(pPlotNode);
+	CvMap const& kMap = GC.getMapINLINE();
+	TeamTypes eTeam = TEAMID(getOwnerINLINE());
+	/*  Marks plots visited by the current call. Stamps avoid clearing an
+		array of the size of the map on every call. */
+	static std::vector<int> aiVisited;
+	static int iStamp = 0;
+	if ((int)aiVisited.size() != kMap.numPlotsINLINE())
+	{
+		aiVisited.assign(kMap.numPlotsINLINE(), 0);
+		iStamp = 0;
+	}
+	iStamp++;
+	std::vector<CvPlot*> apQueue;
+	apQueue.reserve(m_plots.size());
+	CvPlot* pStart = kMap.plotSorenINLINE(m_plots[0].iX, m_plots[0].iY);
+	aiVisited[kMap.plotNumINLINE(pStart->getX_INLINE(), pStart->getY_INLINE())] = iStamp;
+	apQueue.push_back(pStart);
+	for (size_t iHead = 0; iHead < apQueue.size(); iHead++)
+	{
+		CvPlot const& kOld = *apQueue[iHead];
+		for (int iI = 0; iI < NUM_DIRECTION_TYPES; iI++)
+		{
+			CvPlot* pNew = plotDirection(kOld.getX_INLINE(), kOld.getY_INLINE(), (DirectionTypes)iI);
+			if (pNew == NULL)
+				continue;
+			int iIndex = kMap.plotNumINLINE(pNew->getX_INLINE(), pNew->getY_INLINE());
+			if (aiVisited[iIndex] == iStamp)
+				continue;
+			if (pNew->getPlotGroup(getOwnerINLINE()) != kOld.getPlotGroup(getOwnerINLINE()) ||
+					!pNew->isTradeNetwork(eTeam) ||
+					!pNew->isTradeNetworkConnected(&kOld, eTeam))
+				continue;
+			aiVisited[iIndex] = iStamp;
+			apQueue.push_back(pNew);
 		}
 	}
+	return (int)apQueue.size();
 }
 
 
@@ -226,20 +221,16 @@ void CvPlotGroup::changeNumBonuses(BonusTypes eBonus, int iChange)
 	// It's an unfortuante side effect of the way the update is implemented. ... and so this assert is invalid.
 	// (This isn't my fault. I haven't changed it. It has always been like this.)
 
-	CLLNode<XYCoords>* pPlotNode = headPlotsNode();
-
-	while (pPlotNode != NULL)
+	/*  advc.003ag: Loop over the owner's cities instead of over all plots of
+		this group. A plot is in m_plots iff its plot group for the owner is
+		this group. */
+	CvPlayer const& kOwner = GET_PLAYER(getOwnerINLINE());
+	int iLoop;
+	for (CvCity* pCity = kOwner.firstCity(&iLoop); pCity != NULL; pCity = kOwner.nextCity(&iLoop))
 	{
-		CvCity* pCity = GC.getMapINLINE().plotSorenINLINE(pPlotNode->m_data.iX, pPlotNode->m_data.iY)->getPlotCity();
-		if (pCity != NULL)
-		{
-			if (pCity->getOwnerINLINE() == getOwnerINLINE())
-			{
-				pCity->changeNumBonuses(eBonus, iChange);
-			}
-		}
-
-		pPlotNode = nextPlotsNode(pPlotNode);
+		// (A city being initialized may not be on its plot yet)
+		if (pCity->plot()->getPlotCity() == pCity && pCity->plotGroup(getOwnerINLINE()) == this)
+			pCity->changeNumBonuses(eBonus, iChange);
 	}
 }
 
@@ -247,54 +238,34 @@ void CvPlotGroup::changeNumBonuses(BonusTypes eBonus, int iChange)
 void CvPlotGroup::verifyCityProduction() {
 
 	PROFILE_FUNC();
-	CvMap const& m = GC.getMapINLINE();
-	CLLNode<XYCoords>* pPlotNode = headPlotsNode();
-	while (pPlotNode != NULL) {
-		CvCity* pCity = m.plotSorenINLINE(pPlotNode->m_data.iX, pPlotNode->m_data.iY)->getPlotCity();
-		if (pCity != NULL && pCity->getOwnerINLINE() == getOwnerINLINE())
+	// advc.003ag: Loop over the owner's cities (as in changeNumBonuses)
+	CvPlayer const& kOwner = GET_PLAYER(getOwnerINLINE());
+	int iLoop;
+	for (CvCity* pCity = kOwner.firstCity(&iLoop); pCity != NULL; pCity = kOwner.nextCity(&iLoop)) {
+		if (pCity->plot()->getPlotCity() == pCity && pCity->plotGroup(getOwnerINLINE()) == this)
 			pCity->verifyProduction();
-		pPlotNode = nextPlotsNode(pPlotNode);
 	}
 } // </advc.064d>
 
-
-void CvPlotGroup::insertAtEndPlots(XYCoords xy)
+// <advc.003ag>
+int CvPlotGroup::getLengthPlots() const
 {
-	m_plots.insertAtEnd(xy);
+	return (int)m_plots.size();
 }
 
 
-CLLNode<XYCoords>* CvPlotGroup::deletePlotsNode(CLLNode<XYCoords>* pNode)
+XYCoords const& CvPlotGroup::getPlotCoords(int iIndex) const
 {
-	CLLNode<XYCoords>* pPlotNode;
-
-	pPlotNode = m_plots.deleteNode(pNode);
-
-	if (getLengthPlots() == 0)
-	{
-		GET_PLAYER(getOwnerINLINE()).deletePlotGroup(getID());
-	}
-
-  return pPlotNode;
+	FAssert(iIndex >= 0 && iIndex < getLengthPlots());
+	return m_plots[iIndex];
 }
 
 
-CLLNode<XYCoords>* CvPlotGroup::nextPlotsNode(CLLNode<XYCoords>* pNode)
+void CvPlotGroup::clearPlots()
 {
-	return m_plots.next(pNode);
-}
-
-
-int CvPlotGroup::getLengthPlots()
-{
-	return m_plots.getLength();
-}
-
-
-CLLNode<XYCoords>* CvPlotGroup::headPlotsNode()
-{
-	return m_plots.head();
-}
+	m_plots.clear();
+	GET_PLAYER(getOwnerINLINE()).deletePlotGroup(getID()); // deletes this
+} // </advc.003ag>
 
 
 void CvPlotGroup::read(FDataStreamBase* pStream)
@@ -312,7 +283,12 @@ void CvPlotGroup::read(FDataStreamBase* pStream)
 	FAssertMsg((0 < GC.getNumBonusInfos()), "GC.getNumBonusInfos() is not greater than zero but an array is being allocated in CvPlotGroup::read");
 	pStream->Read(GC.getNumBonusInfos(), m_paiNumBonuses);
 
-	m_plots.Read(pStream);
+	// <advc.003ag> Same format as CLinkList::Read
+	int iLength;
+	pStream->Read(&iLength);
+	m_plots.resize(iLength);
+	for (int i = 0; i < iLength; i++)
+		pStream->Read(sizeof(XYCoords), (byte*)&m_plots[i]); // </advc.003ag>
 }
 
 
@@ -328,5 +304,8 @@ void CvPlotGroup::write(FDataStreamBase* pStream)
 	FAssertMsg((0 < GC.getNumBonusInfos()), "GC.getNumBonusInfos() is not greater than zero but an array is being allocated in CvPlotGroup::write");
 	pStream->Write(GC.getNumBonusInfos(), m_paiNumBonuses);
 
-	m_plots.Write(pStream);
+	// <advc.003ag> Same format as CLinkList::Write
+	pStream->Write(getLengthPlots());
+	for (size_t i = 0; i < m_plots.size(); i++)
+		pStream->Write(sizeof(XYCoords), (byte*)&m_plots[i]); // </advc.003ag>
 }
@@ -39,11 +39,13 @@ public:
 	void changeNumBonuses(BonusTypes eBonus, int iChange);
 	void verifyCityProduction(); // advc.064d
 
-	void insertAtEndPlots(XYCoords xy);
-	CLLNode<XYCoords>* deletePlotsNode(CLLNode<XYCoords>* pNode);
-	CLLNode<XYCoords>* nextPlotsNode(CLLNode<XYCoords>* pNode);
-	int getLengthPlots();
-	CLLNode<XYCoords>* headPlotsNode();
+	/*  <advc.003ag> The plot list is a flat array now. The CLinkList node
+		functions are gone. */
+	int getLengthPlots() const;
+	XYCoords const& getPlotCoords(int iIndex) const;
+	/*  Empties the plot list without updating the plots and deletes this
+		plot group (as deleting the last plot node used to do). */
+	void clearPlots(); // </advc.003ag>
 
 	// for serialization
 	void read(FDataStreamBase* pStream);
@@ -57,7 +59,9 @@ protected:
 
 	int* m_paiNumBonuses;
 
-	CLinkList<XYCoords> m_plots;
+	std::vector<XYCoords> m_plots; // advc.003ag: was CLinkList
+	// advc.003ag: Number of plots connected to the first plot
+	int countConnectedPlots() const;
 };
 
 #endif
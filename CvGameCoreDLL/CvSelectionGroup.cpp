@@ -86,6 +86,7 @@ void CvSelectionGroup::kill()
 	FAssertMsg(getNumUnits() == 0, "The number of units is expected to be 0");
 
 	GET_PLAYER(getOwnerINLINE()).removeGroupCycle(getID());
+	AI_setMissionAI(NO_MISSIONAI, NULL, NULL); // advc.003v: Update the owner's index
 
 	GET_PLAYER(getOwnerINLINE()).deleteSelectionGroup(getID());
 }
@@ -175,7 +176,7 @@ void CvSelectionGroup::doTurn()
 	{
 		if (pHeadUnit->isSpy() && pHeadUnit->plot()->getTeam() != getTeam())
 		{
-			if (pHeadUnit->getFortifyTurns() == GC.getDefineINT("MAX_FORTIFY_TURNS")-1)
+			if (pHeadUnit->getFortifyTurns() == GC.getDefineINT(CvGlobals::MAX_FORTIFY_TURNS)-1)
 			{
 				setActivityType(ACTIVITY_AWAKE); // time to wake up!
 			}
@@ -273,7 +274,7 @@ void CvSelectionGroup::doTurn()
 				CvUnit* pLoopUnit = ::getUnit(pUnitNode->m_data);
 				pUnitNode = nextUnitNode(pUnitNode);
 
-				int iWaitTurns = (GC.getDefineINT("MIN_TIMER_UNIT_DOUBLE_MOVES") - (GC.getGameINLINE().getTurnSlice() - pLoopUnit->getLastMoveTurn()));
+				int iWaitTurns = (GC.getDefineINT(CvGlobals::MIN_TIMER_UNIT_DOUBLE_MOVES) - (GC.getGameINLINE().getTurnSlice() - pLoopUnit->getLastMoveTurn()));
 
 				if (iWaitTurns > iBestWaitTurns)
 				{
@@ -346,10 +347,10 @@ bool CvSelectionGroup::showMoves(/* advc.102: */ CvPlot const& kFromPlot) const
 		bool bInSpectatorsBorders = ((eFromOwner != NO_PLAYER &&
 				eObs == TEAMID(eFromOwner)) || (eToOwner != NO_PLAYER &&
 				eObs == TEAMID(eToOwner)));
-		bool bShowWorkers = GC.getDefineINT("SHOW_FRIENDLY_WORKER_MOVES"),
-			 bShowShips = GC.getDefineINT("SHOW_FRIENDLY_SEA_MOVES"),
+		bool bShowWorkers = GC.getDefineINT(CvGlobals::SHOW_FRIENDLY_WORKER_MOVES),
+			 bShowShips = GC.getDefineINT(CvGlobals::SHOW_FRIENDLY_SEA_MOVES),
 			// Also refers to Executives; those have the same Unit AI.
-			 bShowMissionaries = GC.getDefineINT("SHOW_FRIENDLY_MISSIONARY_MOVES");
+			 bShowMissionaries = GC.getDefineINT(CvGlobals::SHOW_FRIENDLY_MISSIONARY_MOVES);
 		bool bEnteringOrLeaving = (plot()->isVisible(eObs, false) != kFromPlot.isVisible(eObs, false));
 		bool bSeaPatrol = (getDomainType() == DOMAIN_SEA &&
 				AI_getMissionAIType() == MISSIONAI_PATROL);
@@ -780,6 +780,10 @@ void CvSelectionGroupAI::AI_setMissionAI(MissionAITypes eNewMissionAI, CvPlot* p
 {
 	//PROFILE_FUNC();
 
+	// <advc.003v>
+	CvPlayerAI& kOwner = GET_PLAYER(getOwnerINLINE());
+	kOwner.AI_updateMissionTargetIndex(getID(), AI_getMissionAIPlot(),
+			m_missionAIUnit.iID, false); // </advc.003v>
 	m_eMissionAIType = eNewMissionAI;
 
 	if (pNewPlot != NULL)
@@ -801,6 +805,8 @@ void CvSelectionGroupAI::AI_setMissionAI(MissionAITypes eNewMissionAI, CvPlot* p
 	{
 		m_missionAIUnit.reset();
 	}
+	// advc.003v:
+	kOwner.AI_updateMissionTargetIndex(getID(), pNewPlot, m_missionAIUnit.iID, true);
 }
 
 
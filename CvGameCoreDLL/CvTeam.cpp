@@ -658,8 +658,8 @@ void CvTeam::addTeam(TeamTypes eTeam)
 	{
 		// cf. CvTeam::getResearchCost
 		int iCostMultiplier = 100;
-		iCostMultiplier *= 100 + GC.getDefineINT("TECH_COST_EXTRA_TEAM_MEMBER_MODIFIER") * (getNumMembers() - 1); // new
-		iCostMultiplier /= 100 + GC.getDefineINT("TECH_COST_EXTRA_TEAM_MEMBER_MODIFIER") * (iOriginalTeamSize - 1); // old
+		iCostMultiplier *= 100 + GC.getDefineINT(CvGlobals::TECH_COST_EXTRA_TEAM_MEMBER_MODIFIER) * (getNumMembers() - 1); // new
+		iCostMultiplier /= 100 + GC.getDefineINT(CvGlobals::TECH_COST_EXTRA_TEAM_MEMBER_MODIFIER) * (iOriginalTeamSize - 1); // old
 
 		FAssert(iCostMultiplier >= 100);
 
@@ -1448,7 +1448,7 @@ void CvTeam::declareWar(TeamTypes eTeam, bool bNewDiplo, WarPlanTypes eWarPlan,
 					GET_TEAM(eTeam).isHasMet(kPlayer_j.getTeam())) {
 				// Raise it to 8 (or what XML says)
 				int iMemory = kPlayer_j.AI_getMemoryCount(i, MEMORY_MADE_DEMAND_RECENT);
-				int iDelta = GC.getDefineINT("WAR_DESPITE_TRIBUTE_MEMORY");
+				int iDelta = GC.getDefineINT(CvGlobals::WAR_DESPITE_TRIBUTE_MEMORY);
 				iDelta = std::max(iMemory, iDelta) - iMemory;
 				kPlayer_j.AI_changeMemoryCount(i, MEMORY_MADE_DEMAND_RECENT, iDelta);
 			}
@@ -1477,7 +1477,7 @@ void CvTeam::declareWar(TeamTypes eTeam, bool bNewDiplo, WarPlanTypes eWarPlan,
 	setAtWar(eTeam, true);
 	GET_TEAM(eTeam).setAtWar(getID(), true);
 	// <advc.162>
-	if(GC.getDefineINT("ENABLE_162") > 0)
+	if(GC.getDefineINT(CvGlobals::ENABLE_162) > 0)
 		m_abJustDeclaredWar[eTeam] = true; // </advc.162>
 
 	// Plot danger cache (bbai)
@@ -1906,7 +1906,7 @@ void CvTeam::makePeace(TeamTypes eTeam, bool bBumpUnits,
 	AI_setWarPlan(eTeam, NO_WARPLAN);
 	GET_TEAM(eTeam).AI_setWarPlan(getID(), NO_WARPLAN);
 	// <advc.034>
-	if(!bCapitulate && GC.getDefineINT("DISENGAGE_LENGTH") > 0)
+	if(!bCapitulate && GC.getDefineINT(CvGlobals::DISENGAGE_LENGTH) > 0)
 		signDisengage(eTeam); // </advc.034>
 
 	if (bBumpUnits)
@@ -2627,15 +2627,15 @@ bool CvTeam::canVassalRevolt(TeamTypes eMaster) const
 	if(isLossesAllowRevolt(eMaster))
 		return true; // </advc.112>
 
-	if (GC.getDefineINT("FREE_VASSAL_LAND_PERCENT") < 0 || 
+	if (GC.getDefineINT(CvGlobals::FREE_VASSAL_LAND_PERCENT) < 0 || 
 			100 * std::max(10, getTotalLand(false)) < // advc.112: Lower bound added
-			kMaster.getTotalLand(false) * GC.getDefineINT("FREE_VASSAL_LAND_PERCENT"))
+			kMaster.getTotalLand(false) * GC.getDefineINT(CvGlobals::FREE_VASSAL_LAND_PERCENT))
 	{
 		return false;
 	}
 
-	if (GC.getDefineINT("FREE_VASSAL_POPULATION_PERCENT") < 0 || 
-		100 * getTotalPopulation(false) < kMaster.getTotalPopulation(false) * GC.getDefineINT("FREE_VASSAL_POPULATION_PERCENT"))
+	if (GC.getDefineINT(CvGlobals::FREE_VASSAL_POPULATION_PERCENT) < 0 || 
+		100 * getTotalPopulation(false) < kMaster.getTotalPopulation(false) * GC.getDefineINT(CvGlobals::FREE_VASSAL_POPULATION_PERCENT))
 	{
 		return false;
 	}
@@ -2649,12 +2649,12 @@ bool CvTeam::isLossesAllowRevolt(TeamTypes eMaster) const {
 	CvTeam& kMaster = GET_TEAM(eMaster);
 	if (isVassal(eMaster))
 	{	// advc.112: Lower bound 10 added
-		if (100 * std::max(10, getTotalLand(false)) < GC.getDefineINT("VASSAL_REVOLT_OWN_LOSSES_FACTOR") * getVassalPower())
+		if (100 * std::max(10, getTotalLand(false)) < GC.getDefineINT(CvGlobals::VASSAL_REVOLT_OWN_LOSSES_FACTOR) * getVassalPower())
 		{
 			return true;
 		}
 		// advc (note): this INT is 0
-		if (100 * kMaster.getTotalLand() < GC.getDefineINT("VASSAL_REVOLT_MASTER_LOSSES_FACTOR") * getMasterPower())
+		if (100 * kMaster.getTotalLand() < GC.getDefineINT(CvGlobals::VASSAL_REVOLT_MASTER_LOSSES_FACTOR) * getMasterPower())
 		{
 			return true;
 		}
@@ -3136,7 +3136,7 @@ int CvTeam::getResearchCost(TechTypes eTech, bool bGlobalModifiers, bool bTeamSi
 	if (bTeamSizeModifiers) // K-Mod
 	{
 		cost *= 0.01 * std::max(0, 100 +
-				GC.getDefineINT("TECH_COST_EXTRA_TEAM_MEMBER_MODIFIER") *
+				GC.getDefineINT(CvGlobals::TECH_COST_EXTRA_TEAM_MEMBER_MODIFIER) *
 				(getNumMembers() - 1));
 	}
 	// <advc.251>
@@ -3359,7 +3359,7 @@ HandicapTypes CvTeam::getHandicapType() const
 	}
 	else
 	{
-		return ((HandicapTypes)(GC.getDefineINT("STANDARD_HANDICAP")));
+		return ((HandicapTypes)(GC.getDefineINT(CvGlobals::STANDARD_HANDICAP)));
 	}
 }
 
@@ -4084,6 +4084,7 @@ void CvTeam::makeHasMet(TeamTypes eIndex, bool bNewDiplo,
 
 	makeHasSeen(eIndex); // K-mod
 	m_abHasMet[eIndex] = true;
+	getWPAI.invalidateTurnCache(); // advc.003z
 
 	updateTechShare();
 
@@ -4273,6 +4274,10 @@ void CvTeam::setAtWar(TeamTypes eIndex, bool bNewValue)
 	if(m_abAtWar[eIndex] == bNewValue)
 		return; // </advc.035>
 	m_abAtWar[eIndex] = bNewValue;
+	// <advc.003u>
+	GET_TEAM(getID()).AI_setHostileUnitDistDirty();
+	GET_TEAM(eIndex).AI_setHostileUnitDistDirty(); // </advc.003u>
+	getWPAI.invalidateTurnCache(); // advc.003z
 	// <advc.003m>
 	if(eIndex != BARBARIAN_TEAM) {
 		changeAtWarCount(bNewValue ? 1 : -1, GET_TEAM(eIndex).isMinorCiv(),
@@ -4370,6 +4375,7 @@ void CvTeam::setOpenBorders(TeamTypes eIndex, bool bNewValue)
 		return; // advc.003
 	bool bOldFreeTrade = isFreeTrade(eIndex);
 	m_abOpenBorders[eIndex] = bNewValue;
+	getWPAI.invalidateTurnCache(); // advc.003z
 	// <advc.130p> OB affect diplo from rival trade
 	for(int i = 0; i < MAX_CIV_PLAYERS; i++) {
 		CvPlayerAI& kOther = GET_PLAYER((PlayerTypes)i);
@@ -4452,6 +4458,7 @@ void CvTeam::setDefensivePact(TeamTypes eIndex, bool bNewValue)
 	if (isDefensivePact(eIndex) == bNewValue)
 		return; // advc.003
 	m_abDefensivePact[eIndex] = bNewValue;
+	getWPAI.invalidateTurnCache(); // advc.003z
 	if(getID() == GC.getGameINLINE().getActiveTeam() ||
 			eIndex == GC.getGameINLINE().getActiveTeam())
 		gDLL->getInterfaceIFace()->setDirty(Score_DIRTY_BIT, true);
@@ -4593,6 +4600,7 @@ void CvTeam::setVassal(TeamTypes eMaster, bool bNewValue, bool bCapitulated)
 		isCapitulated()==bCapitulated here. */
 	if(isVassal(eMaster) == bNewValue)
 		return; // <advc.003>
+	getWPAI.invalidateTurnCache(); // advc.003z
 	for (int i = 0; i < MAX_PLAYERS; i++)
 	{
 		if (GET_PLAYER((PlayerTypes)i).getTeam() == getID())
@@ -5542,6 +5550,7 @@ void CvTeam::setResearchProgress(TechTypes eIndex, int iNewValue, PlayerTypes eP
 		return;
 
 	m_paiResearchProgress[eIndex] = iNewValue;
+	getWPAI.invalidateTurnCache(); // advc.003z
 	FAssert(getResearchProgress(eIndex) >= 0);
 
 	if (getID() == GC.getGameINLINE().getActiveTeam())
@@ -6051,6 +6060,12 @@ void CvTeam::setHasTech(TechTypes eIndex, bool bNewValue, PlayerTypes ePlayer, b
 		}
 
 		m_pabHasTech[eIndex] = bNewValue;
+		// <advc.003al>
+		for (int iI = 0; iI < MAX_PLAYERS; iI++)
+		{
+			if (GET_PLAYER((PlayerTypes)iI).getTeam() == getID())
+				GET_PLAYER((PlayerTypes)iI).invalidateTechPathLengthCache();
+		} // </advc.003al>
 
 		for (int iI = 0; iI < GC.getMapINLINE().numPlotsINLINE(); iI++)
 		{
@@ -6288,7 +6303,7 @@ void CvTeam::setHasTech(TechTypes eIndex, bool bNewValue, PlayerTypes ePlayer, b
 				}
 				// advc.004: Announcement code moved into next block
 				// advc.106: Do it at the end instead
-				if(GC.getDefineINT("SHOW_FIRST_TO_DISCOVER_IN_REPLAY") <= 0) {
+				if(GC.getDefineINT(CvGlobals::SHOW_FIRST_TO_DISCOVER_IN_REPLAY) <= 0) {
 					szBuffer = gDLL->getText("TXT_KEY_MISC_SOMEONE_FIRST_TO_TECH", GET_PLAYER(ePlayer).getReplayName(), GC.getTechInfo(eIndex).getTextKeyWide());
 					g.addReplayMessage(REPLAY_MESSAGE_MAJOR_EVENT, ePlayer, szBuffer, -1, -1, (ColorTypes)GC.getInfoTypeForString("COLOR_HIGHLIGHT_TEXT"));
 				} // advc.106
@@ -6449,7 +6464,7 @@ void CvTeam::setHasTech(TechTypes eIndex, bool bNewValue, PlayerTypes ePlayer, b
 		}
 		// <advc.106>
 		if(bFirst && firstToDiscover && g.getElapsedGameTurns() > 0 &&
-				GC.getDefineINT("SHOW_FIRST_TO_DISCOVER_IN_REPLAY") > 0) {
+				GC.getDefineINT(CvGlobals::SHOW_FIRST_TO_DISCOVER_IN_REPLAY) > 0) {
 			CvWString szBuffer = gDLL->getText("TXT_KEY_MISC_SOMEONE_FIRST_TO_TECH",
 					GET_PLAYER(ePlayer).getReplayName(),
 					GC.getTechInfo(eIndex).getTextKeyWide());
@@ -6878,11 +6893,11 @@ void CvTeam::doWarWeariness()
 	{
 		if (getWarWeariness((TeamTypes)iI) > 0)
 		{
-			changeWarWeariness(((TeamTypes)iI), 100 * GC.getDefineINT("WW_DECAY_RATE"));
+			changeWarWeariness(((TeamTypes)iI), 100 * GC.getDefineINT(CvGlobals::WW_DECAY_RATE));
 
 			if (!(GET_TEAM((TeamTypes)iI).isAlive()) || !isAtWar((TeamTypes)iI) || GC.getGameINLINE().isOption(GAMEOPTION_ALWAYS_WAR) || GC.getGameINLINE().isOption(GAMEOPTION_NO_CHANGING_WAR_PEACE))
 			{
-				setWarWeariness(((TeamTypes)iI), ((getWarWeariness((TeamTypes)iI) * GC.getDefineINT("WW_DECAY_PEACE_PERCENT")) / 100));
+				setWarWeariness(((TeamTypes)iI), ((getWarWeariness((TeamTypes)iI) * GC.getDefineINT(CvGlobals::WW_DECAY_PEACE_PERCENT)) / 100));
 			}
 		}
 	}
@@ -6962,11 +6977,11 @@ void CvTeam::doBarbarianResearch() {
 					catch up too slowly when colonized only by one or two civs. */
 				if(bNoBarbCities)
 					iCount = std::max(iCount, (2 * iHasTech) / 3);
-				//changeResearchProgress(((TechTypes)iI), ((getResearchCost((TechTypes)iI) * ((GC.getDefineINT("BARBARIAN_FREE_TECH_PERCENT") * iCount) / iPossibleCount)) / 100), getLeaderID());
+				//changeResearchProgress(((TechTypes)iI), ((getResearchCost((TechTypes)iI) * ((GC.getDefineINT(CvGlobals::BARBARIAN_FREE_TECH_PERCENT) * iCount) / iPossibleCount)) / 100), getLeaderID());
 				// K-Mod. Adjust research rate for game-speed & start-era - but _not_ world-size. And fix the rounding error.
 				int iBaseCost = getResearchCost(i, false) * GC.getWorldInfo(GC.getMapINLINE().getWorldSize()).getResearchPercent() / 100;
 				changeResearchProgress(i, std::max(1, iBaseCost *
-						GC.getDefineINT("BARBARIAN_FREE_TECH_PERCENT") * iCount /
+						GC.getDefineINT(CvGlobals::BARBARIAN_FREE_TECH_PERCENT) * iCount /
 						(100 * iPossible)), kBarbPlayer.getID());
 				// K-Mod end
 			}
@@ -7097,9 +7112,9 @@ void CvTeam::testCircumnavigated()
 	//if (GC.getGameINLINE().getElapsedGameTurns() > 0)
 	if (GC.getGameINLINE().getElapsedGameTurns() > 1) // K-Mod (due to changes in when CvTeam::doTurn is called)
 	{
-		if (GC.getDefineINT("CIRCUMNAVIGATE_FREE_MOVES") != 0)
+		if (GC.getDefineINT(CvGlobals::CIRCUMNAVIGATE_FREE_MOVES) != 0)
 		{
-			changeExtraMoves(DOMAIN_SEA, GC.getDefineINT("CIRCUMNAVIGATE_FREE_MOVES"));
+			changeExtraMoves(DOMAIN_SEA, GC.getDefineINT(CvGlobals::CIRCUMNAVIGATE_FREE_MOVES));
 
 			for (int iI = 0; iI < MAX_PLAYERS; iI++)
 			{
@@ -7109,7 +7124,7 @@ void CvTeam::testCircumnavigated()
 				if(getID() == kObs.getTeam())
 				{
 					szBuffer = gDLL->getText("TXT_KEY_MISC_YOU_CIRC_GLOBE",
-							GC.getDefineINT("CIRCUMNAVIGATE_FREE_MOVES"));
+							GC.getDefineINT(CvGlobals::CIRCUMNAVIGATE_FREE_MOVES));
 				}
 				else if(isHasMet(kObs.getTeam())
 						|| kObs.isSpectator()) // advc.127
@@ -150,12 +150,16 @@ void CvTeamAI::AI_reset(bool bConstructor)
 	}
 	m_religionKnownSince.clear(); // advc.130n
 	m_bLonely = false; // advc.109
+	m_bHostileUnitDistDirty = true; // advc.003u
 }
 
 
 void CvTeamAI::AI_doTurnPre()
 {
 	AI_doCounter();
+	/*  advc.003u: Discard the stale distances of units that have moved away
+		(the field only ever decreases in between) */
+	AI_setHostileUnitDistDirty();
 
 	/*if(isHuman()) // advc.003: Caller handles these
 		return;
@@ -3032,7 +3036,7 @@ DenialTypes CvTeamAI::AI_surrenderTrade(TeamTypes eTeam, int iPowerMultiplier,
 	else
 	{
 		/* original BTS code
-		if (AI_getWarSuccess(eTeam) + 4 * GC.getDefineINT("WAR_SUCCESS_CITY_CAPTURING") > GET_TEAM(eTeam).AI_getWarSuccess(getID()))
+		if (AI_getWarSuccess(eTeam) + 4 * GC.getDefineINT(CvGlobals::WAR_SUCCESS_CITY_CAPTURING) > GET_TEAM(eTeam).AI_getWarSuccess(getID()))
 			return DENIAL_JOKING;*/
 		/*  BETTER_BTS_AI_MOD, Diplomacy AI, 12/07/09, jdog5000: START
 			Scale better for small empires, particularly necessary if WAR_SUCCESS_CITY_CAPTURING > 10 */
@@ -3088,7 +3092,7 @@ DenialTypes CvTeamAI::AI_surrenderTrade(TeamTypes eTeam, int iPowerMultiplier,
 	// <advc.112> Lower bound: 10
 	double landRatio = std::max(10, getTotalLand(false)) / (double)
 			std::max(10, getVassalPower()); // </advc.112>
-	double lossesThresh = GC.getDefineINT("VASSAL_DENY_OWN_LOSSES_FACTOR") / 100.0;
+	double lossesThresh = GC.getDefineINT(CvGlobals::VASSAL_DENY_OWN_LOSSES_FACTOR) / 100.0;
 	if(landRatio < 0.85 * lossesThresh || (landRatio < lossesThresh &&
 			::hash(g.gameTurn(), getLeaderID()) < 0.15))
 		return DENIAL_POWER_YOUR_ENEMIES; // Denial type doesn't matter
@@ -3207,7 +3211,7 @@ int CvTeamAI::AI_getWarSuccessRating() const
 			iMilitaryUnits += kLoopPlayer.getNumMilitaryUnits();
 		}
 	}
-	int iSuccessScale = iMilitaryUnits * GC.getDefineINT("WAR_SUCCESS_ATTACKING") / 5;
+	int iSuccessScale = iMilitaryUnits * GC.getDefineINT(CvGlobals::WAR_SUCCESS_ATTACKING) / 5;
 
 	int iThisTeamPower = getPower(true);
 	int iScore = 0;
@@ -3559,7 +3563,7 @@ bool CvTeamAI::AI_acceptSurrender(TeamTypes eSurrenderTeam) const  // advc.003:
 			if (isAtWar(i) && kLoopTeam.isAlive() && !kLoopTeam.isMinorCiv() &&
 					i != eSurrenderTeam && !kLoopTeam.isVassal(eSurrenderTeam))
 			{
-				if (kLoopTeam.AI_getWarSuccess(getID()) > 5*GC.getDefineINT("WAR_SUCCESS_ATTACKING"))
+				if (kLoopTeam.AI_getWarSuccess(getID()) > 5*GC.getDefineINT(CvGlobals::WAR_SUCCESS_ATTACKING))
 				{
 					return true;
 				}
@@ -3958,7 +3962,7 @@ int CvTeamAI::AI_declareWarTradeValLegacy(TeamTypes eWarTeam, TeamTypes eTeam) c
 	int iWarTeamPower = GET_TEAM(eWarTeam).getPower(true);
 
 	iValue *= 50 + ((
-		GC.getDefineINT("WAR_TRADEVAL_POWER_WEIGHT") // advc.100
+		GC.getDefineINT(CvGlobals::WAR_TRADEVAL_POWER_WEIGHT) // advc.100
 		* iWarTeamPower) / (iTheirPower + iWarTeamPower + 1));
 	iValue /= 100;
 
@@ -4882,6 +4886,7 @@ void CvTeamAI::AI_setWarPlan(TeamTypes eIndex, WarPlanTypes eNewValue, bool bWar
 	if(AI_getWarPlan(eIndex) == eNewValue || (!bWar && isAtWar(eIndex)))
 		return;
 	m_aeWarPlan[eIndex] = eNewValue;
+	getWPAI.invalidateTurnCache(); // advc.003z
 	AI_setWarPlanStateCounter(eIndex, 0);
 	AI_updateAreaStrategies();
 	for(int i = 0; i < MAX_CIV_PLAYERS; i++) {
@@ -4955,6 +4960,7 @@ int CvTeamAI::AI_teamCloseness(TeamTypes eIndex, int iMaxDistance,
 void CvTeamAI::read(FDataStreamBase* pStream)
 {
 	CvTeam::read(pStream);
+	m_bHostileUnitDistDirty = true; // advc.003u
 
 	uint uiFlag=0;
 	pStream->Read(&uiFlag);
@@ -5186,6 +5192,99 @@ void CvTeamAI::AI_setStrengthMemory(const CvPlot* pPlot, int value) {
 	m_aiStrengthMemory[GC.getMapINLINE().plotNumINLINE(pPlot->getX_INLINE(), pPlot->getY_INLINE())] = value;
 } // </advc.make>
 
+// <advc.003u>
+/*  Distances are capped so that a unit entering a plot only needs to update
+	a small neighborhood. A capped entry means "at least this far". */
+#define HOSTILE_UNIT_DIST_CAP (2 * DANGER_RANGE)
+
+int CvTeamAI::AI_getHostileUnitDist(CvPlot const& kPlot) const {
+
+	if(m_bHostileUnitDistDirty)
+		AI_updateHostileUnitDist();
+	return m_aiHostileUnitDist[GC.getMapINLINE().plotNumINLINE(
+			kPlot.getX_INLINE(), kPlot.getY_INLINE())];
+}
+
+void CvTeamAI::AI_setHostileUnitDistDirty() {
+
+	m_bHostileUnitDistDirty = true;
+}
+
+void CvTeamAI::AI_updateHostileUnitDist(CvPlot const& kPlot, CvUnit const& kUnit) {
+
+	if(m_bHostileUnitDistDirty || !AI_isPotentialHostile(kUnit))
+		return;
+	int iIndex = GC.getMapINLINE().plotNumINLINE(kPlot.getX_INLINE(), kPlot.getY_INLINE());
+	if(m_aiHostileUnitDist[iIndex] == 0)
+		return;
+	m_aiHostileUnitDist[iIndex] = 0;
+	std::vector<int> aiQueue;
+	aiQueue.push_back(iIndex);
+	AI_spreadHostileUnitDist(aiQueue);
+}
+
+/*  Superset of the units for which CvUnit::isEnemy(getID()) can hold on any plot;
+	see CvUnit::getCombatOwner. */
+bool CvTeamAI::AI_isPotentialHostile(CvUnit const& kUnit) const {
+
+	TeamTypes eUnitTeam = kUnit.getTeam();
+	if(eUnitTeam == getID())
+		return false;
+	return (GET_TEAM(eUnitTeam).isAtWarInternal(getID()) ||
+			(getID() != BARBARIAN_TEAM && kUnit.getUnitInfo().isAlwaysHostile()));
+}
+
+/*  Multi-source breadth-first search from all plots that contain a potentially
+	hostile unit. Units leaving a plot don't dirty the field; the stale distances
+	remain valid lower bounds until the next recomputation (once per turn). */
+void CvTeamAI::AI_updateHostileUnitDist() const {
+
+	PROFILE_FUNC();
+	CvMap const& kMap = GC.getMapINLINE();
+	int const iPlots = kMap.numPlotsINLINE();
+	m_aiHostileUnitDist.assign(iPlots, (byte)HOSTILE_UNIT_DIST_CAP);
+	std::vector<int> aiQueue;
+	for(int i = 0; i < iPlots; i++) {
+		CvPlot const& kPlot = *kMap.plotByIndexINLINE(i);
+		CLLNode<IDInfo>* pNode = kPlot.headUnitNode();
+		while(pNode != NULL) {
+			CvUnit const* pUnit = ::getUnit(pNode->m_data);
+			pNode = kPlot.nextUnitNode(pNode);
+			if(pUnit != NULL && AI_isPotentialHostile(*pUnit)) {
+				m_aiHostileUnitDist[i] = 0;
+				aiQueue.push_back(i);
+				break;
+			}
+		}
+	}
+	AI_spreadHostileUnitDist(aiQueue);
+	m_bHostileUnitDistDirty = false;
+}
+
+// Lowers the distances around the (already updated) plots in aiQueue
+void CvTeamAI::AI_spreadHostileUnitDist(std::vector<int>& aiQueue) const {
+
+	CvMap const& kMap = GC.getMapINLINE();
+	for(size_t iHead = 0; iHead < aiQueue.size(); iHead++) {
+		int iIndex = aiQueue[iHead];
+		int iDist = m_aiHostileUnitDist[iIndex] + 1;
+		if(iDist >= HOSTILE_UNIT_DIST_CAP)
+			continue;
+		CvPlot const& kPlot = *kMap.plotByIndexINLINE(iIndex);
+		for(int j = 0; j < NUM_DIRECTION_TYPES; j++) {
+			CvPlot const* pAdj = kMap.plotDirection(kPlot.getX_INLINE(),
+					kPlot.getY_INLINE(), (DirectionTypes)j);
+			if(pAdj == NULL)
+				continue;
+			int iAdj = kMap.plotNumINLINE(pAdj->getX_INLINE(), pAdj->getY_INLINE());
+			if(m_aiHostileUnitDist[iAdj] > iDist) {
+				m_aiHostileUnitDist[iAdj] = (byte)iDist;
+				aiQueue.push_back(iAdj);
+			}
+		}
+	}
+} // </advc.003u>
+
 void CvTeamAI::AI_updateStrengthMemory()
 {
 	PROFILE_FUNC();
@@ -6074,7 +6173,7 @@ void CvTeamAI::AI_doWar()
 			if( AI_getAtWarCounter(eLoopTeam) > std::max(10, (14 * GC.getGameSpeedInfo(kGame.getGameSpeedType()).getVictoryDelayPercent())/100) )
 			{
 				// If nothing is happening in war
-				if( AI_getWarSuccess(eLoopTeam) + GET_TEAM(eLoopTeam).AI_getWarSuccess(getID()) < 2*GC.getDefineINT("WAR_SUCCESS_ATTACKING") )
+				if( AI_getWarSuccess(eLoopTeam) + GET_TEAM(eLoopTeam).AI_getWarSuccess(getID()) < 2*GC.getDefineINT(CvGlobals::WAR_SUCCESS_ATTACKING) )
 				{
 					if( (kGame.getSorenRandNum(8, "AI Make Peace 1") == 0) )
 					{
@@ -266,6 +266,14 @@ public:
 	// <advc.make> No longer inlined. To avoid including CvPlot.h.
 	int AI_getStrengthMemory(const CvPlot* pPlot);
 	void AI_setStrengthMemory(const CvPlot* pPlot, int value); // </advc.make>
+	/*  <advc.003u> Lower bound on the step distance from kPlot to the nearest unit
+		that could be hostile to this team. Lets the danger functions skip the
+		unit scan when no such unit is in range. */
+	int AI_getHostileUnitDist(CvPlot const& kPlot) const;
+	void AI_setHostileUnitDistDirty();
+	// Call when kUnit has entered kPlot
+	void AI_updateHostileUnitDist(CvPlot const& kPlot, CvUnit const& kUnit);
+	bool AI_isPotentialHostile(CvUnit const& kUnit) const; // </advc.003u>
 
 protected:
 
@@ -293,6 +301,11 @@ protected:
 	WarPlanTypes* m_aeWarPlan;
 
 	bool m_bLonely; // advc.109
+	// <advc.003u> Not serialized; recomputed on demand.
+	mutable std::vector<byte> m_aiHostileUnitDist;
+	mutable bool m_bHostileUnitDistDirty;
+	void AI_updateHostileUnitDist() const;
+	void AI_spreadHostileUnitDist(std::vector<int>& aiQueue) const; // </advc.003u>
 
 	WarAndPeaceAI::Team* m_pWpai; // advc.104
 
@@ -687,7 +687,7 @@ void CvUnit::kill(bool bDelay, PlayerTypes ePlayer)
 
 	if (eCapturingPlayer != NO_PLAYER && eCaptureUnitType != NO_UNIT && !GET_PLAYER(eCapturingPlayer).isBarbarian())
 	{
-		if (GET_PLAYER(eCapturingPlayer).isHuman() || GET_PLAYER(eCapturingPlayer).AI_captureUnit(eCaptureUnitType, pPlot) || 0 == GC.getDefineINT("AI_CAN_DISBAND_UNITS"))
+		if (GET_PLAYER(eCapturingPlayer).isHuman() || GET_PLAYER(eCapturingPlayer).AI_captureUnit(eCaptureUnitType, pPlot) || 0 == GC.getDefineINT(CvGlobals::AI_CAN_DISBAND_UNITS))
 		{
 			CvUnit* pkCapturedUnit = GET_PLAYER(eCapturingPlayer).initUnit(eCaptureUnitType, pPlot->getX_INLINE(), pPlot->getY_INLINE());
 
@@ -717,7 +717,7 @@ void CvUnit::kill(bool bDelay, PlayerTypes ePlayer)
 					if (pCapturePlot != NULL && !pCapturePlot->isCity(false))
 					{
 						if (GET_PLAYER(eCapturingPlayer).AI_getPlotDanger(pCapturePlot) > 0 &&
-								GC.getDefineINT("AI_CAN_DISBAND_UNITS"))
+								GC.getDefineINT(CvGlobals::AI_CAN_DISBAND_UNITS))
 						{
 							//pkCapturedUnit->kill(false);
 							// K-Mod. roughly the same thing, but this is more appropriate.
@@ -764,11 +764,11 @@ void CvUnit::doTurn()
 		{
 			if (GET_TEAM(getTeam()).isOpenBorders(eTeam))
 			{
-				testSpyIntercepted(plot()->getOwnerINLINE(), false, GC.getDefineINT("ESPIONAGE_SPY_NO_INTRUDE_INTERCEPT_MOD"));
+				testSpyIntercepted(plot()->getOwnerINLINE(), false, GC.getDefineINT(CvGlobals::ESPIONAGE_SPY_NO_INTRUDE_INTERCEPT_MOD));
 			}
 			else
 			{
-				testSpyIntercepted(plot()->getOwnerINLINE(), false, GC.getDefineINT("ESPIONAGE_SPY_INTERCEPT_MOD"));
+				testSpyIntercepted(plot()->getOwnerINLINE(), false, GC.getDefineINT(CvGlobals::ESPIONAGE_SPY_INTERCEPT_MOD));
 			}
 		}
 	}
@@ -897,13 +897,13 @@ void CvUnit::resolveAirCombat(CvUnit* pInterceptor, CvPlot* pPlot, CvAirMissionD
 
 	/*original BTS code
 	int iOurOdds = (100 * iOurStrength) / std::max(1, iTotalStrength);
-	int iOurRoundDamage = (pInterceptor->currInterceptionProbability() * GC.getDefineINT("MAX_INTERCEPTION_DAMAGE")) / 100;
-	int iTheirRoundDamage = (currInterceptionProbability() * GC.getDefineINT("MAX_INTERCEPTION_DAMAGE")) / 100;
+	int iOurRoundDamage = (pInterceptor->currInterceptionProbability() * GC.getDefineINT(CvGlobals::MAX_INTERCEPTION_DAMAGE)) / 100;
+	int iTheirRoundDamage = (currInterceptionProbability() * GC.getDefineINT(CvGlobals::MAX_INTERCEPTION_DAMAGE)) / 100;
 	if (getDomainType() == DOMAIN_AIR)
-		iTheirRoundDamage = std::max(GC.getDefineINT("MIN_INTERCEPTION_DAMAGE"), iTheirRoundDamage);
+		iTheirRoundDamage = std::max(GC.getDefineINT(CvGlobals::MIN_INTERCEPTION_DAMAGE), iTheirRoundDamage);
 	int iTheirDamage = 0;
 	int iOurDamage = 0;
-	for (int iRound = 0; iRound < GC.getDefineINT("INTERCEPTION_MAX_ROUNDS"); ++iRound)*/
+	for (int iRound = 0; iRound < GC.getDefineINT(CvGlobals::INTERCEPTION_MAX_ROUNDS); ++iRound)*/
 	/*  BETTER_BTS_AI_MOD (Combat mechanics), 10/19/08, Roland J & jdog5000: START
 		For air v air, more rounds and factor in strength for per round damage */
 	int iOurOdds = (100 * iOurStrength) / std::max(1, iTotalStrength);
@@ -915,30 +915,30 @@ void CvUnit::resolveAirCombat(CvUnit* pInterceptor, CvPlot* pPlot, CvAirMissionD
 	// Round damage in this case will now depend on strength and interception probability
 	if( GC.getBBAI_AIR_COMBAT() && (DOMAIN_AIR == pInterceptor->getDomainType() && DOMAIN_AIR == getDomainType()) )
 	{
-		int iBaseDamage = GC.getDefineINT("AIR_COMBAT_DAMAGE");
+		int iBaseDamage = GC.getDefineINT(CvGlobals::AIR_COMBAT_DAMAGE);
 		int iOurFirepower = ((airMaxCombatStr(pInterceptor) + iOurStrength + 1) / 2);
 		int iTheirFirepower = ((pInterceptor->airMaxCombatStr(this) + iTheirStrength + 1) / 2);
 
 		int iStrengthFactor = ((iOurFirepower + iTheirFirepower + 1) / 2);
 
-		int iTheirInterception = std::max(pInterceptor->maxInterceptionProbability(),2*GC.getDefineINT("MIN_INTERCEPTION_DAMAGE"));
-		int iOurInterception = std::max(maxInterceptionProbability(),2*GC.getDefineINT("MIN_INTERCEPTION_DAMAGE"));
+		int iTheirInterception = std::max(pInterceptor->maxInterceptionProbability(),2*GC.getDefineINT(CvGlobals::MIN_INTERCEPTION_DAMAGE));
+		int iOurInterception = std::max(maxInterceptionProbability(),2*GC.getDefineINT(CvGlobals::MIN_INTERCEPTION_DAMAGE));
 
 		iOurRoundDamage = std::max(1, ((iBaseDamage * (iTheirFirepower + iStrengthFactor) * iTheirInterception) / ((iOurFirepower + iStrengthFactor) * 100)));
 		iTheirRoundDamage = std::max(1, ((iBaseDamage * (iOurFirepower + iStrengthFactor) * iOurInterception) / ((iTheirFirepower + iStrengthFactor) * 100)));
 
-		iMaxRounds = 2*GC.getDefineINT("INTERCEPTION_MAX_ROUNDS") - 1;
+		iMaxRounds = 2*GC.getDefineINT(CvGlobals::INTERCEPTION_MAX_ROUNDS) - 1;
 	}
 	else
 	{
-		iOurRoundDamage = (pInterceptor->currInterceptionProbability() * GC.getDefineINT("MAX_INTERCEPTION_DAMAGE")) / 100;
-		iTheirRoundDamage = (currInterceptionProbability() * GC.getDefineINT("MAX_INTERCEPTION_DAMAGE")) / 100;
+		iOurRoundDamage = (pInterceptor->currInterceptionProbability() * GC.getDefineINT(CvGlobals::MAX_INTERCEPTION_DAMAGE)) / 100;
+		iTheirRoundDamage = (currInterceptionProbability() * GC.getDefineINT(CvGlobals::MAX_INTERCEPTION_DAMAGE)) / 100;
 		if (getDomainType() == DOMAIN_AIR)
 		{
-			iTheirRoundDamage = std::max(GC.getDefineINT("MIN_INTERCEPTION_DAMAGE"), iTheirRoundDamage);
+			iTheirRoundDamage = std::max(GC.getDefineINT(CvGlobals::MIN_INTERCEPTION_DAMAGE), iTheirRoundDamage);
 		}
 
-		iMaxRounds = GC.getDefineINT("INTERCEPTION_MAX_ROUNDS");
+		iMaxRounds = GC.getDefineINT(CvGlobals::INTERCEPTION_MAX_ROUNDS);
 	}
 
 	int iTheirDamage = 0;
@@ -976,7 +976,7 @@ void CvUnit::resolveAirCombat(CvUnit* pInterceptor, CvPlot* pPlot, CvAirMissionD
 		{
 			int iExperience = attackXPValue();
 			iExperience = (iExperience * iOurStrength) / std::max(1, iTheirStrength);
-			iExperience = range(iExperience, GC.getDefineINT("MIN_EXPERIENCE_PER_COMBAT"), GC.getDefineINT("MAX_EXPERIENCE_PER_COMBAT"));
+			iExperience = range(iExperience, GC.getDefineINT(CvGlobals::MIN_EXPERIENCE_PER_COMBAT), GC.getDefineINT(CvGlobals::MAX_EXPERIENCE_PER_COMBAT));
 			pInterceptor->changeExperience(iExperience, maxXPValue(), true, pPlot->getOwnerINLINE() == pInterceptor->getOwnerINLINE(), !isBarbarian());
 		}
 	}
@@ -984,19 +984,19 @@ void CvUnit::resolveAirCombat(CvUnit* pInterceptor, CvPlot* pPlot, CvAirMissionD
 	{
 		int iExperience = pInterceptor->defenseXPValue();
 		iExperience = (iExperience * iTheirStrength) / std::max(1, iOurStrength);
-		iExperience = range(iExperience, GC.getDefineINT("MIN_EXPERIENCE_PER_COMBAT"), GC.getDefineINT("MAX_EXPERIENCE_PER_COMBAT"));
+		iExperience = range(iExperience, GC.getDefineINT(CvGlobals::MIN_EXPERIENCE_PER_COMBAT), GC.getDefineINT(CvGlobals::MAX_EXPERIENCE_PER_COMBAT));
 		changeExperience(iExperience, pInterceptor->maxXPValue(), true, pPlot->getOwnerINLINE() == getOwnerINLINE(), !pInterceptor->isBarbarian());
 	}
 	else if (iOurDamage > 0)
 	{
 		if (iTheirRoundDamage > 0)
 		{
-			pInterceptor->changeExperience(GC.getDefineINT("EXPERIENCE_FROM_WITHDRAWL"), maxXPValue(), true, pPlot->getOwnerINLINE() == pInterceptor->getOwnerINLINE(), !isBarbarian());
+			pInterceptor->changeExperience(GC.getDefineINT(CvGlobals::EXPERIENCE_FROM_WITHDRAWL), maxXPValue(), true, pPlot->getOwnerINLINE() == pInterceptor->getOwnerINLINE(), !isBarbarian());
 		}
 	}
 	else if (iTheirDamage > 0)
 	{
-		changeExperience(GC.getDefineINT("EXPERIENCE_FROM_WITHDRAWL"), pInterceptor->maxXPValue(), true, pPlot->getOwnerINLINE() == getOwnerINLINE(), !pInterceptor->isBarbarian());
+		changeExperience(GC.getDefineINT(CvGlobals::EXPERIENCE_FROM_WITHDRAWL), pInterceptor->maxXPValue(), true, pPlot->getOwnerINLINE() == getOwnerINLINE(), !pInterceptor->isBarbarian());
 	}
 
 	kBattle.setDamage(BATTLE_UNIT_ATTACKER, iOurDamage);
@@ -1239,7 +1239,7 @@ void CvUnit::resolveCombat(CvUnit* pDefender, CvPlot* pPlot, bool bVisible)
 				{
 					flankingStrikeCombat(pPlot, iAttackerStrength, iAttackerFirepower, iAttackerKillOdds, iDefenderDamage, pDefender);
 
-					changeExperience(GC.getDefineINT("EXPERIENCE_FROM_WITHDRAWL"), pDefender->maxXPValue(), true, pPlot->getOwnerINLINE() == getOwnerINLINE(), !pDefender->isBarbarian());
+					changeExperience(GC.getDefineINT(CvGlobals::EXPERIENCE_FROM_WITHDRAWL), pDefender->maxXPValue(), true, pPlot->getOwnerINLINE() == getOwnerINLINE(), !pDefender->isBarbarian());
 					combat_log.push_back(0); // K-Mod
 					break;
 				}
@@ -1279,7 +1279,7 @@ void CvUnit::resolveCombat(CvUnit* pDefender, CvPlot* pPlot, bool bVisible)
 			{
 				if (std::min(GC.getMAX_HIT_POINTS(), pDefender->getDamage() + iDefenderDamage) > combatLimit())
 				{
-					changeExperience(GC.getDefineINT("EXPERIENCE_FROM_WITHDRAWL"), pDefender->maxXPValue(), true, pPlot->getOwnerINLINE() == getOwnerINLINE(), !pDefender->isBarbarian());
+					changeExperience(GC.getDefineINT(CvGlobals::EXPERIENCE_FROM_WITHDRAWL), pDefender->maxXPValue(), true, pPlot->getOwnerINLINE() == getOwnerINLINE(), !pDefender->isBarbarian());
 					combat_log.push_back(combatLimit() - pDefender->getDamage()); // K-Mod
 					pDefender->setDamage(combatLimit(), getOwnerINLINE());
 					break;
@@ -1331,7 +1331,7 @@ void CvUnit::resolveCombat(CvUnit* pDefender, CvPlot* pPlot, bool bVisible)
 			{
 				int iExperience = defenseXPValue();
 				iExperience = ((iExperience * iAttackerStrength) / iDefenderStrength);
-				iExperience = range(iExperience, GC.getDefineINT("MIN_EXPERIENCE_PER_COMBAT"), GC.getDefineINT("MAX_EXPERIENCE_PER_COMBAT")
+				iExperience = range(iExperience, GC.getDefineINT(CvGlobals::MIN_EXPERIENCE_PER_COMBAT), GC.getDefineINT(CvGlobals::MAX_EXPERIENCE_PER_COMBAT)
 						- (isBarbarian() ? 4 : 0)); // advc.312
 				pDefender->changeExperience(iExperience, maxXPValue(), true, pPlot->getOwnerINLINE() == pDefender->getOwnerINLINE(), !isBarbarian());
 			}
@@ -1341,7 +1341,7 @@ void CvUnit::resolveCombat(CvUnit* pDefender, CvPlot* pPlot, bool bVisible)
 
 				int iExperience = pDefender->attackXPValue();
 				iExperience = ((iExperience * iDefenderStrength) / iAttackerStrength);
-				iExperience = range(iExperience, GC.getDefineINT("MIN_EXPERIENCE_PER_COMBAT"), GC.getDefineINT("MAX_EXPERIENCE_PER_COMBAT")
+				iExperience = range(iExperience, GC.getDefineINT(CvGlobals::MIN_EXPERIENCE_PER_COMBAT), GC.getDefineINT(CvGlobals::MAX_EXPERIENCE_PER_COMBAT)
 						/ (pDefender->isBarbarian() ? 2 : 1)); // advc.312
 				changeExperience(iExperience, pDefender->maxXPValue(), true, pPlot->getOwnerINLINE() == getOwnerINLINE(), !pDefender->isBarbarian());
 			}
@@ -1604,11 +1604,11 @@ void CvUnit::updateCombat(bool bQuick)
 
 			if (!m_pUnitInfo->isHiddenNationality() && !pDefender->getUnitInfo().isHiddenNationality())
 			{
-				GET_TEAM(getTeam()).changeWarWeariness(pDefender->getTeam(), *pPlot, GC.getDefineINT("WW_UNIT_KILLED_ATTACKING"));
-				GET_TEAM(pDefender->getTeam()).changeWarWeariness(getTeam(), *pPlot, GC.getDefineINT("WW_KILLED_UNIT_DEFENDING"));
+				GET_TEAM(getTeam()).changeWarWeariness(pDefender->getTeam(), *pPlot, GC.getDefineINT(CvGlobals::WW_UNIT_KILLED_ATTACKING));
+				GET_TEAM(pDefender->getTeam()).changeWarWeariness(getTeam(), *pPlot, GC.getDefineINT(CvGlobals::WW_KILLED_UNIT_DEFENDING));
 			}
 			// <advc.130m>
-			int const iWS = GC.getDefineINT("WAR_SUCCESS_DEFENDING");
+			int const iWS = GC.getDefineINT(CvGlobals::WAR_SUCCESS_DEFENDING);
 			GET_TEAM(pDefender->getTeam()).AI_changeWarSuccess(getTeam(), iWS);
 			if(ePlotOwner != NO_PLAYER) {
 				TeamTypes ePlotMaster = GET_PLAYER(ePlotOwner).getMasterTeam();
@@ -1665,11 +1665,11 @@ void CvUnit::updateCombat(bool bQuick)
 
 			if (!m_pUnitInfo->isHiddenNationality() && !pDefender->getUnitInfo().isHiddenNationality())
 			{
-				GET_TEAM(pDefender->getTeam()).changeWarWeariness(getTeam(), *pPlot, GC.getDefineINT("WW_UNIT_KILLED_DEFENDING"));
-				GET_TEAM(getTeam()).changeWarWeariness(pDefender->getTeam(), *pPlot, GC.getDefineINT("WW_KILLED_UNIT_ATTACKING"));
+				GET_TEAM(pDefender->getTeam()).changeWarWeariness(getTeam(), *pPlot, GC.getDefineINT(CvGlobals::WW_UNIT_KILLED_DEFENDING));
+				GET_TEAM(getTeam()).changeWarWeariness(pDefender->getTeam(), *pPlot, GC.getDefineINT(CvGlobals::WW_KILLED_UNIT_ATTACKING));
 			}
 			// <advc.130m>
-			int const iWS = GC.getDefineINT("WAR_SUCCESS_ATTACKING");
+			int const iWS = GC.getDefineINT(CvGlobals::WAR_SUCCESS_ATTACKING);
 			GET_TEAM(getTeam()).AI_changeWarSuccess(pDefender->getTeam(), iWS);
 			if(ePlotOwner != NO_PLAYER) { // As above
 				TeamTypes ePlotMaster = GET_PLAYER(ePlotOwner).getMasterTeam();
@@ -2765,7 +2765,7 @@ bool CvUnit::canMoveInto(const CvPlot* pPlot, bool bAttack, bool bDeclareWar, bo
 	case DOMAIN_LAND:
 		if (pPlot->isWater() && !canMoveAllTerrain())
 		{
-			if (!pPlot->isCity() || 0 == GC.getDefineINT("LAND_UNITS_CAN_ATTACK_WATER_CITIES"))
+			if (!pPlot->isCity() || 0 == GC.getDefineINT(CvGlobals::LAND_UNITS_CAN_ATTACK_WATER_CITIES))
 			{
 				//if (bIgnoreLoad || !isHuman() || plot()->isWater() || !canLoad(pPlot))
 				if (bIgnoreLoad || plot()->isWater() || !canLoad(pPlot)) // K-Mod. (AI might want to load into a boat on the coast)
@@ -3829,7 +3829,7 @@ bool CvUnit::canUnload() const
 			}
 			else
 			{
-				if (iNumAirUnits >= GC.getDefineINT("CITY_AIR_UNIT_CAPACITY"))
+				if (iNumAirUnits >= GC.getDefineINT(CvGlobals::CITY_AIR_UNIT_CAPACITY))
 				{
 					return false;
 				}
@@ -4059,15 +4059,15 @@ int CvUnit::healRate(const CvPlot* pPlot, bool bLocation, bool bUnits) const
 		bool bFriendly = GET_TEAM(getTeam()).isFriendlyTerritory(pPlot->getTeam());
 		if (pPlot->isCity(true, getTeam()))
 		{
-			iTotalHeal += //GC.getDefineINT("CITY_HEAL_RATE") + // advc.023: Moved
+			iTotalHeal += //GC.getDefineINT(CvGlobals::CITY_HEAL_RATE) + // advc.023: Moved
 					(bFriendly ? getExtraFriendlyHeal() : getExtraNeutralHeal());
 			if (pCity && !pCity->isOccupation())
 			{
 				iTotalHeal += pCity->getHealRate()
-						+ GC.getDefineINT("CITY_HEAL_RATE"); // <advc.023>
+						+ GC.getDefineINT(CvGlobals::CITY_HEAL_RATE); // <advc.023>
 			}
-			else iTotalHeal += (bFriendly ? GC.getDefineINT("FRIENDLY_HEAL_RATE") :
-					GC.getDefineINT("NEUTRAL_HEAL_RATE")); // </advc.023>
+			else iTotalHeal += (bFriendly ? GC.getDefineINT(CvGlobals::FRIENDLY_HEAL_RATE) :
+					GC.getDefineINT(CvGlobals::NEUTRAL_HEAL_RATE)); // </advc.023>
 		}
 		else
 		{
@@ -4075,16 +4075,16 @@ int CvUnit::healRate(const CvPlot* pPlot, bool bLocation, bool bUnits) const
 			{
 				if (isEnemy(pPlot->getTeam(), pPlot))
 				{
-					iTotalHeal += (GC.getDefineINT("ENEMY_HEAL_RATE") + getExtraEnemyHeal());
+					iTotalHeal += (GC.getDefineINT(CvGlobals::ENEMY_HEAL_RATE) + getExtraEnemyHeal());
 				}
 				else
 				{
-					iTotalHeal += (GC.getDefineINT("NEUTRAL_HEAL_RATE") + getExtraNeutralHeal());
+					iTotalHeal += (GC.getDefineINT(CvGlobals::NEUTRAL_HEAL_RATE) + getExtraNeutralHeal());
 				}
 			}
 			else
 			{
-				iTotalHeal += (GC.getDefineINT("FRIENDLY_HEAL_RATE") + getExtraFriendlyHeal());
+				iTotalHeal += (GC.getDefineINT(CvGlobals::FRIENDLY_HEAL_RATE) + getExtraFriendlyHeal());
 			}
 		}
 	}
@@ -4459,11 +4459,11 @@ bool CvUnit::nuke(int iX, int iY) {
 	for(iI = 0; iI < MAX_CIV_TEAMS; iI++) { // advc.003n: was MAX_TEAMS
 		if(aiTeamsAffected[iI]) {
 			GET_TEAM((TeamTypes)iI).changeWarWeariness(getTeam(),
-					100 * GC.getDefineINT("WW_HIT_BY_NUKE"));
+					100 * GC.getDefineINT(CvGlobals::WW_HIT_BY_NUKE));
 			GET_TEAM(getTeam()).changeWarWeariness(((TeamTypes)iI),
-					100 * GC.getDefineINT("WW_ATTACKED_WITH_NUKE"));
+					100 * GC.getDefineINT(CvGlobals::WW_ATTACKED_WITH_NUKE));
 			GET_TEAM(getTeam()).AI_changeWarSuccess(((TeamTypes)iI),
-					GC.getDefineINT("WAR_SUCCESS_NUKE"));
+					GC.getDefineINT(CvGlobals::WAR_SUCCESS_NUKE));
 		}
 	}
 	CvCity const* pReplayCity = NULL; // advc.106
@@ -5176,7 +5176,7 @@ bool CvUnit::pillage()
 	if (pPlot->isWater())
 	{
 		CvUnit* pInterceptor = bestSeaPillageInterceptor(this,
-				//GC.getDefineINT("COMBAT_DIE_SIDES") / 2
+				//GC.getDefineINT(CvGlobals::COMBAT_DIE_SIDES) / 2
 				GC.getCOMBAT_DIE_SIDES() / 2); // UncutDragon
 		if (NULL != pInterceptor)
 		{
@@ -5352,7 +5352,7 @@ void CvUnit::blockadeRange(std::vector<CvPlot*>& r, int iExtra) const {
 	// See comment in WarAndPeaceCache::updateTrainCargo
 	bool bImpassables = (getDomainType() == DOMAIN_SEA && GET_PLAYER(getOwnerINLINE()).
 			AI_unitImpassableCount(getUnitType()) > 0);
-	int iRange = GC.getDefineINT("SHIP_BLOCKADE_RANGE");
+	int iRange = GC.getDefineINT(CvGlobals::SHIP_BLOCKADE_RANGE);
 	for(int i = -iRange; i <= iRange; i++) {
 		for(int j = -iRange; j <= iRange; j++) {
 			CvPlot* pLoopPlot = ::plotXY(getX_INLINE(), getY_INLINE(), i, j);
@@ -5429,7 +5429,7 @@ void CvUnit::updatePlunder(int iChange, bool bUpdatePlotGroups)
 
 int CvUnit::sabotageCost(const CvPlot* pPlot) const
 {
-	return GC.getDefineINT("BASE_SPY_SABOTAGE_COST");
+	return GC.getDefineINT(CvGlobals::BASE_SPY_SABOTAGE_COST);
 }
 
 // XXX compare with destroy prob...
@@ -5597,7 +5597,7 @@ int CvUnit::destroyCost(const CvPlot* pPlot) const
 		bLimited = isLimitedProject(pCity->getProductionProject());
 	}
 
-	return (GC.getDefineINT("BASE_SPY_DESTROY_COST") + (pCity->getProduction() * ((bLimited) ? GC.getDefineINT("SPY_DESTROY_COST_MULTIPLIER_LIMITED") : GC.getDefineINT("SPY_DESTROY_COST_MULTIPLIER"))));
+	return (GC.getDefineINT(CvGlobals::BASE_SPY_DESTROY_COST) + (pCity->getProduction() * ((bLimited) ? GC.getDefineINT(CvGlobals::SPY_DESTROY_COST_MULTIPLIER_LIMITED) : GC.getDefineINT(CvGlobals::SPY_DESTROY_COST_MULTIPLIER))));
 }
 
 
@@ -5753,7 +5753,7 @@ int CvUnit::stealPlansCost(const CvPlot* pPlot) const
 		return 0;
 	}
 
-	return (GC.getDefineINT("BASE_SPY_STEAL_PLANS_COST") + ((GET_TEAM(pCity->getTeam()).getTotalLand() + GET_TEAM(pCity->getTeam()).getTotalPopulation()) * GC.getDefineINT("SPY_STEAL_PLANS_COST_MULTIPLIER")));
+	return (GC.getDefineINT(CvGlobals::BASE_SPY_STEAL_PLANS_COST) + ((GET_TEAM(pCity->getTeam()).getTotalLand() + GET_TEAM(pCity->getTeam()).getTotalPopulation()) * GC.getDefineINT(CvGlobals::SPY_STEAL_PLANS_COST_MULTIPLIER)));
 }
 
 
@@ -6035,7 +6035,7 @@ bool CvUnit::spread(ReligionTypes eReligion)
 			bSuccess = false;*/
 			// K-Mod. Instead of simply failing, give some chance of removing one of the existing religions.
 			std::vector<std::pair<int, ReligionTypes> > rankedReligions;
-			int iRandomWeight = GC.getDefineINT("RELIGION_INFLUENCE_RANDOM_WEIGHT");
+			int iRandomWeight = GC.getDefineINT(CvGlobals::RELIGION_INFLUENCE_RANDOM_WEIGHT);
 			for (int iI = 0; iI < GC.getNumReligionInfos(); iI++)
 			{
 				if (pCity->isHasReligion((ReligionTypes)iI) || iI == eReligion)
@@ -6175,7 +6175,7 @@ int CvUnit::spreadCorporationCost(CorporationTypes eCorporation, CvCity* pCity)
 	{
 		if (getTeam() != pCity->getTeam() && !GET_TEAM(pCity->getTeam()).isVassal(getTeam()))
 		{
-			iCost *= GC.getDefineINT("CORPORATION_FOREIGN_SPREAD_COST_PERCENT");
+			iCost *= GC.getDefineINT(CvGlobals::CORPORATION_FOREIGN_SPREAD_COST_PERCENT);
 			iCost /= 100;
 		}
 
@@ -6676,7 +6676,7 @@ bool CvUnit::greatWork()
 
 		int iCultureToAdd = 100 * getGreatWorkCulture(plot());
 		/* original bts code
-		int iNumTurnsApplied = (GC.getDefineINT("GREAT_WORKS_CULTURE_TURNS") * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getUnitGreatWorkPercent()) / 100;
+		int iNumTurnsApplied = (GC.getDefineINT(CvGlobals::GREAT_WORKS_CULTURE_TURNS) * GC.getGameSpeedInfo(GC.getGameINLINE().getGameSpeedType()).getUnitGreatWorkPercent()) / 100;
 		for (int i = 0; i < iNumTurnsApplied; ++i)
 			pCity->changeCultureTimes100(getOwnerINLINE(), iCultureToAdd / iNumTurnsApplied, true, true);
 		if (iNumTurnsApplied > 0)
@@ -6872,7 +6872,7 @@ bool CvUnit::espionage(EspionageMissionTypes eMission, int iData)
 				NotifyEntity(MISSION_ESPIONAGE);
 			}
 
-			if (!testSpyIntercepted(eTargetPlayer, true, GC.getDefineINT("ESPIONAGE_SPY_MISSION_ESCAPE_MOD")))
+			if (!testSpyIntercepted(eTargetPlayer, true, GC.getDefineINT(CvGlobals::ESPIONAGE_SPY_MISSION_ESCAPE_MOD)))
 			{
 				setFortifyTurns(0);
 				setMadeAttack(true);
@@ -6950,7 +6950,7 @@ bool CvUnit::testSpyIntercepted(PlayerTypes eTargetPlayer, bool bMission, int iM
 	CvWString szBuffer = gDLL->getText(szFormatReveal.GetCString(), GET_PLAYER(getOwnerINLINE()).getCivilizationAdjectiveKey(), getNameKey(), kTargetPlayer.getCivilizationAdjectiveKey(), szCityName.GetCString());
 	gDLL->getInterfaceIFace()->addHumanMessage(getOwnerINLINE(), true, GC.getEVENT_MESSAGE_TIME(), szBuffer, "AS2D_EXPOSED", MESSAGE_TYPE_INFO, getButton(), (ColorTypes)GC.getInfoTypeForString("COLOR_RED"), getX_INLINE(), getY_INLINE(), true, true);
 
-	if (GC.getGameINLINE().getSorenRandNum(100, "Spy Reveal identity") < GC.getDefineINT("ESPIONAGE_SPY_REVEAL_IDENTITY_PERCENT"))
+	if (GC.getGameINLINE().getSorenRandNum(100, "Spy Reveal identity") < GC.getDefineINT(CvGlobals::ESPIONAGE_SPY_REVEAL_IDENTITY_PERCENT))
 	{
 		if (!isEnemy(kTargetPlayer.getTeam()))
 		{   // advc.130j:
@@ -6985,7 +6985,7 @@ int CvUnit::getSpyInterceptPercent(TeamTypes eTargetTeam, bool bMission) const
 	/* original bts code
 	int iTargetPoints = GET_TEAM(eTargetTeam).getEspionagePointsEver();
 	int iOurPoints = GET_TEAM(getTeam()).getEspionagePointsEver();
-	iSuccess += (GC.getDefineINT("ESPIONAGE_INTERCEPT_SPENDING_MAX") * iTargetPoints) / std::max(1, iTargetPoints + iOurPoints); */
+	iSuccess += (GC.getDefineINT(CvGlobals::ESPIONAGE_INTERCEPT_SPENDING_MAX) * iTargetPoints) / std::max(1, iTargetPoints + iOurPoints); */
 	// K-Mod. Scale based on the teams' population.
 	{
 		const CvTeam& kTeam = GET_TEAM(getTeam());
@@ -6994,25 +6994,25 @@ int CvUnit::getSpyInterceptPercent(TeamTypes eTargetTeam, bool bMission) const
 		int iPopScale = 5 * GC.getWorldInfo(GC.getMapINLINE().getWorldSize()).getTargetNumCities();
 		int iTargetPoints = 10 * kTargetTeam.getEspionagePointsEver() / std::max(1, iPopScale + kTargetTeam.getTotalPopulation(false));
 		int iOurPoints = 10 * kTeam.getEspionagePointsEver() / std::max(1, iPopScale + kTeam.getTotalPopulation(false));
-		iSuccess += GC.getDefineINT("ESPIONAGE_INTERCEPT_SPENDING_MAX") * iTargetPoints / std::max(1, iTargetPoints + iOurPoints);
+		iSuccess += GC.getDefineINT(CvGlobals::ESPIONAGE_INTERCEPT_SPENDING_MAX) * iTargetPoints / std::max(1, iTargetPoints + iOurPoints);
 	}
 	// K-Mod end
 
 	if (plot()->isEspionageCounterSpy(eTargetTeam))
 	{
-		iSuccess += GC.getDefineINT("ESPIONAGE_INTERCEPT_COUNTERSPY");
+		iSuccess += GC.getDefineINT(CvGlobals::ESPIONAGE_INTERCEPT_COUNTERSPY);
 	}
 
 	if (GET_TEAM(eTargetTeam).getCounterespionageModAgainstTeam(getTeam()) > 0)
 	{
-		iSuccess += GC.getDefineINT("ESPIONAGE_INTERCEPT_COUNTERESPIONAGE_MISSION");
+		iSuccess += GC.getDefineINT(CvGlobals::ESPIONAGE_INTERCEPT_COUNTERESPIONAGE_MISSION);
 	}
 
 	// K-Mod. I've added the following condition for the recent mission bonus, to make spies less likely to be caught while exploring during peace time.
 	if (bMission || atWar(getTeam(), eTargetTeam) || GET_TEAM(eTargetTeam).getCounterespionageModAgainstTeam(getTeam()) > 0 || plot()->isEspionageCounterSpy(eTargetTeam)) // K-Mod
 	{
 		if (0 == getFortifyTurns() || plot()->plotCount(PUF_isSpy, -1, -1, NO_PLAYER, getTeam()) > 1)
-			iSuccess += GC.getDefineINT("ESPIONAGE_INTERCEPT_RECENT_MISSION");
+			iSuccess += GC.getDefineINT(CvGlobals::ESPIONAGE_INTERCEPT_RECENT_MISSION);
 	}
 
 	return std::min(100, std::max(0, iSuccess));
@@ -7381,9 +7381,9 @@ bool CvUnit::giveExperience()  // advc.003: some style changes
 int CvUnit::getStackExperienceToGive(int iNumUnits) const
 {
 	return (m_pUnitInfo->getLeaderExperience() * (100 + std::min(
-			//50, (iNumUnits - 1) * GC.getDefineINT("WARLORD_EXTRA_EXPERIENCE_PER_UNIT_PERCENT")))) / 100;
+			//50, (iNumUnits - 1) * GC.getDefineINT(CvGlobals::WARLORD_EXTRA_EXPERIENCE_PER_UNIT_PERCENT)))) / 100;
 			// K-Mod, +50% is too low as a maximum.
-			GC.getDefineINT("WARLORD_MAXIMUM_EXTRA_EXPERIENCE_PERCENT"), (iNumUnits - 1) * GC.getDefineINT("WARLORD_EXTRA_EXPERIENCE_PER_UNIT_PERCENT")))) / 100;
+			GC.getDefineINT(CvGlobals::WARLORD_MAXIMUM_EXTRA_EXPERIENCE_PERCENT), (iNumUnits - 1) * GC.getDefineINT(CvGlobals::WARLORD_EXTRA_EXPERIENCE_PER_UNIT_PERCENT)))) / 100;
 }
 
 int CvUnit::upgradePrice(UnitTypes eUnit) const
@@ -7400,9 +7400,9 @@ int CvUnit::upgradePrice(UnitTypes eUnit) const
 	if (isBarbarian())
 		return 0;
 
-	int iPrice = GC.getDefineINT("BASE_UNIT_UPGRADE_COST");
+	int iPrice = GC.getDefineINT(CvGlobals::BASE_UNIT_UPGRADE_COST);
 
-	iPrice += (std::max(0, (GET_PLAYER(getOwnerINLINE()).getProductionNeeded(eUnit) - GET_PLAYER(getOwnerINLINE()).getProductionNeeded(getUnitType()))) * GC.getDefineINT("UNIT_UPGRADE_COST_PER_PRODUCTION"));
+	iPrice += (std::max(0, (GET_PLAYER(getOwnerINLINE()).getProductionNeeded(eUnit) - GET_PLAYER(getOwnerINLINE()).getProductionNeeded(getUnitType()))) * GC.getDefineINT(CvGlobals::UNIT_UPGRADE_COST_PER_PRODUCTION));
 
 	if (!isHuman() && !isBarbarian())
 	{
@@ -7423,7 +7423,7 @@ int CvUnit::upgradeXPChange(UnitTypes eUnit) const {
 	if(getLeaderUnitType() != NO_UNIT)
 		return 0;
 
-	return std::min(0, GC.getDefineINT("MAX_EXPERIENCE_AFTER_UPGRADE") -
+	return std::min(0, GC.getDefineINT(CvGlobals::MAX_EXPERIENCE_AFTER_UPGRADE) -
 			getExperience());
 } // </advc.080>
 
@@ -7848,7 +7848,7 @@ bool CvUnit::isHuman() const
 
 int CvUnit::visibilityRange() const
 {
-	return (GC.getDefineINT("UNIT_VISIBILITY_RANGE") + getExtraVisibilityRange());
+	return (GC.getDefineINT(CvGlobals::UNIT_VISIBILITY_RANGE) + getExtraVisibilityRange());
 }
 
 
@@ -8484,7 +8484,7 @@ int CvUnit::maxCombatStr(const CvPlot* pPlot, const CvUnit* pAttacker, CombatDet
 
 			if (pAttacker->isBarbarian())
 			{
-				iExtraModifier = GC.getDefineINT("CITY_BARBARIAN_DEFENSE_MODIFIER");
+				iExtraModifier = GC.getDefineINT(CvGlobals::CITY_BARBARIAN_DEFENSE_MODIFIER);
 				iTempModifier += iExtraModifier;
 				if (pCombatDetails != NULL)
 				{
@@ -8763,7 +8763,7 @@ bool CvUnit::canDefend(const CvPlot* pPlot) const
 
 	if (!pPlot->isValidDomainForAction(*this))
 	{
-		if (GC.getDefineINT("LAND_UNITS_CAN_ATTACK_WATER_CITIES") == 0)
+		if (GC.getDefineINT(CvGlobals::LAND_UNITS_CAN_ATTACK_WATER_CITIES) == 0)
 		{
 			return false;
 		}
@@ -8928,7 +8928,7 @@ int CvUnit::airCombatDamage(const CvUnit* pDefender) const
 
 	int iStrengthFactor = ((iOurStrength + iTheirStrength + 1) / 2);
 
-	int iDamage = std::max(1, ((GC.getDefineINT("AIR_COMBAT_DAMAGE") * (iOurStrength + iStrengthFactor)) / (iTheirStrength + iStrengthFactor)));
+	int iDamage = std::max(1, ((GC.getDefineINT(CvGlobals::AIR_COMBAT_DAMAGE) * (iOurStrength + iStrengthFactor)) / (iTheirStrength + iStrengthFactor)));
 
 	CvCity* pCity = pPlot->getPlotCity();
 
@@ -8952,7 +8952,7 @@ int CvUnit::rangeCombatDamage(const CvUnit* pDefender) const
 
 	int iStrengthFactor = ((iOurStrength + iTheirStrength + 1) / 2);
 
-	int iDamage = std::max(1, ((GC.getDefineINT("RANGE_COMBAT_DAMAGE") * (iOurStrength + iStrengthFactor)) / (iTheirStrength + iStrengthFactor)));
+	int iDamage = std::max(1, ((GC.getDefineINT(CvGlobals::RANGE_COMBAT_DAMAGE) * (iOurStrength + iStrengthFactor)) / (iTheirStrength + iStrengthFactor)));
 
 	return iDamage;
 }
@@ -9125,12 +9125,12 @@ int CvUnit::maxXPValue() const
 
 	if (isAnimal())
 	{
-		iMaxValue = std::min(iMaxValue, GC.getDefineINT("ANIMAL_MAX_XP_VALUE"));
+		iMaxValue = std::min(iMaxValue, GC.getDefineINT(CvGlobals::ANIMAL_MAX_XP_VALUE));
 	}
 
 	if (isBarbarian())
 	{
-		iMaxValue = std::min(iMaxValue, GC.getDefineINT("BARBARIAN_MAX_XP_VALUE"));
+		iMaxValue = std::min(iMaxValue, GC.getDefineINT(CvGlobals::BARBARIAN_MAX_XP_VALUE));
 	}
 
 	return iMaxValue;
@@ -9809,6 +9809,9 @@ void CvUnit::setXY(int iX, int iY, bool bGroup, bool bUpdate, bool bShow, bool b
 	else eOldActivityType = NO_ACTIVITY;*/
 
 	setBlockading(false);
+	/*  advc.003z: War evaluation counts units by position
+		(TacticalSituation::evalEngagement) */
+	getWPAI.invalidateTurnCache();
 
 	/* original bts code
 	if (!bGroup || isCargo()) {
@@ -9874,9 +9877,9 @@ void CvUnit::setXY(int iX, int iY, bool bGroup, bool bUpdate, bool bShow, bool b
 							{
 								if (!m_pUnitInfo->isHiddenNationality() && !pLoopUnit->getUnitInfo().isHiddenNationality())
 								{
-									GET_TEAM(pLoopUnit->getTeam()).changeWarWeariness(getTeam(), *pNewPlot, GC.getDefineINT("WW_UNIT_CAPTURED"));
-									GET_TEAM(getTeam()).changeWarWeariness(pLoopUnit->getTeam(), *pNewPlot, GC.getDefineINT("WW_CAPTURED_UNIT"));
-									GET_TEAM(getTeam()).AI_changeWarSuccess(pLoopUnit->getTeam(), GC.getDefineINT("WAR_SUCCESS_UNIT_CAPTURING"));
+									GET_TEAM(pLoopUnit->getTeam()).changeWarWeariness(getTeam(), *pNewPlot, GC.getDefineINT(CvGlobals::WW_UNIT_CAPTURED));
+									GET_TEAM(getTeam()).changeWarWeariness(pLoopUnit->getTeam(), *pNewPlot, GC.getDefineINT(CvGlobals::WW_CAPTURED_UNIT));
+									GET_TEAM(getTeam()).AI_changeWarSuccess(pLoopUnit->getTeam(), GC.getDefineINT(CvGlobals::WAR_SUCCESS_UNIT_CAPTURING));
 								}
 
 								//if (!isNoCapture())
@@ -10007,9 +10010,9 @@ void CvUnit::setXY(int iX, int iY, bool bGroup, bool bUpdate, bool bShow, bool b
 		{
 			if (isEnemy(pNewCity->getTeam()) && !canCoexistWithEnemyUnit(pNewCity->getTeam()) && canFight())
 			{
-				GET_TEAM(getTeam()).changeWarWeariness(pNewCity->getTeam(), *pNewPlot, GC.getDefineINT("WW_CAPTURED_CITY"));
+				GET_TEAM(getTeam()).changeWarWeariness(pNewCity->getTeam(), *pNewPlot, GC.getDefineINT(CvGlobals::WW_CAPTURED_CITY));
 				/* original bts code
-				GET_TEAM(getTeam()).AI_changeWarSuccess(pNewCity->getTeam(), GC.getDefineINT("WAR_SUCCESS_CITY_CAPTURING"));*/
+				GET_TEAM(getTeam()).AI_changeWarSuccess(pNewCity->getTeam(), GC.getDefineINT(CvGlobals::WAR_SUCCESS_CITY_CAPTURING));*/
 				// BETTER_BTS_AI_MOD, General AI, 06/14/09, jdog5000				
 				// Double war success if capturing capital city, always a significant blow to enemy
 				// pNewCity still points to old city here, hasn't been acquired yet
@@ -10315,7 +10318,7 @@ void CvUnit::setReconPlot(CvPlot* pNewValue)
 	{
 		if (pOldPlot != NULL)
 		{
-			pOldPlot->changeAdjacentSight(getTeam(), GC.getDefineINT("RECON_VISIBILITY_RANGE"), false, this, true);
+			pOldPlot->changeAdjacentSight(getTeam(), GC.getDefineINT(CvGlobals::RECON_VISIBILITY_RANGE), false, this, true);
 			pOldPlot->changeReconCount(-1); // changeAdjacentSight() tests for getReconCount()
 		}
 
@@ -10330,7 +10333,7 @@ void CvUnit::setReconPlot(CvPlot* pNewValue)
 			m_iReconY = pNewValue->getY_INLINE();
 
 			pNewValue->changeReconCount(1); // changeAdjacentSight() tests for getReconCount()
-			pNewValue->changeAdjacentSight(getTeam(), GC.getDefineINT("RECON_VISIBILITY_RANGE"), true, this, true);
+			pNewValue->changeAdjacentSight(getTeam(), GC.getDefineINT(CvGlobals::RECON_VISIBILITY_RANGE), true, this, true);
 			m_iLastReconTurn = GC.getGameINLINE().getGameTurn(); // advc.029
 		}
 	}
@@ -10635,7 +10638,7 @@ int CvUnit::getFortifyTurns() const
 
 void CvUnit::setFortifyTurns(int iNewValue)
 {
-	iNewValue = range(iNewValue, 0, GC.getDefineINT("MAX_FORTIFY_TURNS"));
+	iNewValue = range(iNewValue, 0, GC.getDefineINT(CvGlobals::MAX_FORTIFY_TURNS));
 
 	if (iNewValue != getFortifyTurns())
 	{
@@ -11503,7 +11506,7 @@ void CvUnit::setCombatUnit(CvUnit* pCombatUnit, bool bAttacking)
 				&& !m_pUnitInfo->isIgnoreBuildingDefense()
 				&& pCombatUnit->plot()->getPlotCity() 
 				&& pCombatUnit->plot()->getPlotCity()->getBuildingDefense() > 0 
-				&& cityAttackModifier() >= GC.getDefineINT("MIN_CITY_ATTACK_MODIFIER_FOR_SIEGE_TOWER")) */
+				&& cityAttackModifier() >= GC.getDefineINT(CvGlobals::MIN_CITY_ATTACK_MODIFIER_FOR_SIEGE_TOWER)) */
 			if (showSiegeTower(pCombatUnit)) // K-Mod
 			{
 				CvDLLEntity::SetSiegeTower(true);
@@ -11557,7 +11560,7 @@ bool CvUnit::showSiegeTower(CvUnit* pDefender) const
 		&& !m_pUnitInfo->isIgnoreBuildingDefense()
 		&& pDefender->plot()->getPlotCity()
 		&& pDefender->plot()->getPlotCity()->getBuildingDefense() > 0
-		&& cityAttackModifier() >= GC.getDefineINT("MIN_CITY_ATTACK_MODIFIER_FOR_SIEGE_TOWER");
+		&& cityAttackModifier() >= GC.getDefineINT(CvGlobals::MIN_CITY_ATTACK_MODIFIER_FOR_SIEGE_TOWER);
 }
 // K-Mod end
 
@@ -11955,17 +11958,17 @@ bool CvUnit::isPromotionValid(PromotionTypes ePromotion) const
 
 	CvPromotionInfo& promotionInfo = GC.getPromotionInfo(ePromotion);
 
-	if (promotionInfo.getWithdrawalChange() + m_pUnitInfo->getWithdrawalProbability() + getExtraWithdrawal() > GC.getDefineINT("MAX_WITHDRAWAL_PROBABILITY"))
+	if (promotionInfo.getWithdrawalChange() + m_pUnitInfo->getWithdrawalProbability() + getExtraWithdrawal() > GC.getDefineINT(CvGlobals::MAX_WITHDRAWAL_PROBABILITY))
 	{
 		return false;
 	}
 
-	if (promotionInfo.getInterceptChange() + maxInterceptionProbability() > GC.getDefineINT("MAX_INTERCEPTION_PROBABILITY"))
+	if (promotionInfo.getInterceptChange() + maxInterceptionProbability() > GC.getDefineINT(CvGlobals::MAX_INTERCEPTION_PROBABILITY))
 	{
 		return false;
 	}
 
-	if (promotionInfo.getEvasionChange() + evasionProbability() > GC.getDefineINT("MAX_EVASION_PROBABILITY"))
+	if (promotionInfo.getEvasionChange() + evasionProbability() > GC.getDefineINT(CvGlobals::MAX_EVASION_PROBABILITY))
 	{
 		return false;
 	}
@@ -12441,7 +12444,7 @@ void CvUnit::collateralCombat(const CvPlot* pPlot, CvUnit* pSkipUnit)
 
 			int iStrengthFactor = ((iCollateralStrength + iTheirStrength + 1) / 2);
 
-			int iCollateralDamage = (GC.getDefineINT("COLLATERAL_COMBAT_DAMAGE") * (iCollateralStrength + iStrengthFactor)) / (iTheirStrength + iStrengthFactor);
+			int iCollateralDamage = (GC.getDefineINT(CvGlobals::COLLATERAL_COMBAT_DAMAGE) * (iCollateralStrength + iStrengthFactor)) / (iTheirStrength + iStrengthFactor);
 
 			iCollateralDamage *= 100 + getExtraCollateralDamage();
 
@@ -12793,7 +12796,7 @@ bool CvUnit::rangeStrike(int iX, int iY)
 	FAssert(pDefender != NULL);
 	FAssert(pDefender->canDefend());
 
-	if (GC.getDefineINT("RANGED_ATTACKS_USE_MOVES") == 0)
+	if (GC.getDefineINT(CvGlobals::RANGED_ATTACKS_USE_MOVES) == 0)
 	{
 		setMadeAttack(true);
 	}
@@ -12893,7 +12896,7 @@ int CvUnit::planBattle(CvBattleDefinition& kBattle, const std::vector<int>& comb
 
 	static const int iStandardNumRounds = GC.getDefineINT("STANDARD_BATTLE_ANIMATION_ROUNDS", 6);
 	// <advc.002m>
-	static const int iPerEraNumRounds = GC.getDefineINT("PER_ERA_BATTLE_ANIMATION_ROUNDS");
+	static const int iPerEraNumRounds = GC.getDefineINT(CvGlobals::PER_ERA_BATTLE_ANIMATION_ROUNDS);
 	CvGame const& g = GC.getGameINLINE();
 	bool bNetworkedMP = g.isNetworkMultiPlayer();
 	/*  I prefer using the player era, but karadoc's comment at the end of
@@ -13017,9 +13020,9 @@ int CvUnit::planBattle(CvBattleDefinition& kBattle, const std::vector<int>& comb
 			kBattle.getNumRangedRounds() * BATTLE_TURNS_MELEE +
 			extraTime;
 	// <advc.002m>
-	static int const iTruncate = GC.getDefineINT("TRUNCATE_ANIMATIONS");
-	static int const iTruncateEra = GC.getDefineINT("TRUNCATE_ANIMATIONS_ERA");
-	static int const iTruncateTurns = std::max(2, GC.getDefineINT("TRUNCATE_ANIMATION_TURNS"));
+	static int const iTruncate = GC.getDefineINT(CvGlobals::TRUNCATE_ANIMATIONS);
+	static int const iTruncateEra = GC.getDefineINT(CvGlobals::TRUNCATE_ANIMATIONS_ERA);
+	static int const iTruncateTurns = std::max(2, GC.getDefineINT(CvGlobals::TRUNCATE_ANIMATION_TURNS));
 	if(iTruncate <= 0 || iEra < iTruncateEra)
 		return r;
 	bool bHumanDefense = pDefenceUnit->isHuman();
@@ -790,8 +790,8 @@ int CvUnitAI::AI_attackOdds(const CvPlot* pPlot, bool bPotentialEnemy) const
 	iStrengthFactor = ((iOurFirepower + iTheirFirepower + 1) / 2);
 
 	// original BtS
-	//iDamageToUs = std::max(1,((GC.getDefineINT("COMBAT_DAMAGE") * (iTheirFirepower + iStrengthFactor)) / (iOurFirepower + iStrengthFactor)));
-	//iDamageToThem = std::max(1,((GC.getDefineINT("COMBAT_DAMAGE") * (iOurFirepower + iStrengthFactor)) / (iTheirFirepower + iStrengthFactor)));
+	//iDamageToUs = std::max(1,((GC.getDefineINT(CvGlobals::COMBAT_DAMAGE) * (iTheirFirepower + iStrengthFactor)) / (iOurFirepower + iStrengthFactor)));
+	//iDamageToThem = std::max(1,((GC.getDefineINT(CvGlobals::COMBAT_DAMAGE) * (iOurFirepower + iStrengthFactor)) / (iTheirFirepower + iStrengthFactor)));
 	iDamageToUs = std::max(1,((GC.getCOMBAT_DAMAGE() * (iTheirFirepower + iStrengthFactor)) / (iOurFirepower + iStrengthFactor)));
 	iDamageToThem = std::max(1,((GC.getCOMBAT_DAMAGE() * (iOurFirepower + iStrengthFactor)) / (iTheirFirepower + iStrengthFactor)));
 	// BETTER_BTS_AI_MOD: END
@@ -5681,7 +5681,7 @@ void CvUnitAI::AI_spyMove()
 			{
 				// normal city handling
 
-				if (getFortifyTurns() >= GC.getDefineINT("MAX_FORTIFY_TURNS"))
+				if (getFortifyTurns() >= GC.getDefineINT(CvGlobals::MAX_FORTIFY_TURNS))
 				{
 					if (AI_espionageSpy())
 					{
@@ -5694,8 +5694,8 @@ void CvUnitAI::AI_spyMove()
 					// If we think we'll get caught soon, then do the mission early.
 					int iInterceptChance = getSpyInterceptPercent(plot()->getTeam(), false);
 					iInterceptChance *= 100 + (GET_TEAM(getTeam()).isOpenBorders(plot()->getTeam())
-						? GC.getDefineINT("ESPIONAGE_SPY_NO_INTRUDE_INTERCEPT_MOD")
-						: GC.getDefineINT("ESPIONAGE_SPY_INTERCEPT_MOD"));
+						? GC.getDefineINT(CvGlobals::ESPIONAGE_SPY_NO_INTRUDE_INTERCEPT_MOD)
+						: GC.getDefineINT(CvGlobals::ESPIONAGE_SPY_INTERCEPT_MOD));
 					iInterceptChance /= 100;
 					if (GC.getGameINLINE().getSorenRandNum(100, "AI Spy early attack") < iInterceptChance + getFortifyTurns())
 					{
@@ -5800,7 +5800,7 @@ void CvUnitAI::AI_spyMove()
 		kOwner.AI_isMaliciousEspionageTarget(plot()->getOwner()))
 	{
 		// assume this is the target of our destroy improvement mission.
-		if (getFortifyTurns() >= GC.getDefineINT("MAX_FORTIFY_TURNS"))
+		if (getFortifyTurns() >= GC.getDefineINT(CvGlobals::MAX_FORTIFY_TURNS))
 		{
 			if (AI_espionageSpy())
 			{
@@ -13877,6 +13877,12 @@ CvCity* CvUnitAI::AI_pickTargetCity(int iFlags, int iMaxPathTurns, bool bHuntBar
 	int iLoadTurns = isEnemy(plot()->getTeam()) ? MAX_INT : -1;
 	KmodPathFinder transport_path;
 	// K-Mod end
+	/*  advc.003w: Expand our own paths once (when the first candidate is found)
+		instead of running a separate search for each city - if there is a turn
+		limit. Can't use the group's path finder for that b/c
+		AI_cityTargetStrengthByPath uses it for other groups. */
+	KmodPathFinder target_path;
+	bool bTargetPathExpanded = false;
 
 	CvCity* pTargetCity = area()->getTargetCity(getOwnerINLINE());
 
@@ -13902,8 +13908,28 @@ CvCity* CvUnitAI::AI_pickTargetCity(int iFlags, int iMaxPathTurns, bool bHuntBar
 			{
 				// K-Mod. Look for either a direct land path, or a sea transport path.
 				int iPathTurns = MAX_INT;
-				bool bLandPath = generatePath(pLoopCity->plot(), iFlags, true,
-						&iPathTurns, iMaxPathTurns);
+				/*bool bLandPath = generatePath(pLoopCity->plot(), iFlags, true,
+						&iPathTurns, iMaxPathTurns);*/
+				// <advc.003w>
+				bool bLandPath = false;
+				if (iMaxPathTurns == MAX_INT)
+				{	/*  Expanding w/o a turn limit would flood the whole area;
+						directed searches are cheaper then. */
+					bLandPath = generatePath(pLoopCity->plot(), iFlags, true,
+							&iPathTurns, iMaxPathTurns);
+				}
+				else
+				{
+					if (!bTargetPathExpanded)
+					{
+						target_path.SetSettings(getGroup(), iFlags, iMaxPathTurns);
+						target_path.ExpandFrom(plot());
+						bTargetPathExpanded = true;
+					}
+					bLandPath = target_path.GeneratePath(pLoopCity->plot());
+					if (bLandPath)
+						iPathTurns = target_path.GetPathTurns();
+				} // </advc.003w>
 				if (pLoopCity->isCoastal() && (pBestTransport || iLoadTurns < 0))
 				{
 					// add a random bias in favour of land paths, so that not all stacks try to use boats.
@@ -15222,7 +15248,7 @@ bool CvUnitAI::AI_pirateBlockade()
 
 		int iBlockadedCount = 0;
 		int iPopulationValue = 0;
-		int iRange = GC.getDefineINT("SHIP_BLOCKADE_RANGE") - 1;
+		int iRange = GC.getDefineINT(CvGlobals::SHIP_BLOCKADE_RANGE) - 1;
 		for (int iX = -iRange; iX <= iRange; iX++)
 		{
 			for (int iY = -iRange; iY <= iRange; iY++)
@@ -21699,12 +21725,12 @@ EspionageMissionTypes CvUnitAI::AI_bestPlotEspionage(PlayerTypes& eTargetPlayer,
 			{
 				int iTargetTotal = GET_TEAM(eTargetTeam).getEspionagePointsEver();
 				int iOurTotal = GET_TEAM(getTeam()).getEspionagePointsEver();
-				iBaseIntercept += (GC.getDefineINT("ESPIONAGE_INTERCEPT_SPENDING_MAX") * iTargetTotal) / std::max(1, iTargetTotal + iOurTotal);
+				iBaseIntercept += (GC.getDefineINT(CvGlobals::ESPIONAGE_INTERCEPT_SPENDING_MAX) * iTargetTotal) / std::max(1, iTargetTotal + iOurTotal);
 
 				if (GET_TEAM(eTargetTeam).getCounterespionageModAgainstTeam(getTeam()) > 0)
-					iBaseIntercept += GC.getDefineINT("ESPIONAGE_INTERCEPT_COUNTERESPIONAGE_MISSION");
+					iBaseIntercept += GC.getDefineINT(CvGlobals::ESPIONAGE_INTERCEPT_COUNTERESPIONAGE_MISSION);
 			}
-			int iEscapeCost = 2*iSpyValue * iBaseIntercept * (100+GC.getDefineINT("ESPIONAGE_SPY_MISSION_ESCAPE_MOD")) / 10000;
+			int iEscapeCost = 2*iSpyValue * iBaseIntercept * (100+GC.getDefineINT(CvGlobals::ESPIONAGE_SPY_MISSION_ESCAPE_MOD)) / 10000;
 
 			// One espionage mission loop to rule them all.
 			for (int iMission = 0; iMission < GC.getNumEspionageMissionInfos(); ++iMission)
@@ -22531,7 +22557,7 @@ int CvUnitAI::AI_finalOddsThreshold(CvPlot* pPlot, int iOddsThreshold)
 	{
 		if (pCity->getDefenseDamage() < ((GC.getMAX_CITY_DEFENSE_DAMAGE() * 3) / 4))
 		{
-			iFinalOddsThreshold += std::max(0, (pCity->getDefenseDamage() - pCity->getLastDefenseDamage() - (GC.getDefineINT("CITY_DEFENSE_DAMAGE_HEAL_RATE") * 2)));
+			iFinalOddsThreshold += std::max(0, (pCity->getDefenseDamage() - pCity->getLastDefenseDamage() - (GC.getDefineINT(CvGlobals::CITY_DEFENSE_DAMAGE_HEAL_RATE) * 2)));
 		}
 	}
 	/* original bts code
@@ -347,9 +347,12 @@ int CvXMLLoadUtility::FindInInfoClass(const TCHAR* pszVal, bool hideAssert)
 //------------------------------------------------------------------------------------------------------
 bool CvXMLLoadUtility::LoadCivXml(FXml* pFXml, const TCHAR* szFilename)
 {
+	/*  advc.003t: Was PROFILE(szLog) with szLog containing szFilename. The
+		static sample keeps the name of the first call, and the internal
+		profiler no longer copies the name, so szLog would dangle. */
+	PROFILE_FUNC();
 	char szLog[256];
 	sprintf(szLog, "LoadCivXml (%s)", szFilename);
-	PROFILE(szLog);
 	OutputDebugString(szLog);
 	OutputDebugString("\n");
 
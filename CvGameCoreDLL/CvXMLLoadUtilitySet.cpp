@@ -379,6 +379,8 @@ bool CvXMLLoadUtility::SetPostGlobalsGlobalDefines()
 		idx = FindInInfoClass(szVal);
 		GC.getDefinesVarSystem()->SetValue("BARBARIAN_LEADER", idx);
 
+		GC.cacheIntGlobalDefines(); // advc.003ah
+
 		return true;
 	}
 
@@ -1364,9 +1366,9 @@ void CvXMLLoadUtility::SetGameText(const char* szTextGroup, const char* szTagNam
 template <class T>
 void CvXMLLoadUtility::SetGlobalClassInfo(std::vector<T*>& aInfos, const char* szTagName, bool bTwoPass)
 {
+	PROFILE_FUNC(); // advc.003t: was PROFILE(szLog); see LoadCivXml.
 	char szLog[256];
 	sprintf(szLog, "SetGlobalClassInfo (%s)", szTagName);
-	PROFILE(szLog);
 	logMsg(szLog);
 
 	// if we successfully locate the tag name in the xml file
@@ -1444,9 +1446,9 @@ void CvXMLLoadUtility::SetGlobalClassInfo(std::vector<T*>& aInfos, const char* s
 
 void CvXMLLoadUtility::SetDiplomacyInfo(std::vector<CvDiplomacyInfo*>& DiploInfos, const char* szTagName)
 {
+	PROFILE_FUNC(); // advc.003t: was PROFILE(szLog); see LoadCivXml.
 	char szLog[256];
 	sprintf(szLog, "SetDiplomacyInfo (%s)", szTagName);
-	PROFILE(szLog);
 	logMsg(szLog);
 
 	// if we successfully locate the tag name in the xml file
@@ -1494,7 +1496,14 @@ void CvXMLLoadUtility::LoadGlobalClassInfo(std::vector<T*>& aInfos,
 		const char* szXmlPath, bool bTwoPass,
 		CvCacheObject* (CvDLLUtilityIFaceBase::*pArgFunction) (const TCHAR*))
 {
-	pArgFunction = NULL; // advc.003i: Disable XML cache
+	/*  advc.003i: Disable XML cache
+		advc.003ai: Only disable it when the CvInfo serialization isn't
+		compiled or when modules are loaded; the EXE doesn't check those
+		for changes. */
+#if SERIALIZE_CVINFOS
+	if (gDLL->isModularXMLLoading())
+#endif
+		pArgFunction = NULL;
 	bool bLoaded = false;
 	bool bWriteCache = true;
 	CvCacheObject* pCache = NULL;
@@ -1547,8 +1556,8 @@ void CvXMLLoadUtility::LoadGlobalClassInfo(std::vector<T*>& aInfos,
 					}
 				}
 			}
-			// advc.003i: Disabled
-			/*if (NULL != pArgFunction && bWriteCache) {
+			// advc.003i: Disabled; advc.003ai: Enabled again.
+			if (NULL != pArgFunction && bWriteCache) {
 				// write info to cache
 				bool bOk = gDLL->cacheWrite(pCache);
 				if (!bOk) {
@@ -1558,7 +1567,7 @@ void CvXMLLoadUtility::LoadGlobalClassInfo(std::vector<T*>& aInfos,
 				}
 				if (bOk)
 					logMsg("Wrote %s to cache", szFileDirectory);
-			}*/
+			}
 		}
 	}
 
@@ -1571,6 +1580,11 @@ void CvXMLLoadUtility::LoadGlobalClassInfo(std::vector<T*>& aInfos,
 
 void CvXMLLoadUtility::LoadDiplomacyInfo(std::vector<CvDiplomacyInfo*>& DiploInfos, const char* szFileRoot, const char* szFileDirectory, const char* szXmlPath, CvCacheObject* (CvDLLUtilityIFaceBase::*pArgFunction) (const TCHAR*))
 {
+	// <advc.003ai> See LoadGlobalClassInfo
+#if SERIALIZE_CVINFOS
+	if (gDLL->isModularXMLLoading())
+#endif
+		pArgFunction = NULL; // </advc.003ai>
 	bool bLoaded = false;
 	bool bWriteCache = true;
 	CvCacheObject* pCache = NULL;
@@ -1622,8 +1636,8 @@ void CvXMLLoadUtility::LoadDiplomacyInfo(std::vector<CvDiplomacyInfo*>& DiploInf
 					}
 				}
 			}
-			// advc.003i: Disabled
-			/*if (NULL != pArgFunction && bWriteCache) {
+			// advc.003i: Disabled; advc.003ai: Enabled again.
+			if (NULL != pArgFunction && bWriteCache) {
 				// write info to cache
 				bool bOk = gDLL->cacheWrite(pCache);
 				if (!bOk) {
@@ -1633,7 +1647,7 @@ void CvXMLLoadUtility::LoadDiplomacyInfo(std::vector<CvDiplomacyInfo*>& DiploInf
 				}
 				if (bOk)
 					logMsg("Wrote %s to cache", szFileDirectory);
-			}*/
+			}
 		}
 	}
 
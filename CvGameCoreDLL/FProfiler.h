@@ -14,6 +14,23 @@
 #include "CvGlobals.h"	// for gDLL
 
 
+#ifdef USE_INTERNAL_PROFILER
+/*  advc.003t: The internal profiler (CvGameCoreDLL.cpp) doesn't need the layout
+	of the EXE's struct. A sample is now only a static descriptor of a profiled
+	site; the timings are kept in the profiler's call tree. In particular, the
+	name is no longer copied into a 256-byte buffer - PROFILE and PROFILE_FUNC
+	are only ever given string literals. */
+struct ProfileSample
+{
+	ProfileSample(char const* name) : Name(name), Id(-1), LastParent(-1), LastNode(-1) {}
+
+	char const*	Name;
+	int			Id;						// Index in the profiler's list of samples
+	// Call tree node of the most recent call and the parent of that node
+	int			LastParent;
+	int			LastNode;
+};
+#else
 //NOTE: This struct must be identical ot the same struct in  FireEngine/FProfiler.h if the
 //standard profiler is being used (USE_INTERNAL_PROFILER not defined)
 //---------------------------------------------------------------------------------------------------------------------
@@ -24,33 +41,21 @@ struct ProfileSample
 		strcpy(Name, name);
 		Added=false;
 		Parent=-1;
-#ifdef USE_INTERNAL_PROFILER
-		Id = -1;
-#endif
 	}
 
 	char	Name[256];						// Name of sample;
 
 	unsigned int	ProfileInstances;		// # of times ProfileBegin Called
 	int				OpenProfiles;			// # of time ProfileBegin called w/o ProfileEnd
-#ifdef USE_INTERNAL_PROFILER
-	LARGE_INTEGER	StartTime;				// The current open profile start time
-	LARGE_INTEGER	Accumulator;			// All samples this frame added together
-
-	LARGE_INTEGER	ChildrenSampleTime;		// Time taken by all children
-#else
 	double			StartTime;				// The current open profile start time
 	double			Accumulator;			// All samples this frame added together
 
 	double			ChildrenSampleTime;		// Time taken by all children
-#endif
 	unsigned int	NumParents;				// Number of profile Parents
 	bool			Added;					// true when added to the list
 	int				Parent;
-#ifdef USE_INTERNAL_PROFILER
-	int				Id;
-#endif
 };
+#endif
 
 //---------------------------------------------------------------------------------------------------------------------
 // Allows us to Profile based on Scope, to limit intrusion into code.
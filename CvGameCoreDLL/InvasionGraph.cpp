@@ -169,20 +169,11 @@ InvasionGraph::Node::Node(PlayerTypes civId, InvasionGraph& outer) :
 void InvasionGraph::Node::initMilitary() {
 
 	PROFILE_FUNC();
-	// Copy present military from cache and split HOME_GUARD off from ARMY
-	std::vector<MilitaryBranch*> const& pm = cache.getPowerValues();
-	MilitaryBranch::HomeGuard* hg = new MilitaryBranch::HomeGuard(*pm[HOME_GUARD]);
-	double guardRatio = hg->initUnitsTrained(cache.numNonNavyUnits(),
-			pm[ARMY]->power() - pm[NUCLEAR]->power());
-	military.push_back(hg);
-	MilitaryBranch::Army* army = new MilitaryBranch::Army(*pm[ARMY]);
-	army->setUnitsTrained(::round(pm[ARMY]->num() * (1 - guardRatio)),
-			(1 - guardRatio) * (pm[ARMY]->power() - pm[NUCLEAR]->power()) +
-			std::min(pm[NUCLEAR]->power(),
-			/*  Limit contribution of nukes to invasions (someone needs to actually
-				conquer and occupy the enemy cities) */
-				0.35 * (pm[ARMY]->power() - pm[NUCLEAR]->power())));
-	military.push_back(army);
+	/*  advc.003ab: Splitting HOME_GUARD off from ARMY is now done by
+		SimulationSnapshot; copy its result. */
+	std::vector<MilitaryBranch*> const& pm = outer.m.getSnapshot().getMilitary(id);
+	military.push_back(new MilitaryBranch::HomeGuard(*pm[HOME_GUARD]));
+	military.push_back(new MilitaryBranch::Army(*pm[ARMY]));
 	military.push_back(new MilitaryBranch::Fleet(*pm[FLEET]));
 	military.push_back(new MilitaryBranch::Logistics(*pm[LOGISTICS]));
 	military.push_back(new MilitaryBranch::Cavalry(*pm[CAVALRY]));
@@ -2249,4 +2240,149 @@ double InvasionGraph::Node::powRatio(double pow1, double pow2) {
 	return std::min(pow1, pow2) / (std::max(pow1, pow2) + 0.001);
 }
 
+// <advc.003ab>
+SimulationSnapshot::SimulationSnapshot() {
+
+	for(int i = 0; i < MAX_CIV_PLAYERS; i++)
+		civData[i] = NULL;
+}
+
+SimulationSnapshot::~SimulationSnapshot() {
+
+	for(int i = 0; i < MAX_CIV_PLAYERS; i++)
+		delete civData[i];
+}
+
+SimulationSnapshot::CivData::CivData() {
+
+	productionEstimate = productionFromUpgrades = -1;
+}
+
+SimulationSnapshot::CivData::~CivData() {
+
+	for(size_t i = 0; i < military.size(); i++)
+		delete military[i];
+}
+
+SimulationSnapshot::CivData& SimulationSnapshot::getCivData(PlayerTypes civId) {
+
+	FAssert(civId >= 0 && civId < MAX_CIV_PLAYERS);
+	if(civData[civId] == NULL)
+		civData[civId] = new CivData();
+	return *civData[civId];
+}
+
+vector<MilitaryBranch*> const& SimulationSnapshot::getMilitary(PlayerTypes civId) {
+
+	CivData& data = getCivData(civId);
+	if(data.military.empty())
+		initMilitary(civId, data);
+	return data.military;
+}
+
+// Moved from InvasionGraph::Node::initMilitary
+void SimulationSnapshot::initMilitary(PlayerTypes civId, CivData& data) {
+
+	PROFILE_FUNC();
+	WarAndPeaceCache const& cache = GET_PLAYER(civId).warAndPeaceAI().getCache();
+	// Copy present military from cache and split HOME_GUARD off from ARMY
+	std::vector<MilitaryBranch*> const& pm = cache.getPowerValues();
+	MilitaryBranch::HomeGuard* hg = new MilitaryBranch::HomeGuard(*pm[HOME_GUARD]);
+	double guardRatio = hg->initUnitsTrained(cache.numNonNavyUnits(),
+			pm[ARMY]->power() - pm[NUCLEAR]->power());
+	data.military.push_back(hg);
+	MilitaryBranch::Army* army = new MilitaryBranch::Army(*pm[ARMY]);
+	army->setUnitsTrained(::round(pm[ARMY]->num() * (1 - guardRatio)),
+			(1 - guardRatio) * (pm[ARMY]->power() - pm[NUCLEAR]->power()) +
+			std::min(pm[NUCLEAR]->power(),
+			/*  Limit contribution of nukes to invasions (someone needs to actually
+				conquer and occupy the enemy cities) */
+				0.35 * (pm[ARMY]->power() - pm[NUCLEAR]->power())));
+	data.military.push_back(army);
+	data.military.push_back(new MilitaryBranch::Fleet(*pm[FLEET]));
+	data.military.push_back(new MilitaryBranch::Logistics(*pm[LOGISTICS]));
+	data.military.push_back(new MilitaryBranch::Cavalry(*pm[CAVALRY]));
+	data.military.push_back(new MilitaryBranch::NuclearArsenal(*pm[NUCLEAR]));
+}
+
+// Moved from the ArmamentForecast constructor
+double SimulationSnapshot::getProductionEstimate(PlayerTypes civId) {
+
+	CivData& data = getCivData(civId);
+	if(data.productionEstimate >= 0)
+		return data.productionEstimate;
+	CvPlayerAI& civ = GET_PLAYER(civId);
+	/* The current production rate. It's probably going to increase a bit
+	   over the planning interval, but not much since the forecast doesn't
+	   reach far into the future; ignore that increase. */
+	double r = civ.estimateYieldRate(YIELD_PRODUCTION);
+	/* A very rough estimate of hurry hammers. Would be nicer to base this on
+	   the actual hurry effect, e.g., for Slavery, per-use production divided
+	   by anger duration. */
+	if(civ.warAndPeaceAI().canHurry())
+		r += 3 * civ.getNumCities();
+	data.productionEstimate = r;
+	return r;
+}
+
+// Moved from ArmamentForecast
+double SimulationSnapshot::getProductionFromUpgrades(PlayerTypes civId,
+		WarAndPeaceReport& report) {
+
+	CivData& data = getCivData(civId);
+	if(data.productionFromUpgrades >= 0)
+		return data.productionFromUpgrades;
+	/* Going through all the units and checking for possible upgrades would be
+	   somewhat expensive and complicated: Which upgrades would be prioritized
+	   if upgrading them all is too costly?
+	   Failed attempt: Predict the power of a fully upgraded army based on
+	   unit counts and typical units -- the resulting power value turned out to
+	   be a poor estimate of an army's upgrade potential.
+	   Actual approach: Rely on CvPlayerAI::AI_updateGoldToUpgradeAllUnits,
+	   convert the result into hammers, and (later) the hammers into power. */
+	CvPlayerAI& civ = GET_PLAYER(civId);
+	double r = civ.AI_getGoldToUpgradeAllUnits();
+	if(r > 0.01)
+		report.log("Total gold needed for upgrades: %d", ::round(r));
+	/* 'civ' may not have the funds to make all the upgrades in the
+	   medium term. Think of a human player keeping stacks of Warriors around,
+	   or a vassal receiving tech quickly from its master.
+	   Spend at most incomeTurns turns worth of income on upgrades. The subtrahend
+	   will be 0 during anarchy -- not a big problem I think. */
+	double const incomeTurns = 4;
+	double income = civ.estimateYieldRate(YIELD_COMMERCE, 3) -
+			civ.calculateInflatedCosts();
+	double incomeBound = incomeTurns * income;
+	// Also take into account current gold stockpile
+	int iGold = civ.getGold();
+	incomeBound = std::max((2 * incomeBound + iGold) / 3, (2 * iGold + incomeBound) / 3);
+	if(incomeBound < r)
+		report.log("Upgrades bounded by income (%d gpt)", ::round(income));
+	r = std::min(incomeBound, r);
+	// An approximate inversion of CvUnit::upgradePrice
+	double upgrCostPerProd = GC.getDefineINT("UNIT_UPGRADE_COST_PER_PRODUCTION");
+	r /= upgrCostPerProd;
+	/* The base upgrade cost is paid per unit, but CvPlayerAI doesn't track
+	   how many units need an upgrade. Assuming a mean training cost difference
+	   of 30 hammers, one can look at the base cost as a multiplicative modifier. */
+	double typicalGoldForProdDiff = upgrCostPerProd * 30;
+	double baseCostModifier = typicalGoldForProdDiff / (typicalGoldForProdDiff +
+			GC.getDefineINT("BASE_UNIT_UPGRADE_COST"));
+	r *= baseCostModifier;
+	if(!civ.isHuman()) {
+		CvHandicapInfo& gameHandicap = GC.getHandicapInfo(GC.getGameINLINE().
+				getHandicapType());
+		double aiUpgradeFactor = gameHandicap.getAIUnitUpgradePercent();
+		// advc.250d: The per-era modifier no longer applies to upgrade cost
+			// + gameHandicap.getAIPerEraModifier() * civ.getCurrentEra();
+		aiUpgradeFactor /= 100.0;
+		/* Shouldn't draw conclusions from AI_getGoldToUpgradeAllUnits when
+		   AI upgrades are (modded to be) free or almost free. */
+		if(aiUpgradeFactor > 0.1)
+			r /= aiUpgradeFactor;
+	}
+	data.productionFromUpgrades = std::max(0.0, r);
+	return data.productionFromUpgrades;
+} // </advc.003ab>
+
 // </advc.104>
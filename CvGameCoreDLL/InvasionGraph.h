@@ -284,6 +284,39 @@ private:
 	bool success;
 	double tempLosses;
 };
+
+/*  advc.003ab: The parts of a simulation that don't depend on the scenario,
+	i.e. the present military of each civ (with the home guard split off from
+	the army) and its production capacity. Computed lazily per civ. One
+	instance is shared by all InvasionGraphs that a WarEvaluator creates
+	(naval and non-naval, limited and total, war and peace scenario, each
+	team member), so the game state mustn't change during its lifetime. */
+class SimulationSnapshot {
+
+public:
+	SimulationSnapshot();
+	~SimulationSnapshot();
+	/*  Branches indexed by MilitaryBranchTypes. The caller should copy them
+		before making changes. */
+	std::vector<MilitaryBranch*> const& getMilitary(PlayerTypes civId);
+	// Current production rate, including a rough estimate of hurry hammers
+	double getProductionEstimate(PlayerTypes civId);
+	// Upgrades converted to production (see ArmamentForecast)
+	double getProductionFromUpgrades(PlayerTypes civId,
+			WarAndPeaceReport& report);
+
+private:
+	struct CivData {
+		CivData();
+		~CivData();
+		std::vector<MilitaryBranch*> military;
+		double productionEstimate;
+		double productionFromUpgrades;
+	};
+	CivData* civData[MAX_CIV_PLAYERS];
+	CivData& getCivData(PlayerTypes civId);
+	void initMilitary(PlayerTypes civId, CivData& data);
+};
 // </advc.104>
 
 #endif
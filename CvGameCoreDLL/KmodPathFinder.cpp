@@ -9,6 +9,11 @@
 
 int KmodPathFinder::admissible_scaled_weight = 1;
 int KmodPathFinder::admissible_base_weight = 1;
+// <advc.003x>
+bool KmodPathFinder::landmarks_valid = false;
+std::vector<int> KmodPathFinder::landmass_id;
+std::vector<unsigned short> KmodPathFinder::landmark_dist[NUM_LANDMARKS];
+// </advc.003x>
 
 CvPathSettings::CvPathSettings(const CvSelectionGroup* pGroup, int iFlags, int iMaxPath, int iHW)
 	: pGroup(const_cast<CvSelectionGroup*>(pGroup)), iFlags(iFlags), iMaxPath(iMaxPath), iHeuristicWeight(iHW)
@@ -41,17 +46,116 @@ int KmodPathFinder::MinimumStepCost(int BaseMoves)
 	return std::max(1, std::min(admissible_base_weight, BaseMoves * admissible_scaled_weight));
 }
 
-bool KmodPathFinder::OpenList_sortPred::operator()(const FAStarNode* &left, const FAStarNode* &right)
+/*  <advc.003x> Landmark ("ALT") heuristic. By the triangle inequality,
+	|d(L,a) - d(L,b)| <= d(a,b) for any plot L. Unlike stepDistance, this accounts
+	for detours around lakes, bays and inland seas. Distances are counted over land
+	plots (including impassable ones) and single water plots between them: a land
+	unit may step onto a water plot to board a transport (CvUnit::canMoveInto)
+	and then unload onto land, but it can't move on from one water plot to
+	another. So this is a lower bound for every land unit that can't enter water
+	cities. */
+int KmodPathFinder::LandmarkStepBound(int iFromPlot, int iToPlot)
 {
-	return left->m_iTotalCost < right->m_iTotalCost;
+	if (!landmarks_valid || (int)landmass_id.size() != GC.getMapINLINE().numPlotsINLINE())
+		UpdateLandmarks();
+	int iLandmass = landmass_id[iFromPlot];
+	if (iLandmass < 0 || iLandmass != landmass_id[iToPlot])
+		return 0;
+	int iBound = 0;
+	for (int i = 0; i < NUM_LANDMARKS; i++)
+	{
+		iBound = std::max(iBound, std::abs(
+				(int)landmark_dist[i][iFromPlot] - (int)landmark_dist[i][iToPlot]));
+	}
+	return iBound;
 }
 
+void KmodPathFinder::UpdateLandmarks()
+{
+	PROFILE_FUNC();
+
+	CvMap const& kMap = GC.getMapINLINE();
+	int const iPlots = kMap.numPlotsINLINE();
+	landmass_id.assign(iPlots, -1);
+	// Distances from an arbitrary plot of each landmass; then from the landmarks chosen so far.
+	std::vector<unsigned short> aiMinDist(iPlots, MAX_UNSIGNED_SHORT);
+	std::vector<int> aiQueue;
+	int iLandmasses = 0;
+	for (int i = 0; i < iPlots; i++)
+	{
+		if (kMap.plotByIndexINLINE(i)->isWater() || landmass_id[i] >= 0)
+			continue;
+		landmass_id[i] = iLandmasses;
+		iLandmasses++;
+		aiMinDist[i] = 0;
+		aiQueue.clear();
+		aiQueue.push_back(i);
+		LandmarkBFS(aiQueue, aiMinDist);
+	}
+	for (int iLandmark = 0; iLandmark < NUM_LANDMARKS; iLandmark++)
+	{
+		/*  Farthest-point selection: next landmark of each landmass is the plot
+			farthest from the previous landmarks. */
+		std::vector<int> aiBestPlot(iLandmasses, -1);
+		for (int i = 0; i < iPlots; i++)
+		{
+			int iLandmass = landmass_id[i];
+			if (iLandmass >= 0 && (aiBestPlot[iLandmass] < 0 ||
+					aiMinDist[i] > aiMinDist[aiBestPlot[iLandmass]]))
+				aiBestPlot[iLandmass] = i;
+		}
+		std::vector<unsigned short>& aiDist = landmark_dist[iLandmark];
+		aiDist.assign(iPlots, MAX_UNSIGNED_SHORT);
+		aiQueue.clear();
+		for (int i = 0; i < iLandmasses; i++)
+		{
+			aiDist[aiBestPlot[i]] = 0;
+			aiQueue.push_back(aiBestPlot[i]);
+		}
+		LandmarkBFS(aiQueue, aiDist);
+		for (int i = 0; i < iPlots; i++)
+		{
+			if (iLandmark == 0)
+				aiMinDist[i] = aiDist[i];
+			else aiMinDist[i] = std::min(aiMinDist[i], aiDist[i]);
+		}
+	}
+	landmarks_valid = true;
+}
+
+/*  Breadth-first search from the plots in aiQueue (distance 0) over land plots
+	and single water plots; no steps from water to water. */
+void KmodPathFinder::LandmarkBFS(std::vector<int>& aiQueue, std::vector<unsigned short>& aiDist)
+{
+	CvMap const& kMap = GC.getMapINLINE();
+	for (size_t iHead = 0; iHead < aiQueue.size(); iHead++)
+	{
+		int iPlot = aiQueue[iHead];
+		CvPlot const& kPlot = *kMap.plotByIndexINLINE(iPlot);
+		for (int i = 0; i < NUM_DIRECTION_TYPES; i++)
+		{
+			CvPlot const* pAdj = kMap.plotDirection(kPlot.getX_INLINE(), kPlot.getY_INLINE(), (DirectionTypes)i);
+			if (pAdj == NULL || (pAdj->isWater() && kPlot.isWater()))
+				continue;
+			int iAdj = kMap.plotNumINLINE(pAdj->getX_INLINE(), pAdj->getY_INLINE());
+			if (aiDist[iAdj] != MAX_UNSIGNED_SHORT)
+				continue;
+			aiDist[iAdj] = (unsigned short)(aiDist[iPlot] + 1);
+			if (landmass_id[iAdj] < 0)
+				landmass_id[iAdj] = landmass_id[iPlot];
+			aiQueue.push_back(iAdj);
+		}
+	}
+} // </advc.003x>
+
 //
 KmodPathFinder::KmodPathFinder() :
 	end_node(0),
 	map_width(0),
 	map_height(0),
-	node_data(0)
+	node_data(0),
+	node_state(0), generation(1), // advc.003w
+	use_landmarks(false) // advc.003x
 {
 	// Unfortunately, the pathfinder is constructed before the map width and height are determined.
 
@@ -64,6 +168,7 @@ KmodPathFinder::KmodPathFinder() :
 KmodPathFinder::~KmodPathFinder()
 {
 	free(node_data);
+	free(node_state); // advc.003w
 }
 
 bool KmodPathFinder::ValidateNodeMap()
@@ -85,6 +190,18 @@ bool KmodPathFinder::ValidateNodeMap()
 			FAssertMsg(new_node_data != NULL, "Failed to re-allocate memory");
 		}
 		else node_data = new_node_data; // </advc.003>
+		// <advc.003w>
+		NodeState* new_node_state = static_cast<NodeState*>(
+				realloc(node_state, sizeof(*node_state)*map_width*map_height));
+		if(new_node_state == NULL) {
+			free(node_state);
+			FAssertMsg(new_node_state != NULL, "Failed to re-allocate memory");
+		}
+		else node_state = new_node_state;
+		// Generation 0 is never used; so this marks all nodes as stale.
+		memset(node_state, 0, sizeof(*node_state)*map_width*map_height);
+		open_list.clear();
+		deferred_list.clear(); // </advc.003w>
 		end_node = NULL;
 	}
 	return true;
@@ -107,42 +224,16 @@ bool KmodPathFinder::GeneratePath(int x1, int y1, int x2, int y2)
 	if (!pathDestValid(x2, y2, &settings, 0))
 		return false;
 
-	if (x1 != start_x || y1 != start_y)
-	{
-		// Note: it may be possible to salvage some of the old data to get more speed.
-		// eg. If the moves recorded on the node match the group,
-		// just delete everything that isn't a direct descendant of the new start.
-		// and then subtract the start cost & moves off all the remaining nodes.
-		Reset(); // but this is easier.
-	}
 	bool bRecalcHeuristics = false;
 
 	if (dest_x != x2 || dest_y != y2)
 		bRecalcHeuristics = true;
 
-	start_x = x1;
-	start_y = y1;
 	dest_x = x2;
 	dest_y = y2;
 
-	if (GetNode(x1, y1).m_bOnStack)
-	{
-		int iMoves = (settings.iFlags & MOVE_MAX_MOVES) ? settings.pGroup->maxMoves() : settings.pGroup->movesLeft();
-		if (iMoves != GetNode(x1,  y1).m_iData1)
-		{
-			Reset();
-			FAssert(!GetNode(x1,  y1).m_bOnStack);
-		}
-		// Note: This condition isn't actually enough to catch all significant changes.
-		// We really need to check max moves /and/ moves left /and/ base moves.
-		// but I don't feel like doing all that at the moment.
-	}
-
-	if (!GetNode(x1,  y1).m_bOnStack)
-	{
-		AddStartNode();
+	if (InitStartNode(x1, y1)) // advc.003w: Moved into a separate function
 		bRecalcHeuristics = true;
-	}
 	//else (not else. maybe start == dest)
 	{
 		// check if the end plot is already mapped.
@@ -172,6 +263,74 @@ bool KmodPathFinder::GeneratePath(const CvPlot* pToPlot)
 		pToPlot->getX_INLINE(), pToPlot->getY_INLINE());
 }
 
+// <advc.003w>
+void KmodPathFinder::ExpandFrom(int x1, int y1)
+{
+	PROFILE_FUNC();
+
+	FASSERT_BOUNDS(0, map_width , x1, "ExpandFrom");
+	FASSERT_BOUNDS(0, map_height, y1, "ExpandFrom");
+
+	end_node = NULL;
+
+	if (!settings.pGroup)
+		return;
+
+	// No destination. The next GeneratePath call will have to recalculate the heuristics.
+	dest_x = -1;
+	dest_y = -1;
+	InitStartNode(x1, y1);
+	int iHeuristicWeight = settings.iHeuristicWeight;
+	settings.iHeuristicWeight = 0;
+	RecalculateHeuristics();
+	while (ProcessNode())
+	{
+		// nothing
+	}
+	settings.iHeuristicWeight = iHeuristicWeight;
+}
+
+void KmodPathFinder::ExpandFrom(const CvPlot* pFromPlot)
+{
+	if (pFromPlot != NULL)
+		ExpandFrom(pFromPlot->getX_INLINE(), pFromPlot->getY_INLINE());
+}
+
+// Returns true if the start node had to be (re-)added
+bool KmodPathFinder::InitStartNode(int x1, int y1)
+{
+	if (x1 != start_x || y1 != start_y)
+	{
+		// Note: it may be possible to salvage some of the old data to get more speed.
+		// eg. If the moves recorded on the node match the group,
+		// just delete everything that isn't a direct descendant of the new start.
+		// and then subtract the start cost & moves off all the remaining nodes.
+		Reset(); // but this is easier.
+	}
+	start_x = x1;
+	start_y = y1;
+
+	if (GetNode(x1, y1).m_bOnStack)
+	{
+		int iMoves = (settings.iFlags & MOVE_MAX_MOVES) ? settings.pGroup->maxMoves() : settings.pGroup->movesLeft();
+		if (iMoves != GetNode(x1,  y1).m_iData1)
+		{
+			Reset();
+			FAssert(!GetNode(x1,  y1).m_bOnStack);
+		}
+		// Note: This condition isn't actually enough to catch all significant changes.
+		// We really need to check max moves /and/ moves left /and/ base moves.
+		// but I don't feel like doing all that at the moment.
+	}
+
+	if (!GetNode(x1,  y1).m_bOnStack)
+	{
+		AddStartNode();
+		return true;
+	}
+	return false;
+} // </advc.003w>
+
 int KmodPathFinder::GetPathTurns() const
 {
 	FAssert(end_node);
@@ -247,8 +406,20 @@ void KmodPathFinder::SetSettings(const CvPathSettings& new_settings)
 			Reset();
 		}
 	}
+	int iOldMaxPath = settings.iMaxPath; // advc.003w
 	settings = new_settings;
-
+	/*  <advc.003w> Nodes that were set aside b/c of the old limit may be
+		within the new limit */
+	if (settings.iMaxPath != iOldMaxPath && !deferred_list.empty())
+		OpenList_rebuild(); // </advc.003w>
+
+	/*  <advc.003x> Water cities would let land units move from water to water,
+		which the landmark distances don't account for. */
+	use_landmarks = (settings.pGroup != NULL &&
+			settings.pGroup->getDomainType() == DOMAIN_LAND &&
+			!settings.pGroup->canMoveAllTerrain() &&
+			GC.getDefineINT(CvGlobals::LAND_UNITS_CAN_ATTACK_WATER_CITIES) == 0);
+	// </advc.003x>
 	if (settings.iHeuristicWeight < 0)
 	{
 		if (!settings.pGroup)
@@ -272,12 +443,124 @@ void KmodPathFinder::SetSettings(const CvPathSettings& new_settings)
 
 void KmodPathFinder::Reset()
 {
-	memset(&node_data[0], 0, sizeof(*node_data)*map_width*map_height);
+	//memset(&node_data[0], 0, sizeof(*node_data)*map_width*map_height);
+	// <advc.003w> Nodes of the previous generation are cleared lazily (GetNode)
+	generation++;
+	if (generation <= 0) // overflow
+	{
+		memset(node_state, 0, sizeof(*node_state)*map_width*map_height);
+		generation = 1;
+	}
+	deferred_list.clear(); // </advc.003w>
 	open_list.clear();
 	end_node = NULL;
 	// settings is set separately.
 }
 
+// <advc.003w>
+void KmodPathFinder::InitNode(int i)
+{
+	memset(&node_data[i], 0, sizeof(*node_data));
+	node_state[i].iGeneration = generation;
+	node_state[i].iListPos = -1;
+}
+
+void KmodPathFinder::OpenList_push(FAStarNode* node)
+{
+	FAssert(node_state[GetNodeIndex(node)].iListPos == -1);
+	open_list.push_back(NULL);
+	OpenList_setPos((int)open_list.size() - 1, node);
+	OpenList_siftUp((int)open_list.size() - 1);
+}
+
+FAStarNode* KmodPathFinder::OpenList_pop()
+{
+	FAssert(!open_list.empty());
+	FAStarNode* top = open_list[0];
+	FAStarNode* last = open_list.back();
+	open_list.pop_back();
+	if (!open_list.empty())
+	{
+		OpenList_setPos(0, last);
+		OpenList_siftDown(0);
+	}
+	node_state[GetNodeIndex(top)].iListPos = -1;
+	return top;
+}
+
+void KmodPathFinder::OpenList_defer(FAStarNode* node)
+{
+	FAssert(node_state[GetNodeIndex(node)].iListPos == -1);
+	deferred_list.push_back(node);
+	node_state[GetNodeIndex(node)].iListPos = -((int)deferred_list.size() - 1) - 2;
+}
+
+void KmodPathFinder::OpenList_update(FAStarNode* node)
+{
+	int pos = node_state[GetNodeIndex(node)].iListPos;
+	if (pos >= 0)
+	{
+		OpenList_siftUp(pos);
+		OpenList_siftDown(node_state[GetNodeIndex(node)].iListPos);
+	}
+	else if (pos <= -2 && IsWithinMaxPath(node))
+	{
+		// back into the heap
+		int deferred_pos = -pos - 2;
+		FAStarNode* last = deferred_list.back();
+		deferred_list[deferred_pos] = last;
+		node_state[GetNodeIndex(last)].iListPos = pos;
+		deferred_list.pop_back();
+		node_state[GetNodeIndex(node)].iListPos = -1;
+		OpenList_push(node);
+	}
+}
+
+void KmodPathFinder::OpenList_rebuild()
+{
+	for (size_t i = 0; i < deferred_list.size(); i++)
+	{
+		open_list.push_back(NULL);
+		OpenList_setPos((int)open_list.size() - 1, deferred_list[i]);
+	}
+	deferred_list.clear();
+	for (int pos = (int)open_list.size() / 2 - 1; pos >= 0; pos--)
+		OpenList_siftDown(pos);
+}
+
+void KmodPathFinder::OpenList_siftUp(int pos)
+{
+	FAStarNode* node = open_list[pos];
+	while (pos > 0)
+	{
+		int parent_pos = (pos - 1) / 2;
+		if (open_list[parent_pos]->m_iTotalCost <= node->m_iTotalCost)
+			break;
+		OpenList_setPos(pos, open_list[parent_pos]);
+		pos = parent_pos;
+	}
+	OpenList_setPos(pos, node);
+}
+
+void KmodPathFinder::OpenList_siftDown(int pos)
+{
+	int size = (int)open_list.size();
+	FAStarNode* node = open_list[pos];
+	while (true)
+	{
+		int child_pos = 2 * pos + 1;
+		if (child_pos >= size)
+			break;
+		if (child_pos + 1 < size && open_list[child_pos + 1]->m_iTotalCost < open_list[child_pos]->m_iTotalCost)
+			child_pos++;
+		if (node->m_iTotalCost <= open_list[child_pos]->m_iTotalCost)
+			break;
+		OpenList_setPos(pos, open_list[child_pos]);
+		pos = child_pos;
+	}
+	OpenList_setPos(pos, node);
+} // </advc.003w>
+
 void KmodPathFinder::AddStartNode()
 {
 	FASSERT_BOUNDS(0, map_width , start_x, "KmodPathFinder::AddStartNode");
@@ -290,7 +573,8 @@ void KmodPathFinder::AddStartNode()
 	pathAdd(0, start_node, ASNC_INITIALADD, &settings, 0);
 	start_node->m_iKnownCost = 0;
 
-	open_list.push_back(start_node);
+	//open_list.push_back(start_node);
+	OpenList_push(start_node); // advc.003w
 
 	// Note: I'd like to use NO_FASTARLIST as a signal that the node is uninitialised, but unfortunately
 	// the default value for m_eFAStarListType is FASTARLIST_OPEN, because FASTARLIST_OPEN == 0.
@@ -300,42 +584,57 @@ void KmodPathFinder::AddStartNode()
 	start_node->m_bOnStack = true; // This means the node is connected and ready to be used.
 }
 
+// advc.003w
+int KmodPathFinder::Heuristic(int x, int y) const
+{
+	if (settings.iHeuristicWeight <= 0)
+		return 0;
+	// <advc.003x>
+	if (use_landmarks)
+	{
+		int iBound = LandmarkStepBound(y*map_width+x, dest_y*map_width+dest_x);
+		return settings.iHeuristicWeight * std::max(pathHeuristic(x, y, dest_x, dest_y),
+				pathStepHeuristic(iBound));
+	} // </advc.003x>
+	return settings.iHeuristicWeight * pathHeuristic(x, y, dest_x, dest_y);
+}
+
 void KmodPathFinder::RecalculateHeuristics()
 {
+	OpenList_rebuild(); // advc.003w: Deferred nodes too
 	// recalculate heuristic cost for all open nodes.
 	for (OpenList_t::iterator i = open_list.begin(); i != open_list.end(); ++i)
 	{
-		int h = settings.iHeuristicWeight * pathHeuristic((*i)->m_iX, (*i)->m_iY, dest_x, dest_y);
+		int h = Heuristic((*i)->m_iX, (*i)->m_iY); // advc.003w
 		(*i)->m_iHeuristicCost = h;
 		(*i)->m_iTotalCost = h + (*i)->m_iKnownCost;
 	}
+	OpenList_rebuild(); // advc.003w: Restore the heap property
 }
 
 bool KmodPathFinder::ProcessNode()
 {
-	OpenList_t::iterator best_it = open_list.end();
+	/*  <advc.003w> Take the cheapest node off the heap, setting aside those that
+		exceed iMaxPath. (Was a linear search through an unsorted vector.) */
+	FAStarNode* parent_node = NULL;
 	{
 		int iLowestCost = end_node ? end_node->m_iKnownCost : MAX_INT;
-		for (OpenList_t::iterator it = open_list.begin(); it != open_list.end(); ++it)
+		while (!open_list.empty() && open_list[0]->m_iTotalCost < iLowestCost)
 		{
-			if ((*it)->m_iTotalCost < iLowestCost &&
-				(settings.iMaxPath < 0 || (*it)->m_iData2 <= settings.iMaxPath))
+			FAStarNode* node = OpenList_pop();
+			if (IsWithinMaxPath(node))
 			{
-				best_it = it;
-				iLowestCost = (*it)->m_iTotalCost;
+				parent_node = node;
+				break;
 			}
+			OpenList_defer(node);
 		}
 	}
 
 	// if we didn't find a suitable node to process, then quit.
-	if (best_it == open_list.end())
+	if (parent_node == NULL)
 		return false;
-
-	FAStarNode* parent_node = (*best_it);
-
-	// erase the node from the open_list.
-	// Note: this needs to be done before pushing new entries, otherwise the iterator will be invalid.
-	open_list.erase(best_it);
+	// </advc.003w>
 	parent_node->m_eFAStarListType = FASTARLIST_CLOSED;
 
 	FAssert(&GetNode(parent_node->m_iX, parent_node->m_iY) == parent_node);
@@ -358,6 +657,7 @@ bool KmodPathFinder::ProcessNode()
 
 		FAStarNode* child_node = &GetNode(x, y);
 		bool bNewNode = !child_node->m_bOnStack;
+		bool bOpenNewNode = false; // advc.003w
 
 		if (bNewNode)
 		{
@@ -369,14 +669,15 @@ bool KmodPathFinder::ProcessNode()
 			{
 				// This path to the new node is valid. So we need to fill in the data.
 				child_node->m_iKnownCost = MAX_INT;
-				child_node->m_iHeuristicCost = settings.iHeuristicWeight * pathHeuristic(x, y, dest_x, dest_y);
+				child_node->m_iHeuristicCost = Heuristic(x, y); // advc.003w
 				// total cost will be set when the parent is set.
 
 				child_node->m_bOnStack = true;
 
 				if (pathValid_source(child_node, settings.pGroup , settings.iFlags))
 				{
-					open_list.push_back(child_node);
+					//open_list.push_back(child_node);
+					bOpenNewNode = true; // advc.003w: Push once the cost is known
 					child_node->m_eFAStarListType = FASTARLIST_OPEN;
 				}
 				else
@@ -452,9 +753,15 @@ bool KmodPathFinder::ProcessNode()
 				ForwardPropagate(child_node, cost_delta);
 
 				FAssert(child_node->m_iKnownCost > parent_node->m_iKnownCost);
+				// <advc.003w>
+				if (!bOpenNewNode && child_node->m_eFAStarListType == FASTARLIST_OPEN)
+					OpenList_update(child_node); // </advc.003w>
 			}
 		}
 		// else parent has higher cost. So there must already be a faster route to the child.
+		// <advc.003w>
+		if (bOpenNewNode)
+			OpenList_push(child_node); // </advc.003w>
 	}
 	return true;
 }
@@ -497,6 +804,10 @@ void KmodPathFinder::ForwardPropagate(FAStarNode* head, int cost_delta)
 
 		FAssert(head->m_apChildren[i]->m_iKnownCost > head->m_iKnownCost);
 
+		// <advc.003w>
+		if (head->m_apChildren[i]->m_eFAStarListType == FASTARLIST_OPEN &&
+				(iNewDelta != 0 || iOldTurns != head->m_apChildren[i]->m_iData2))
+			OpenList_update(head->m_apChildren[i]); // </advc.003w>
 		if (iNewDelta != 0 || iOldMoves != head->m_apChildren[i]->m_iData1 || iOldTurns != head->m_apChildren[i]->m_iData2)
 			ForwardPropagate(head->m_apChildren[i], iNewDelta);
 	}
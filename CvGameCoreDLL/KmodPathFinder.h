@@ -22,6 +22,13 @@ class KmodPathFinder
 public:
 	static void InitHeuristicWeights();
 	static int MinimumStepCost(int BaseMoves);
+	/*  <advc.003x> Lower bound on the number of steps that a land unit needs for
+		getting from one plot to another; based on distances to a few landmark
+		plots per landmass (water plots count only as single steps between land
+		plots). 0 if no bound is available.
+		The landmarks need to be invalidated whenever land/ water changes. */
+	static int LandmarkStepBound(int iFromPlot, int iToPlot);
+	static void InvalidateLandmarks() { landmarks_valid = false; } // </advc.003x>
 
 	KmodPathFinder();
 	~KmodPathFinder();
@@ -30,6 +37,11 @@ public:
 
 	bool GeneratePath(int x1, int y1, int x2, int y2);
 	bool GeneratePath(const CvPlot* pToPlot); // just a wrapper for convenience
+	/*  advc.003w: Map every plot that the group can reach within iMaxPath turns
+		(Dijkstra - no destination, no heuristic). Subsequent GeneratePath calls
+		from the same start plot can then mostly be answered from the node map. */
+	void ExpandFrom(int x1, int y1);
+	void ExpandFrom(const CvPlot* pFromPlot);
 	FAStarNode* GetEndNode() const { FAssert(end_node); return end_node; } // Note: the returned pointer becomes invalid if the pathfinder is destroyed.
 	bool IsPathComplete() const { return end_node; }
 	int GetPathTurns() const;
@@ -41,18 +53,56 @@ public:
 	void Reset();
 
 protected:
+	bool InitStartNode(int x1, int y1); // advc.003w
 	void AddStartNode();
 	void RecalculateHeuristics();
+	// advc.003w: Zero while expanding without a destination
+	int Heuristic(int x, int y) const;
 	bool ProcessNode();
 	void ForwardPropagate(FAStarNode* head, int cost_delta);
 	typedef std::vector<FAStarNode*> OpenList_t;
 
-	struct OpenList_sortPred
+	/*  <advc.003w> The open list is a binary min-heap on m_iTotalCost. Open nodes
+		that exceed the iMaxPath limit are moved aside to deferred_list when they
+		reach the top of the heap. */
+	void OpenList_push(FAStarNode* node);
+	FAStarNode* OpenList_pop();
+	void OpenList_defer(FAStarNode* node);
+	void OpenList_update(FAStarNode* node); // call after changing the cost or turns of an open node
+	void OpenList_rebuild(); // moves the deferred nodes back into the heap; restores the heap property.
+	void OpenList_siftUp(int pos);
+	void OpenList_siftDown(int pos);
+	void OpenList_setPos(int pos, FAStarNode* node)
 	{
-		bool operator()(const FAStarNode* &left, const FAStarNode* &right);
-	};
+		open_list[pos] = node;
+		node_state[GetNodeIndex(node)].iListPos = pos;
+	}
+	bool IsWithinMaxPath(const FAStarNode* node) const
+	{
+		return (settings.iMaxPath < 0 || node->m_iData2 <= settings.iMaxPath);
+	}
 
-	FAStarNode& GetNode(int x, int y) { return node_data[y*map_width+x]; }
+	/*  Nodes whose generation doesn't match the current one are stale and get
+		cleared when first accessed; that way, Reset doesn't have to touch all nodes. */
+	struct NodeState
+	{
+		int iGeneration;
+		/*  >= 0: position in open_list (heap), <= -2: position -iListPos-2 in
+			deferred_list, -1: neither. */
+		int iListPos;
+	};
+	FAStarNode& GetNode(int x, int y)
+	{
+		int i = y*map_width+x;
+		if (node_state[i].iGeneration != generation)
+			InitNode(i);
+		return node_data[i];
+	}
+	int GetNodeIndex(const FAStarNode* node) const { return (int)(node - node_data); }
+	void InitNode(int i);
+	NodeState* node_state;
+	int generation;
+	OpenList_t deferred_list; // </advc.003w>
 	FAStarNode* node_data;
 	OpenList_t open_list;
 
@@ -64,4 +114,13 @@ protected:
 
 	static int admissible_scaled_weight;
 	static int admissible_base_weight;
+	// <advc.003x>
+	bool use_landmarks; // for the current settings
+	enum { NUM_LANDMARKS = 4 };
+	static void UpdateLandmarks();
+	static void LandmarkBFS(std::vector<int>& aiQueue, std::vector<unsigned short>& aiDist);
+	static bool landmarks_valid;
+	static std::vector<int> landmass_id; // per plot; -1 for water not adjacent to land
+	static std::vector<unsigned short> landmark_dist[NUM_LANDMARKS]; // per plot
+	// </advc.003x>
 };
@@ -15,9 +15,10 @@ using std::ostringstream;
 
 
 MilitaryAnalyst::MilitaryAnalyst(PlayerTypes weId, WarEvalParameters& warEvalParams,
-		bool peaceScenario)
+		bool peaceScenario, SimulationSnapshot& snapshot)
 	: weId(weId), warEvalParams(warEvalParams), theyId(warEvalParams.targetId()),
-	  peaceScenario(peaceScenario), report(warEvalParams.getReport()), turnsSim(0) {
+	  peaceScenario(peaceScenario), report(warEvalParams.getReport()), turnsSim(0),
+	  snapshot(snapshot) { // advc.003ab
 
 	PROFILE_FUNC();
 	for(int i = 0; i < MAX_CIV_PLAYERS; i++) {
@@ -235,6 +236,12 @@ WarEvalParameters& MilitaryAnalyst::evaluationParameters() {
 	return warEvalParams;
 }
 
+// <advc.003ab>
+SimulationSnapshot& MilitaryAnalyst::getSnapshot() {
+
+	return snapshot;
+} // </advc.003ab>
+
 PlayerTypes MilitaryAnalyst::ourId() const {
 
 	return weId;
@@ -9,6 +9,7 @@ class InvasionGraph;
 class WarEvalParameters;
 class WarAndPeaceReport;
 class InvasionGraph;
+class SimulationSnapshot; // advc.003ab
 
 
 /*  <advc.104>: New class. Handles the military assessment of a war between
@@ -28,9 +29,11 @@ class MilitaryAnalyst {
 public:
 
 	MilitaryAnalyst(PlayerTypes weId, WarEvalParameters& warEvalParams,
-			bool peaceScenario);
+			bool peaceScenario,
+			SimulationSnapshot& snapshot); // advc.003ab
 	~MilitaryAnalyst();
 	WarEvalParameters& evaluationParameters();
+	SimulationSnapshot& getSnapshot(); // advc.003ab
 	PlayerTypes ourId() const;
 	bool isOnOurSide(TeamTypes tId) const;
 	/*  The parameter only refers to proper defensive pacts; vassal-master is always
@@ -92,6 +95,7 @@ private:
 	TeamTypes theyId;
 	WarAndPeaceReport& report;
 	bool peaceScenario;
+	SimulationSnapshot& snapshot; // advc.003ab
 
 	InvasionGraph* ig;
 	int turnsSim;
@@ -0,0 +1,127 @@
+// <advc.003s> New class; see TurnTimer.h for description
+
+#include "CvGameCoreDLL.h"
+#include "TurnTimer.h"
+#include "CvGamePlay.h"
+#include "CvMap.h"
+#include "CvInfos.h"
+
+bool TurnTimer::bActive = false;
+int TurnTimer::iTurn = -1;
+int TurnTimer::aiDepth[NUM_PHASES];
+int TurnTimer::aiCalls[NUM_PHASES];
+LARGE_INTEGER TurnTimer::aStart[NUM_PHASES];
+LARGE_INTEGER TurnTimer::aTotal[NUM_PHASES];
+
+void TurnTimer::atTurnStart() {
+
+	CvGame const& g = GC.getGameINLINE();
+	if(bActive && iTurn >= 0) {
+		end(GAME_TURN);
+		writeTurn();
+	}
+	bool bWasActive = bActive;
+	bActive = (g.getAIAutoPlay() > 0 &&
+			GC.getDefineINT("AUTOPLAY_TURN_TIME_LOG") > 0);
+	reset();
+	if(!bActive)
+		return;
+	if(!bWasActive)
+		writeHeader();
+	iTurn = g.getGameTurn();
+	begin(GAME_TURN);
+}
+
+void TurnTimer::begin(Phase ePhase) {
+
+	aiCalls[ePhase]++;
+	if(aiDepth[ePhase]++ == 0)
+		QueryPerformanceCounter(&aStart[ePhase]);
+}
+
+void TurnTimer::end(Phase ePhase) {
+
+	/*  Depth 0 is possible when the timer got reset while the phase was in
+		progress, e.g. CvGame::doTurn starting a new turn. */
+	if(aiDepth[ePhase] <= 0)
+		return;
+	if(--aiDepth[ePhase] == 0) {
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		aTotal[ePhase].QuadPart += now.QuadPart - aStart[ePhase].QuadPart;
+	}
+}
+
+void TurnTimer::reset() {
+
+	iTurn = -1;
+	for(int i = 0; i < NUM_PHASES; i++) {
+		aiDepth[i] = 0;
+		aiCalls[i] = 0;
+		aTotal[i].QuadPart = 0;
+	}
+}
+
+void TurnTimer::writeHeader() {
+
+	CvString szLine("Turn,WorldSize,Era,Civs,Cities,Units");
+	for(int i = 0; i < NUM_PHASES; i++)
+		szLine += CvString::format(",%s (ms)", phaseName((Phase)i));
+	for(int i = 0; i < NUM_PHASES; i++) {
+		if(i != GAME_TURN) // Always 1
+			szLine += CvString::format(",%s (calls)", phaseName((Phase)i));
+	}
+	szLine += "\n";
+	gDLL->logMsg("TurnTimes.log", szLine.c_str(), false, false);
+}
+
+void TurnTimer::writeTurn() {
+
+	CvGame& g = GC.getGameINLINE();
+	int iCivs = 0;
+	int iUnits = 0;
+	for(int i = 0; i < MAX_CIV_PLAYERS; i++) {
+		CvPlayer const& kPlayer = GET_PLAYER((PlayerTypes)i);
+		if(!kPlayer.isAlive())
+			continue;
+		iCivs++;
+		iUnits += kPlayer.getNumUnits();
+	}
+	WorldSizeTypes eWorldSize = GC.getMapINLINE().getWorldSize();
+	CvString szLine;
+	szLine.Format("%d,%s,%s,%d,%d,%d", iTurn,
+			eWorldSize == NO_WORLDSIZE ? "" :
+			GC.getWorldInfo(eWorldSize).getType(),
+			GC.getEraInfo(g.getCurrentEra()).getType(),
+			iCivs, g.getNumCities(), iUnits);
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	for(int i = 0; i < NUM_PHASES; i++) {
+		szLine += CvString::format(",%.1f",
+				(1000.0 * aTotal[i].QuadPart) / freq.QuadPart);
+	}
+	for(int i = 0; i < NUM_PHASES; i++) {
+		if(i != GAME_TURN)
+			szLine += CvString::format(",%d", aiCalls[i]);
+	}
+	szLine += "\n";
+	gDLL->logMsg("TurnTimes.log", szLine.c_str(), false, false);
+}
+
+char const* TurnTimer::phaseName(Phase ePhase) {
+
+	switch(ePhase) {
+	case GAME_TURN: return "Total";
+	case GAME_DO_TURN: return "CvGame::doTurn";
+	case GAME_UPDATE_MOVES: return "CvGame::updateMoves";
+	case PLAYER_DO_TURN: return "CvPlayer::doTurn";
+	case AI_DO_TURN_PRE: return "CvPlayerAI::AI_doTurnPre";
+	case AI_DO_TURN_POST: return "CvPlayerAI::AI_doTurnPost";
+	case AI_UNIT_UPDATE: return "CvPlayerAI::AI_unitUpdate";
+	case CITY_DO_TURN: return "CvCity::doTurn";
+	case DEAL_DO_TURN: return "CvDeal::doTurn";
+	default: FAssertMsg(false, "Unknown turn phase"); return "";
+	}
+}
+
+// </advc.003s>
@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef TURN_TIMER_H
+#define TURN_TIMER_H
+
+/*  <advc.003s> New class. Measures the wall time of each game turn during
+	AI Auto Play, broken down into the phases of turn processing, and writes
+	one CSV line per turn to TurnTimes.log. Enabled through AUTOPLAY_TURN_TIME_LOG
+	in GlobalDefines_devel.xml.
+	For comparing builds: load the same savegame (which fixes the random seeds),
+	auto-play the same number of turns and diff the logs. Savegames from
+	different eras and map sizes serve as the benchmark scenarios.
+	Phase times are inclusive; e.g. CvPlayer::doTurn contains the time spent in
+	CvCity::doTurn. Nested calls of the same phase are only counted once.
+	All static b/c the timed functions (CvCity::doTurn, CvDeal::doTurn, ...)
+	shouldn't need a path to some CvGame member. */
+class TurnTimer {
+
+public:
+
+	enum Phase {
+		GAME_TURN, // From one call of CvGame::doTurn to the next
+		GAME_DO_TURN,
+		GAME_UPDATE_MOVES,
+		PLAYER_DO_TURN,
+		AI_DO_TURN_PRE,
+		AI_DO_TURN_POST,
+		AI_UNIT_UPDATE,
+		CITY_DO_TURN,
+		DEAL_DO_TURN,
+		NUM_PHASES
+	};
+
+	// Times the enclosing block. Does nothing unless the timer is active.
+	class Scope {
+	public:
+		inline Scope(Phase ePhase) : m_ePhase(ePhase), m_bStarted(bActive) {
+			if(m_bStarted)
+				begin(m_ePhase);
+		}
+		inline ~Scope() {
+			if(m_bStarted)
+				end(m_ePhase);
+		}
+	private:
+		Phase m_ePhase;
+		bool m_bStarted;
+	};
+
+	/*  To be called at the start of CvGame::doTurn. Writes the data of the
+		previous turn (if any) and decides whether to time the new turn. */
+	static void atTurnStart();
+	static void begin(Phase ePhase);
+	static void end(Phase ePhase);
+	static inline bool isActive() { return bActive; }
+
+private:
+	static void writeHeader();
+	static void writeTurn();
+	static void reset();
+	static char const* phaseName(Phase ePhase);
+
+	static bool bActive;
+	static int iTurn;
+	static int aiDepth[NUM_PHASES];
+	static int aiCalls[NUM_PHASES];
+	static LARGE_INTEGER aStart[NUM_PHASES];
+	static LARGE_INTEGER aTotal[NUM_PHASES];
+};
+
+// </advc.003s>
+
+#endif
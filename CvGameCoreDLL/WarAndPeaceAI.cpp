@@ -24,6 +24,12 @@ void WarAndPeaceAI::invalidateUICache() {
 	WarEvaluator::clearCache();
 }
 
+// <advc.003z>
+void WarAndPeaceAI::invalidateTurnCache() {
+
+	WarEvaluator::clearTurnCache();
+} // </advc.003z>
+
 void WarAndPeaceAI::setUseKModAI(bool b) {
 
 	enabled = !b;
@@ -64,6 +70,7 @@ void WarAndPeaceAI::update() {
 	for(size_t i = 0; i < _properTeams.size(); i++)
 		GET_TEAM(getWPAI._properTeams[i]).warAndPeaceAI().updateMembers();
 	WarEvaluator::clearCache();
+	WarEvaluator::clearTurnCache(); // advc.003z
 }
 
 void WarAndPeaceAI::processNewCivInGame(PlayerTypes newCivId) {
@@ -88,6 +95,7 @@ bool WarAndPeaceAI::isEnabled(bool inBackground) const{
 void WarAndPeaceAI::read(FDataStreamBase* stream) {
 
 	stream->Read(&enabled);
+	WarEvaluator::clearTurnCache(); // advc.003z
 }
 
 void WarAndPeaceAI::write(FDataStreamBase* stream) {
@@ -33,6 +33,8 @@ public:
 
 	WarAndPeaceAI();
 	void invalidateUICache();
+	// advc.003z: Discards war utility results cached for the current turn
+	void invalidateTurnCache();
 	// excluded: Barbarians, Minor civs, dead civs
 	 std::vector<PlayerTypes>& properCivs();
 	 std::vector<TeamTypes>& properTeams();
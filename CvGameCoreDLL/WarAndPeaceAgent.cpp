@@ -1242,21 +1242,31 @@ void WarAndPeaceAI::Team::scheme() {
 			restrictive in the lategame. Perhaps have reviewWarPlans compute the
 			smallest utility among current war plans, and skip scheming if that
 			minimum is, say, -55 or less. */
-		report->setMute(true);
+		/*  advc.003ac: Capture the logs of both evaluations instead of muting
+			the report and repeating the better one for logging. */
+		bool const capture = !report->isMute();
 		WarEvalParameters params(agentId, targetId, *report);
 		WarEvaluator eval(params);
 		int uTotal = INT_MIN;
 		bool totalNaval = false;
-		int totalPrepTime = -1;
+		CvString totalLog;
 		if(!skipTotal) {
+			if(capture)
+				report->startCapture();
 			uTotal = eval.evaluate(WARPLAN_PREPARING_TOTAL);
 			totalNaval = params.isNaval();
-			totalPrepTime = params.getPreparationTime();
+			if(capture)
+				totalLog = report->endCapture();
 		}
+		if(capture)
+			report->startCapture();
 		int uLimited = !shortWork ? eval.evaluate(WARPLAN_PREPARING_LIMITED):
 				eval.evaluate(WARPLAN_PREPARING_LIMITED, 0);
 		bool limitedNaval = params.isNaval();
-		int limitedPrepTime = params.getPreparationTime();
+		CvString limitedLog;
+		if(capture)
+			limitedLog = report->endCapture();
+		report->setMute(true);
 		bool total = false;
 		if(uLimited < 0 && uTotal > 0)
 			total = true;
@@ -1275,12 +1285,8 @@ void WarAndPeaceAI::Team::scheme() {
 		int reportThresh = (GET_TEAM(targetId).isHuman() ?
 				GC.getDefineINT("UWAI_REPORT_THRESH_HUMAN") :
 				GC.getDefineINT("UWAI_REPORT_THRESH"));
-		// Extra evaluation just for logging
-		if(!report->isMute() && u > reportThresh) {
-			if(total)
-				eval.evaluate(WARPLAN_PREPARING_TOTAL, totalNaval, totalPrepTime);
-			else eval.evaluate(WARPLAN_PREPARING_LIMITED, limitedNaval, limitedPrepTime);
-		}
+		if(!report->isMute() && u > reportThresh) // advc.003ac
+			report->logCaptured(total ? totalLog : limitedLog);
 		else report->log("%s %s war has %d utility", (total ? "total" : "limited"),
 				(((total && totalNaval) || (!total && limitedNaval)) ?
 				"naval" : ""), u);
@@ -10,12 +10,17 @@
 #include "MilitaryBranch.h"
 #include "WarEvalParameters.h"
 #include "WarEvaluator.h"
+#include "FAStarNode.h" // advc.003ae
 #include <cmath>
 
 using std::vector;
 using std::string;
 using std::sort;
 
+/*  advc.003ad: Recompute memoized path distances upon each use and assert
+	that they haven't changed (debug builds only) */
+//#define UWAI_VERIFY_PATH_MEMO
+
 /*  Called only once per session (when starting or loading the first game).
 	Seems to work fine as WarAndPeaceCache::WarAndPeaceCache() {}, but
 	let's make sure nothing remains uninitialized. */
@@ -27,6 +32,7 @@ WarAndPeaceCache::WarAndPeaceCache() {
 	bHasAggressiveTrait = bHasProtectiveTrait = canScrub = false;
 	trainDeepSeaCargo = trainAnyCargo = false;
 	focusOnPeacefulVictory = false;
+	pathMemoSerial = -1; // advc.003ad
 	for(int i = 0; i < MAX_CIV_PLAYERS; i++) {
 		wwAnger[i] = threatRatings[i] = relativeNavyPow[i] = -1;
 		located[i] = false;
@@ -92,6 +98,7 @@ void WarAndPeaceCache::clear(bool beforeUpdate) {
 		for(size_t i = 0; i < militaryPower.size(); i++)
 			SAFE_DELETE(militaryPower[i]);
 		militaryPower.clear();
+		clearPathMemo(); // advc.003ad
 		for(int i = 0; i < MAX_CIV_TEAMS; i++) {
 			pastWarScores[i] = 0;
 			sponsorshipsAgainst[i] = 0;
@@ -234,10 +241,13 @@ void WarAndPeaceCache::read(FDataStreamBase* stream) {
 void WarAndPeaceCache::update() {
 
 	PROFILE_FUNC();
+	getWPAI.invalidateTurnCache(); // advc.003z
 	clear(true);
 	focusOnPeacefulVictory = calculateFocusOnPeacefulVictory();
 	// Needs to be done before updating cities
 	updateTrainCargo();
+	prunePathMemo(); // advc.003ad
+	sweepPathDistances(); // advc.003ae
 	for(size_t i = 0; i < getWPAI.properCivs().size(); i++)
 		updateCities(getWPAI.properCivs()[i]);
 	sortCitiesByAttackPriority();
@@ -1147,11 +1157,13 @@ double WarAndPeaceCache::goldValueOfProduction() const {
 void WarAndPeaceCache::reportUnitCreated(CvUnitInfo const& u) {
 
 	updateMilitaryPower(u, true);
+	getWPAI.invalidateTurnCache(); // advc.003z
 }
 
 void WarAndPeaceCache::reportUnitDestroyed(CvUnitInfo const& u) {
 
 	updateMilitaryPower(u, false);
+	getWPAI.invalidateTurnCache(); // advc.003z
 }
 
 void WarAndPeaceCache::reportWarEnding(TeamTypes enemyId,
@@ -1287,6 +1299,7 @@ void WarAndPeaceCache::reportSponsoredWar(CLinkList<TradeData> const& sponsorshi
 		sponsorshipsAgainst[targetId] = 0;
 		sponsorsAgainst[targetId] = NO_PLAYER;
 	}
+	getWPAI.invalidateTurnCache(); // advc.003z
 }
 
 bool WarAndPeaceCache::isReadyToCapitulate(TeamTypes masterId) const {
@@ -1355,6 +1368,272 @@ void WarAndPeaceCache::updateTypicalUnits() {
 		militaryPower[i]->updateTypicalUnit();
 }
 
+// <advc.003ad>
+int WarAndPeaceCache::pathDistance(CvPlot* start, CvPlot* dest,
+		TeamTypes destTeam, DomainTypes dom, int maxPath) {
+
+	PROFILE_FUNC();
+	updatePathMemo();
+	CvMap const& m = GC.getMapINLINE();
+	int startIndex = m.plotNumINLINE(start->getX_INLINE(), start->getY_INLINE());
+	int destIndex = m.plotNumINLINE(dest->getX_INLINE(), dest->getY_INLINE());
+	std::map<std::pair<int,int>,PathMemoEntry>::iterator pos = pathMemo.find(
+			pathMemoKey(startIndex, destIndex, destTeam, dom, maxPath));
+	if(pos != pathMemo.end()) {
+		pos->second.used = true;
+#ifdef UWAI_VERIFY_PATH_MEMO
+		FAssertMsg(pos->second.distance == start->calculatePathDistanceToPlot(
+				start->getTeam(), dest, destTeam, dom, maxPath),
+				"Memoized path distance is out of date");
+#endif
+		return pos->second.distance;
+	}
+	int r = start->calculatePathDistanceToPlot(start->getTeam(), dest, destTeam,
+			dom, maxPath);
+	memoizePathDistance(startIndex, destIndex, destTeam, dom, maxPath, r);
+	return r;
+}
+
+std::pair<int,int> WarAndPeaceCache::pathMemoKey(int startIndex, int destIndex,
+		TeamTypes destTeam, DomainTypes dom, int maxPath) const {
+
+	return std::make_pair(startIndex * GC.getMapINLINE().numPlotsINLINE() +
+			destIndex, dom + NUM_DOMAIN_TYPES * (destTeam + MAX_TEAMS * maxPath));
+}
+
+void WarAndPeaceCache::memoizePathDistance(int startIndex, int destIndex,
+		TeamTypes destTeam, DomainTypes dom, int maxPath, int distance) {
+
+	PathMemoEntry e;
+	e.start = startIndex;
+	e.dest = destIndex;
+	e.distance = distance;
+	if(distance >= 0)
+		e.bound = distance;
+	else e.bound = (maxPath > 0 ? maxPath : MAX_INT / 2);
+	e.used = true;
+	pathMemo[pathMemoKey(startIndex, destIndex, destTeam, dom, maxPath)] = e;
+}
+
+/*  advc.003ae: Computes the path distances that City::updateDistance is
+	going to need and that aren't memoized yet. Rather than searching a path
+	for each pair of cities, searches all paths from one of our cities to the
+	cities of one team at once. */
+void WarAndPeaceCache::sweepPathDistances() {
+
+	PROFILE_FUNC();
+	CvPlayerAI& owner = GET_PLAYER(ownerId);
+	CvCity* capital = owner.getCapitalCity();
+	if(capital == NULL)
+		return;
+	updatePathMemo();
+	CvMap const& m = GC.getMapINLINE();
+	vector<DomainTypes> domains;
+	domains.push_back(DOMAIN_LAND);
+	if(trainAnyCargo) // Encode non-ocean as IMMOBILE (as in updateDistance)
+		domains.push_back(trainDeepSeaCargo ? DOMAIN_SEA : DOMAIN_IMMOBILE);
+	int dummy=-1;
+	for(CvCity* c = owner.firstCity(&dummy); c != NULL; c = owner.nextCity(&dummy)) {
+		if(!City::isDeploymentCity(*c, *capital))
+			continue;
+		CvPlot* start = c->plot();
+		int startIndex = c->plotNum();
+		for(size_t i = 0; i < domains.size(); i++) {
+			DomainTypes dom = domains[i];
+			// Per target team: (dest plot index, maxPath) of missing distances
+			std::map<TeamTypes,vector<std::pair<int,int> > > missing;
+			for(size_t j = 0; j < getWPAI.properCivs().size(); j++) {
+				PlayerTypes civId = getWPAI.properCivs()[j];
+				if(civId == ownerId)
+					continue;
+				CvPlayer const& civ = GET_PLAYER(civId); int foo=-1;
+				for(CvCity* tc = civ.firstCity(&foo); tc != NULL;
+						tc = civ.nextCity(&foo)) {
+					if(!TEAMREF(ownerId).AI_deduceCitySite(tc))
+						continue;
+					CvPlot* dest = tc->plot();
+					TeamTypes destTeam = NO_TEAM;
+					int maxPath = -1;
+					if(!City::preparePath(ownerId, dom, start, dest, destTeam,
+							maxPath))
+						continue;
+					int destIndex = m.plotNumINLINE(dest->getX_INLINE(),
+							dest->getY_INLINE());
+					if(pathMemo.count(pathMemoKey(startIndex, destIndex,
+							destTeam, dom, maxPath)) <= 0)
+						missing[destTeam].push_back(std::make_pair(destIndex,
+								maxPath));
+				}
+			}
+			for(std::map<TeamTypes,vector<std::pair<int,int> > >::const_iterator
+					it = missing.begin(); it != missing.end(); ++it) {
+				// A single search is faster through A*; leave that to pathDistance.
+				if(it->second.size() > 1)
+					sweepPathDistances(start, dom, it->first, it->second);
+			}
+		}
+	}
+}
+
+/*  advc.003ae: Breadth-first search from start that memoizes the distances
+	to the dests (plot index, maxPath). Uses the same step rules as
+	CvPlot::calculatePathDistanceToPlot, and all steps have the same cost,
+	so the distances are the same as those of the A* searches. */
+void WarAndPeaceCache::sweepPathDistances(CvPlot* start, DomainTypes dom,
+		TeamTypes destTeam, vector<std::pair<int,int> > const& dests) {
+
+	PROFILE_FUNC();
+	CvMap const& m = GC.getMapINLINE();
+	int maxReach = 0;
+	std::set<int> toFind;
+	for(size_t i = 0; i < dests.size(); i++) {
+		maxReach = std::max(maxReach, dests[i].second);
+		toFind.insert(dests[i].first);
+	}
+	/*  Same data as in calculatePathDistanceToPlot, but without the upper
+		bound (applied below) and without a destination that a naval path
+		could end on if it's land (none of our dests are land for naval
+		paths). */
+	int stepData[6] = { start->getTeam(), destTeam, dom, -1, -1, 0 };
+	vector<int> dist(m.numPlotsINLINE(), -1);
+	int startIndex = m.plotNumINLINE(start->getX_INLINE(), start->getY_INLINE());
+	dist[startIndex] = 0;
+	toFind.erase(startIndex);
+	vector<int> queue;
+	queue.push_back(startIndex);
+	FAStarNode parent, node;
+	for(size_t head = 0; head < queue.size() && !toFind.empty(); head++) {
+		int index = queue[head];
+		if(dist[index] >= maxReach)
+			continue;
+		CvPlot const& p = *m.plotByIndexINLINE(index);
+		parent.m_iX = p.getX_INLINE();
+		parent.m_iY = p.getY_INLINE();
+		for(int i = 0; i < NUM_DIRECTION_TYPES; i++) {
+			CvPlot* adj = ::plotDirection(parent.m_iX, parent.m_iY,
+					(DirectionTypes)i);
+			if(adj == NULL)
+				continue;
+			int adjIndex = m.plotNumINLINE(adj->getX_INLINE(), adj->getY_INLINE());
+			if(dist[adjIndex] >= 0)
+				continue;
+			node.m_iX = adj->getX_INLINE();
+			node.m_iY = adj->getY_INLINE();
+			if(!::teamStepValid_advc(&parent, &node, 0, stepData, NULL))
+				continue;
+			dist[adjIndex] = dist[index] + 1;
+			toFind.erase(adjIndex);
+			queue.push_back(adjIndex);
+		}
+	}
+	for(size_t i = 0; i < dests.size(); i++) {
+		int d = dist[dests[i].first];
+		int maxPath = dests[i].second;
+		if(d > maxPath)
+			d = -1;
+#ifdef UWAI_VERIFY_PATH_MEMO
+		FAssertMsg(d == start->calculatePathDistanceToPlot(start->getTeam(),
+				m.plotByIndexINLINE(dests[i].first), destTeam, dom, maxPath),
+				"Path distance from sweep differs from A* distance");
+#endif
+		memoizePathDistance(startIndex, dests[i].first, destTeam, dom, maxPath, d);
+	}
+}
+
+/*  Removes the memoized path distances that a change since the previous call
+	could have affected */
+void WarAndPeaceCache::updatePathMemo() {
+
+	CvMap const& m = GC.getMapINLINE();
+	vector<int> relations;
+	teamRelations(relations);
+	if(relations != pathMemoRelations ||
+			m.getPlotChangeResetSerial() > pathMemoSerial) {
+		clearPathMemo();
+		pathMemoRelations = relations;
+		pathMemoSerial = m.getPlotChangeSerial();
+		return;
+	}
+	if(m.getPlotChangeSerial() == pathMemoSerial)
+		return;
+	/*  All changes that ::teamStepValid_advc cares about (owner, plot type,
+		terrain, feature, city, fort) are logged as wide changes */
+	int const maxChanged = 128; // Beyond this, checking each entry is too slow
+	vector<CvPlot const*> changed;
+	bool tooMany = false;
+	for(int i = 0; i < m.numPlotsINLINE(); i++) {
+		if(m.getPlotChangeSerial(i, true) <= pathMemoSerial)
+			continue;
+		if((int)changed.size() >= maxChanged) {
+			tooMany = true;
+			break;
+		}
+		changed.push_back(m.plotByIndexINLINE(i));
+	}
+	pathMemoSerial = m.getPlotChangeSerial();
+	if(tooMany) {
+		pathMemo.clear();
+		return;
+	}
+	for(std::map<std::pair<int,int>,PathMemoEntry>::iterator it = pathMemo.begin();
+			it != pathMemo.end();) {
+		PathMemoEntry const& e = it->second;
+		CvPlot const* start = m.plotByIndexINLINE(e.start);
+		CvPlot const* dest = m.plotByIndexINLINE(e.dest);
+		bool dirty = false;
+		for(size_t i = 0; i < changed.size(); i++) {
+			/*  +2 b/c plots adjacent to the path matter too: through the
+				check for diagonal moves and through isCoastalLand */
+			if(m.stepDistance(start, changed[i]) + m.stepDistance(changed[i], dest) <=
+					e.bound + 2) {
+				dirty = true;
+				break;
+			}
+		}
+		if(dirty)
+			pathMemo.erase(it++);
+		else ++it;
+	}
+}
+
+// Removes memoized path distances that haven't been used since the previous call
+void WarAndPeaceCache::prunePathMemo() {
+
+	for(std::map<std::pair<int,int>,PathMemoEntry>::iterator it = pathMemo.begin();
+			it != pathMemo.end();) {
+		if(!it->second.used)
+			pathMemo.erase(it++);
+		else {
+			it->second.used = false;
+			++it;
+		}
+	}
+}
+
+void WarAndPeaceCache::clearPathMemo() {
+
+	pathMemo.clear();
+	pathMemoRelations.clear();
+	pathMemoSerial = -1;
+}
+
+// The relations of the cache owner's team that ::teamStepValid_advc checks
+void WarAndPeaceCache::teamRelations(vector<int>& r) const {
+
+	CvTeam const& t = TEAMREF(ownerId);
+	r.clear();
+	for(int i = 0; i < MAX_TEAMS; i++) {
+		TeamTypes tId = (TeamTypes)i;
+		CvTeam const& other = GET_TEAM(tId);
+		if(!other.isAlive()) {
+			r.push_back(-1);
+			continue;
+		}
+		r.push_back((t.isAtWar(tId) ? 1 : 0) + (t.isOpenBorders(tId) ? 2 : 0) +
+				(t.isFriendlyTerritory(tId) ? 4 : 0) + 8 * other.getMasterTeam());
+	}
+} // </advc.003ad>
+
 void WarAndPeaceCache::updateMilitaryPower(CvUnitInfo const& u, bool add) {
 
 	/*  i=1: skip HOME_GUARD. Potential guard units are counted as Army and
@@ -1642,7 +1921,6 @@ void WarAndPeaceCache::City::updateDistance(CvCity* targetCity) {
 	reachByLand = false;
 	reachBySea = false;
 	bool human = cacheOwner.isHuman();
-	EraTypes const era = cacheOwner.getCurrentEra();
 	// Assume that humans can always locate cities
 	if(!human && !cacheOwner.AI_deduceCitySite(targetCity))
 		return;
@@ -1658,10 +1936,7 @@ void WarAndPeaceCache::City::updateDistance(CvCity* targetCity) {
 	double mixedPath = 0;
 	CvCity* capital = cacheOwner.getCapitalCity(); int foo;
 	for(CvCity* c = cacheOwner.firstCity(&foo); c != NULL; c = cacheOwner.nextCity(&foo)) {
-		// Skip small and isolated cities
-		if(!c->isCapital() && (c->area()->getCitiesPerPlayer(cacheOwnerId) <= 1 ||
-				c->getPopulation() < capital->getPopulation() / 3 ||
-				c->getYieldRate(YIELD_PRODUCTION) < 5 + era))
+		if(!isDeploymentCity(*c, *capital))
 			continue;
 		CvPlot* p = c->plot();
 		int pwd = -1; // pairwise (travel) duration
@@ -1756,11 +2031,41 @@ double WarAndPeaceCache::City::estimateMovementSpeed(PlayerTypes civId,
 	return r;
 }
 
+// advc.003ae: Cut from updateDistance
+bool WarAndPeaceCache::City::isDeploymentCity(CvCity const& c,
+		CvCity const& capital) {
+
+	// Skip small and isolated cities
+	PlayerTypes ownerId = c.getOwnerINLINE();
+	return (c.isCapital() || (c.area()->getCitiesPerPlayer(ownerId) > 1 &&
+			c.getPopulation() >= capital.getPopulation() / 3 &&
+			c.getYieldRate(YIELD_PRODUCTION) >= 5 + GET_PLAYER(ownerId).
+			getCurrentEra()));
+}
+
 // <advc.104b>
 bool WarAndPeaceCache::City::measureDistance(PlayerTypes civId, DomainTypes dom,
 		CvPlot* start, CvPlot* dest, int* r) {
 
 	PROFILE_FUNC();
+	// <advc.003ae> Checks moved into preparePath
+	TeamTypes destTeam = NO_TEAM;
+	int maxPath = -1;
+	if(!preparePath(civId, dom, start, dest, destTeam, maxPath))
+		return false; // </advc.003ae>
+	// advc.003ad: Through the cache's memo instead of calculatePathDistanceToPlot
+	*r = GET_PLAYER(civId).warAndPeaceAI().getCache().pathDistance(start, dest,
+			destTeam, dom, maxPath);
+	return (*r >= 0);
+}
+
+/*  advc.003ae: Cut from measureDistance. False if there can't be a path.
+	Otherwise sets dest to the plot that the path search needs to reach,
+	destTeam to the owner of the original dest and maxPath to the upper
+	bound for the path search. */
+bool WarAndPeaceCache::City::preparePath(PlayerTypes civId, DomainTypes dom,
+		CvPlot* start, CvPlot*& dest, TeamTypes& destTeam, int& maxPath) {
+
 	/*  Caveat: dom can be IMMOBILE, which means Galley. Should compare dom
 		only with DOMAIN_LAND in this function, not DOMAIN_SEA. */
 	if(dom == DOMAIN_LAND && start->area() != dest->area())
@@ -1782,7 +2087,7 @@ bool WarAndPeaceCache::City::measureDistance(PlayerTypes civId, DomainTypes dom,
 	if(stepDist / speedEstimate > maxDist)
 		return false;
 	// dest is guaranteed to be owned; get the owner before possibly changing dest
-	TeamTypes destTeam = dest->getTeam();
+	destTeam = dest->getTeam();
 	if(dom != DOMAIN_LAND && !dest->isCoastalLand(minSz)) {
 		/*  A naval assault drops the units off on a tile adjacent to the city;
 			try to find an adjacent coastal tile. */
@@ -1823,11 +2128,10 @@ bool WarAndPeaceCache::City::measureDistance(PlayerTypes civId, DomainTypes dom,
 		won't take detours around ice into account though. */
 	if(dom != DOMAIN_LAND && !start->isAdjacentToArea(dest->area()))
 		return false;
-	*r = start->calculatePathDistanceToPlot(start->getTeam(), dest, destTeam,
-			/*  Path distance counts each step as 1 move; upper bound needs to
-				account for faster movement. */
-			dom, (int)::ceil(maxDist * speedEstimate));
-	return (*r >= 0);
+	/*  Path distance counts each step as 1 move; upper bound needs to
+		account for faster movement. */
+	maxPath = (int)::ceil(maxDist * speedEstimate);
+	return true;
 } // </advc.104b>
 
 void WarAndPeaceCache::City::cityCross(vector<CvPlot*>& r) {
@@ -130,6 +130,11 @@ public:
 	/*  public b/c this needs to be done ahead of the normal update when a
 		colony is created (bootstrapping problem) */
 	void updateTypicalUnits();
+	/*  advc.003ad: CvPlot::calculatePathDistanceToPlot from start (a city of
+		the cache owner) to dest. Results are remembered across updates until
+		a plot change or a change in team relations could affect them. */
+	int pathDistance(CvPlot* start, CvPlot* dest, TeamTypes destTeam,
+			DomainTypes dom, int maxPath);
 
 private:
 	// beforeUpdated: Only clear data that is recomputed in 'update'
@@ -164,6 +169,21 @@ private:
 	// To supply team-on-team data
 	WarAndPeaceCache const& leaderCache() const;
 	WarAndPeaceCache& leaderCache();
+	// <advc.003ad>
+	void updatePathMemo();
+	// <advc.003ae>
+	void sweepPathDistances();
+	void sweepPathDistances(CvPlot* start, DomainTypes dom, TeamTypes destTeam,
+			std::vector<std::pair<int,int> > const& dests);
+	// </advc.003ae>
+	std::pair<int,int> pathMemoKey(int startIndex, int destIndex,
+			TeamTypes destTeam, DomainTypes dom, int maxPath) const;
+	void memoizePathDistance(int startIndex, int destIndex, TeamTypes destTeam,
+			DomainTypes dom, int maxPath, int distance);
+	void prunePathMemo();
+	void clearPathMemo();
+	void teamRelations(std::vector<int>& r) const;
+	// </advc.003ad>
 
 	PlayerTypes ownerId;
 	std::vector<City*> v;
@@ -200,6 +220,22 @@ private:
 	 int sponsorsAgainst[MAX_CIV_TEAMS];
 	 int warUtilityIgnDistraction[MAX_CIV_TEAMS];
 	 bool hireAgainst[MAX_CIV_TEAMS];
+	/*  <advc.003ad> Memoized path distances (not serialized). Keyed by
+		start and destination plot index and by the other parameters of
+		pathDistance. */
+	struct PathMemoEntry {
+		int start, dest; // plot indices
+		int distance; // -1 if there is no path
+		/*  A path through a plot P can only be shorter than this if
+			stepDistance(start, P) + stepDistance(P, dest) is smaller */
+		int bound;
+		bool used; // since the previous update
+	};
+	std::map<std::pair<int,int>,PathMemoEntry> pathMemo;
+	// CvMap::getPlotChangeSerial when pathMemo was last checked
+	int pathMemoSerial;
+	// Team relations (see teamRelations) as of that check
+	std::vector<int> pathMemoRelations; // </advc.003ad>
 	
 public:
 	/* Information to be cached about a CvCity and scoring functions useful
@@ -238,6 +274,12 @@ public:
 		// Wrapper for CvUnit::generatePath
 	    static bool measureDistance(PlayerTypes civId, DomainTypes dom,
 				CvPlot* start, CvPlot* dest, int* r);
+		// <advc.003ae>
+		static bool preparePath(PlayerTypes civId, DomainTypes dom,
+				CvPlot* start, CvPlot*& dest, TeamTypes& destTeam, int& maxPath);
+		// Whether updateDistance measures paths from c
+		static bool isDeploymentCity(CvCity const& c, CvCity const& capital);
+		// </advc.003ae>
 		static double estimateMovementSpeed(PlayerTypes civId, DomainTypes dom, int dist);
 		/* For sorting cities. None of these are currently used, and I'm not
 			sure if they handle -1 distance/attackPriority/targetValue correctly. */
@@ -41,7 +41,7 @@ void WarAndPeaceReport::log(char const* fmt, ...) {
 
 void WarAndPeaceReport::writeToFile() {
 
-	if(muted > 0)
+	if(muted > 0 || !captureStart.empty()) // advc.003ac
 		return;
 	CvGame const& g = GC.getGameINLINE();
 	ostringstream logFileName;
@@ -60,6 +60,8 @@ void WarAndPeaceReport::deleteBuffer() {
 
 char const* WarAndPeaceReport::leaderName(PlayerTypes civId, int charLimit) {
 											                // default: 8
+	if(muted > 0) // advc.003ac: Skip the info lookup too
+		return "";
 	CvLeaderHeadInfo& leader = GC.getLeaderHeadInfo(
 			GET_PLAYER(civId).getLeaderType());
 	return narrow(leader.getDescription(), charLimit);
@@ -169,13 +171,36 @@ void WarAndPeaceReport::setMute(bool b) {
 	else muted--;
 }
 
-bool WarAndPeaceReport::isMute() const {
+// <advc.003ac>
+void WarAndPeaceReport::startCapture() {
+
+	captureStart.push_back((int)report.length());
+}
+
+CvString WarAndPeaceReport::endCapture() {
 
-	return muted > 0;
+	FAssert(!captureStart.empty());
+	int iStart = captureStart.back();
+	captureStart.pop_back();
+	CvString r = report.substr(iStart);
+	report.erase(iStart);
+	return r;
 }
 
+void WarAndPeaceReport::logCaptured(CvString const& szText) {
+
+	if(muted > 0 || szText.empty())
+		return;
+	report += szText;
+	writeToFile();
+} // </advc.003ac>
+
 void WarAndPeaceReport::setSilent(bool b) {
 
+	// <advc.003ac>
+#ifdef UWAI_DISABLE_REPORT
+	b = true;
+#endif // </advc.003ac>
 	silent = b;
 	if(silent)
 		muted = 1;
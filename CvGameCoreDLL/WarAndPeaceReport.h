@@ -7,6 +7,11 @@
 #include "CvString.h"
 #include <vector>
 
+/*  advc.003ac: Uncomment to compile a DLL that never writes UWAI reports.
+	All reports are then silent, which also skips the formatting of
+	log messages. */
+//#define UWAI_DISABLE_REPORT
+
 /* <advc.104>: New class. A report about the war planning of a single team
    (cf. WarAndPeaceAI::Team::doWar). I'm also focusing string handling
    needed for logging in this class.
@@ -41,8 +46,15 @@ public:
 	char const* prefix(int level);
 	void setMute(bool b);
 	// True if muted or if silent to begin with
-	bool isMute() const;
+	inline bool isMute() const { return muted > 0; } // advc.003ac: inline
 	void setSilent(bool b);
+	/*  <advc.003ac> While capturing, logged text is kept in memory instead of
+		being written to the log file. endCapture returns the text logged since
+		the matching startCapture call; it can be written out later through
+		logCaptured, or discarded. Captures can be nested. */
+	void startCapture();
+	CvString endCapture();
+	void logCaptured(CvString const& szText); // </advc.003ac>
 
 private:
 
@@ -53,6 +65,7 @@ private:
 	CvString report;
 	bool silent;
 	int muted;
+	std::vector<int> captureStart; // advc.003ac
 	std::vector<std::string*> stringBuffer;
 };
 
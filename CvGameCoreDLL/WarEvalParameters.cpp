@@ -139,13 +139,30 @@ int WarEvalParameters::id() const {
 	r += sponsor + 1; r *= 20;
 	r += capitulationTeam + 1; r *= 20;
 	r += immediateDoW;
-	/*  warAllies and extraTargets matter only in situations where the cache
-		should be disabled. (Also wouldn't fit into a single int, but long long
-		could be used instead.) */
-	FAssert(warAllies.empty() && extraTargets.empty());
+	/*  warAllies and extraTargets wouldn't fit into a single int.
+		advc.003z: The cache checks them separately (warAllyMask, extraTargetMask). */
 	return r;
 }
 
+// <advc.003z>
+int WarEvalParameters::warAllyMask() const {
+
+	int r = 0;
+	for(std::set<TeamTypes>::const_iterator it = warAllies.begin();
+			it != warAllies.end(); ++it)
+		r |= (1 << *it);
+	return r;
+}
+
+int WarEvalParameters::extraTargetMask() const {
+
+	int r = 0;
+	for(std::set<TeamTypes>::const_iterator it = extraTargets.begin();
+			it != extraTargets.end(); ++it)
+		r |= (1 << *it);
+	return r;
+} // </advc.003z>
+
 void WarEvalParameters::setTotal(bool b) {
 
 	total = b;
@@ -55,6 +55,10 @@ public:
 	TeamTypes getCapitulationTeam() const;
 	// For WarEvaluator cache
 	int id() const;
+	/*  <advc.003z> id doesn't account for these, and long preparation times
+		can lead to collisions. */
+	int warAllyMask() const;
+	int extraTargetMask() const; // </advc.003z>
 	// To be filled in by WarEvaluator
 	  void setTotal(bool b);
 	  void setNaval(bool b);
@@ -73,7 +77,8 @@ private:
 	bool immediateDoW;
 	PlayerTypes sponsor;
 	TeamTypes capitulationTeam;
-	// Data members added to this class will have to be factored into the id function!
+	/*  Data members added to this class will have to be factored into the id
+		function or be checked by WarEvaluator::findCachedUtility! */
 };
 
 // </advc.104>
@@ -5,6 +5,7 @@
 #include "WarAndPeaceAgent.h"
 #include "WarUtilityAspect.h"
 #include "MilitaryAnalyst.h"
+#include "InvasionGraph.h" // advc.003ab
 #include "WarAndPeaceReport.h"
 #include "WarEvalParameters.h"
 #include "CvGamePlay.h"
@@ -25,13 +26,97 @@ using std::ostringstream;
 	(see WarEvalParameters::id) and isn't stored in savegames. */
 bool WarEvaluator::checkCache = false;
 bool WarEvaluator::cacheCleared = true;
-/*  Cache size: Calls alternate between naval/ non-naval,
-	limited/ total or mutual war utility of two civs,
-	so caching just the last result isn't effective. */
-static int const cacheSz = 10;
-static int lastCallParams[cacheSz];
-static int lastCallResult[cacheSz];
-static int lastIndex;
+bool WarEvaluator::uiContext = false; // advc.003z
+/*  advc.003z: Replacing a ring buffer of the last 10 results, which was only
+	used in UI contexts. Now also caching results computed in synchronized
+	contexts; those are valid until the end of the turn or until any of the
+	simulation inputs changes (see WarAndPeaceAI::invalidateTurnCache call sites),
+	and in any context. UI contexts only read from the synchronized cache and
+	store their own results separately so that all machines in a network game
+	keep the same synchronized cache. Buckets are keyed by
+	WarEvalParameters::id. */
+struct CachedUtility {
+	int iId;
+	int iPreparationTime;
+	int iWarAllies;
+	int iExtraTargets;
+	/*  advc.003aa: Peace scenarios get cached too. A war scenario with
+		total=naval=false has the same id. */
+	bool bPeace;
+	int iUtility;
+};
+typedef stdext::hash_map<int,std::vector<CachedUtility> > UtilityCache;
+static UtilityCache uiCache;
+static UtilityCache turnCache;
+static int turnCacheGameTurn = -1;
+
+void WarEvaluator::clearTurnCache() {
+
+	/*  Called on every change of the simulation inputs, so only mark the cache
+		as stale here. cacheUtility clears it before storing the next result. */
+	turnCacheGameTurn = -1;
+}
+
+int WarEvaluator::findCachedUtility(WarEvalParameters const& params, bool bUI,
+		bool bPeace) { // advc.003aa
+
+	int iId = params.id();
+	for(int iPass = 0; iPass < (bUI ? 2 : 1); iPass++) {
+		UtilityCache const& cache = (iPass == 0 ? turnCache : uiCache);
+		if(iPass == 0 && turnCacheGameTurn != GC.getGameINLINE().getGameTurn())
+			continue; // Stale; cacheUtility will clear it.
+		UtilityCache::const_iterator pos = cache.find(iId);
+		if(pos == cache.end())
+			continue;
+		std::vector<CachedUtility> const& bucket = pos->second;
+		for(size_t i = 0; i < bucket.size(); i++) {
+			if(bucket[i].bPeace == bPeace && // advc.003aa
+					bucket[i].iPreparationTime == params.getPreparationTime() &&
+					bucket[i].iWarAllies == params.warAllyMask() &&
+					bucket[i].iExtraTargets == params.extraTargetMask())
+				return bucket[i].iUtility;
+		}
+	}
+	return MIN_INT;
+}
+
+void WarEvaluator::cacheUtility(WarEvalParameters const& params, bool bUI,
+		bool bPeace, // advc.003aa
+		int iUtility) {
+
+	if(!bUI) {
+		int iGameTurn = GC.getGameINLINE().getGameTurn();
+		if(turnCacheGameTurn != iGameTurn) {
+			turnCache.clear();
+			turnCacheGameTurn = iGameTurn;
+		}
+	}
+	CachedUtility entry;
+	entry.iId = params.id();
+	entry.iPreparationTime = params.getPreparationTime();
+	entry.iWarAllies = params.warAllyMask();
+	entry.iExtraTargets = params.extraTargetMask();
+	entry.bPeace = bPeace; // advc.003aa
+	entry.iUtility = iUtility;
+	std::vector<CachedUtility>& bucket = (bUI ? uiCache : turnCache)[entry.iId];
+	// Replace an older entry for the same key; lookups return the first match.
+	for(size_t i = 0; i < bucket.size(); i++) {
+		if(bucket[i].bPeace == entry.bPeace &&
+				bucket[i].iPreparationTime == entry.iPreparationTime &&
+				bucket[i].iWarAllies == entry.iWarAllies &&
+				bucket[i].iExtraTargets == entry.iExtraTargets) {
+			bucket[i] = entry;
+			return;
+		}
+	}
+	bucket.push_back(entry);
+}
+
+// <advc.003z>
+bool WarEvaluator::isUIContext() {
+
+	return uiContext;
+} // </advc.003z>
 
 void WarEvaluator::enableCache() {
 
@@ -49,8 +134,7 @@ void WarEvaluator::clearCache() {
 	if(cacheCleared) // Just to make sure that repeated clears don't waste time
 		return;
 	cacheCleared = true;
-	for(int i = 0; i < cacheSz; i++)
-		lastCallResult[i] = MIN_INT;
+	uiCache.clear(); // advc.003z
 }
 
 WarEvaluator::WarEvaluator(WarEvalParameters& warEvalParams, bool useCache) :
@@ -62,16 +146,6 @@ WarEvaluator::WarEvaluator(WarEvalParameters& warEvalParams, bool useCache) :
 	targetTeam(target.warAndPeaceAI().teamMembers()),
 	useCache(useCache) {
 
-	static bool bInitCache = true;
-	if(bInitCache) {
-		for(int i = 0; i < cacheSz; i++) {
-			lastCallParams[i] = 0;
-			lastCallResult[i] = MIN_INT;
-		}
-		lastIndex = 0;
-		bInitCache = false;
-	}
-
 	FAssertMsg(agentId != targetId, "Considering war against own team");
 	// Second condition already detected above
 	FAssert(!target.isAVassal());
@@ -80,8 +154,15 @@ WarEvaluator::WarEvaluator(WarEvalParameters& warEvalParams, bool useCache) :
 	FAssert(!targetTeam.empty());
 
 	peaceScenario = false;
+	snapshot = new SimulationSnapshot(); // advc.003ab
 }
 
+// <advc.003ab>
+WarEvaluator::~WarEvaluator() {
+
+	delete snapshot;
+} // </advc.003ab>
+
 void WarEvaluator::reportPreamble() {
 
 	if(report.isMute())
@@ -200,28 +281,34 @@ int WarEvaluator::evaluate(WarPlanTypes wp, int preparationTime) {
 			skipNaval = false;
 	}
 	/*  If the report isn't mute anyway, and we're doing two runs, rather than
-		flooding the report with logs for both naval and non-naval utility, mute
-		the report in both runs, and do an additional run just for logging
-		once we know if naval or non-naval war is better. */
-	bool extraRun = (!report.isMute() && !skipNaval);
-	if(extraRun)
-		report.setMute(true);
+		flooding the report with logs for both naval and non-naval utility,
+		only log the run that turns out to be better.
+		advc.003ac: Used to mute both runs and repeat the better one for
+		logging. Capture the logs of both runs instead. */
+	bool const capture = (!report.isMute() && !skipNaval);
+	if(capture)
+		report.startCapture();
 	int nonNaval = evaluate(wp, false, preparationTime);
+	CvString nonNavalLog;
+	if(capture)
+		nonNavalLog = report.endCapture();
 	// Assume non-naval war if it hardly makes a difference
 	int const antiNavalBias = 3;
 	int naval = MIN_INT;
-	if(!skipNaval)
+	if(!skipNaval) {
+		if(capture)
+			report.startCapture();
 		naval = evaluate(wp, true, preparationTime);
-	int r = MIN_INT;
-	if(extraRun) {
-		report.setMute(false);
-		r = evaluate(wp, naval > nonNaval + antiNavalBias, preparationTime);
 	}
-	else {
-		if(naval > nonNaval + antiNavalBias)
-			r = naval;
-		else r = nonNaval;
+	if(capture) {
+		CvString navalLog = report.endCapture();
+		report.logCaptured(naval > nonNaval + antiNavalBias ?
+				navalLog : nonNavalLog);
 	}
+	int r = MIN_INT;
+	if(naval > nonNaval + antiNavalBias)
+		r = naval;
+	else r = nonNaval;
 	/*  Calls to evaluate(3) change some members of params that the caller
 		may read */
 	params.setNaval(naval > nonNaval + antiNavalBias);
@@ -244,13 +331,21 @@ int WarEvaluator::evaluate(WarPlanTypes wp, bool isNaval, int preparationTime) {
 		preparationTime = defaultPreparationTime(wp);
 	}
 	params.setPreparationTime(preparationTime);
-	// Don't check cache in recursive calls (peaceScenario=true)
-	if(!peaceScenario && (checkCache || useCache || gDLL->isDiplomacy())) {
-		int id = params.id();
-		for(int i = 0; i < cacheSz; i++)
-			if(id == lastCallParams[i] && lastCallResult[i] != MIN_INT)
-				return lastCallResult[i];
-	}
+	// <advc.003z>
+	/*  Only state that is the same on all machines may decide which cache
+		gets read; synchronized evaluations never read the UI cache. */
+	bool const bUI = (checkCache || useCache);
+	/*  advc.003aa: All war scenarios against the same target with the
+		same preparation time share their peace scenario, e.g. the naval and
+		non-naval runs of an immediate DoW and, across the turn, scheme,
+		reviewWarPlans and the trade screen. */
+	// The recursive call will overwrite peaceScenario
+	bool const bPeace = peaceScenario; // advc.003aa
+	int const iCached = findCachedUtility(params, bUI, bPeace);
+	/*  When logging, evaluate anyway so that the report isn't empty, but act on
+		the cached result (below) so that logging doesn't change decisions. */
+	if(iCached != MIN_INT && report.isMute())
+		return iCached; // </advc.003z>
 	if(peaceScenario)
 		report.log("*Peace scenario*\n");
 	else {
@@ -259,6 +354,8 @@ int WarEvaluator::evaluate(WarPlanTypes wp, bool isNaval, int preparationTime) {
 		reportPreamble();
 		report.log("*War scenario*\n");
 	}
+	bool const bWasUIContext = uiContext; // advc.003z
+	uiContext = bUI;
 	vector<WarUtilityAspect*> aspects;
 	fillWithAspects(aspects);
 	for(size_t i = 0; i < agentTeam.size(); i++)
@@ -270,6 +367,7 @@ int WarEvaluator::evaluate(WarPlanTypes wp, bool isNaval, int preparationTime) {
 			report.log("%s total: %d", aspects[i]->aspectName(), delta);
 		delete aspects[i];
 	}
+	uiContext = bWasUIContext; // advc.003z
 	report.log("Bottom line: %d\n", u);
 	if(!peaceScenario) {
 		u -= evaluate(NO_WARPLAN, false, preparationTime);
@@ -278,16 +376,16 @@ int WarEvaluator::evaluate(WarPlanTypes wp, bool isNaval, int preparationTime) {
 		params.setNaval(isNaval);
 		params.setTotal(wp == WARPLAN_TOTAL || wp == WARPLAN_PREPARING_TOTAL);
 		params.setPreparationTime(preparationTime);
-		/*  Could update cache even when !checkCache, but the cache is so small
-			that this can push out just the values that are needed. */
-		if(checkCache || useCache) {
-			// Cache the total result after returning from the recursive call
-			long id = params.id();
-			lastCallParams[lastIndex] = id;
-			lastCallResult[lastIndex] = u;
-			lastIndex = (lastIndex + 1) % cacheSz;
-		}
 	}
+	// <advc.003z>
+	if(iCached != MIN_INT) {
+		if(iCached != u)
+			report.log("Acting on cached result: %d\n", iCached);
+		return iCached;
+	}
+	/*  Cache the total result after returning from the recursive call.
+		(advc.003aa: Also the peace scenario; its params are set in that case.) */
+	cacheUtility(params, bUI, bPeace, u); // advc.003z
 	return u;
 }
 
@@ -323,7 +421,7 @@ void WarEvaluator::fillWithAspects(vector<WarUtilityAspect*>& v) {
 
 void WarEvaluator::evaluate(PlayerTypes weId, vector<WarUtilityAspect*>& aspects) {
 
-	MilitaryAnalyst m(weId, params, peaceScenario);
+	MilitaryAnalyst m(weId, params, peaceScenario, *snapshot);
 	for(size_t i = 0; i < getWPAI.properCivs().size(); i++) {
 		PlayerTypes civId = getWPAI.properCivs()[i];
 		if(!TEAMREF(civId).isCapitulated() && TEAMREF(civId).isHasMet(agentId))
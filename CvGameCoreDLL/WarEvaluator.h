@@ -9,6 +9,7 @@
 class WarEvalParameters;
 class WarUtilityAspect;
 class WarAndPeaceReport;
+class SimulationSnapshot; // advc.003ab
 
 /* <advc.104>: New class. Computes the utility of a war between two teams:
    'agent' against 'target'. From the point of view of 'agent'.  */
@@ -18,6 +19,7 @@ public:
 
 	// The cache should only be used for UI purposes; see comments in the .cpp file
 	WarEvaluator(WarEvalParameters& warEvalParams, bool useCache = false);
+	~WarEvaluator(); // advc.003ab
 
 	/*  Can be called repeatedly for different war plan types (w/o constructing
 		a new object in between).
@@ -55,6 +57,12 @@ private:
 	WarAndPeaceReport& report;
 	bool peaceScenario;
 	bool useCache;
+	/*  advc.003ab: Shared by all evaluate calls; therefore, WarEvaluator objects
+		shouldn't be kept around while the game state changes. */
+	SimulationSnapshot* snapshot;
+	// advc.003ab: Not copyable b/c the destructor deletes the snapshot (not implemented)
+	WarEvaluator(WarEvaluator const&);
+	WarEvaluator& operator=(WarEvaluator const&);
 
 	bool atTotalWarWithTarget() const;
 	void gatherCivsAndTeams();
@@ -65,9 +73,29 @@ private:
 		static void enableCache();
 		static void disableCache();
 		static void clearCache(); // Invalidates the cache (which disableCache does not do)
+		/*  advc.003z: Results computed in synchronized contexts are cached
+			until the end of the turn or until one of the events that the
+			WarAndPeaceAI::invalidateTurnCache call sites handle: contact, war,
+			war plans, vassal agreements, defensive pacts, open borders,
+			attitude and memory, war sponsorship, cities gained or lost, units
+			trained, lost or moved, population, research progress, plot
+			ownership and the start of each player's AI turn.
+			Cheap; only marks the cache as stale. */
+		static void clearTurnCache();
+		/*  advc.003z: True while the aspects of an evaluation that uses the
+			UI cache are computed. Only then may the evaluation depend on
+			state that differs between machines (e.g. gDLL->isDiplomacy). */
+		static bool isUIContext();
 	private:
 		static bool checkCache;
 		static bool cacheCleared;
+		static bool uiContext; // advc.003z
+		// <advc.003z>
+		static int findCachedUtility(WarEvalParameters const& params, bool bUI,
+				bool bPeace); // advc.003aa
+		static void cacheUtility(WarEvalParameters const& params, bool bUI,
+				bool bPeace, // advc.003aa
+				int iUtility); // </advc.003z>
 };
 
 // </advc.104>
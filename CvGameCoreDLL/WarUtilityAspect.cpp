@@ -6,6 +6,7 @@
 #include "WarAndPeaceReport.h"
 #include "WarEvalParameters.h"
 #include "WarAndPeaceAgent.h"
+#include "WarEvaluator.h" // advc.003z
 #include "MilitaryAnalyst.h"
 #include "CvGamePlay.h"
 #include "AI_Defines.h"
@@ -3648,7 +3649,10 @@ void TacticalSituation::evalEngagement() {
 		turn, it's still the beginning of the turn, so we can probably save
 		our units. */
 	double initiativeFactor = 0.25; // Low if they have the initiative
-	if(gDLL->isDiplomacy() || // I.e. we're negotiating with a human
+	if((gDLL->isDiplomacy() && // I.e. we're negotiating with a human
+			/*  advc.003z: Local UI state mustn't affect synchronized results;
+				these get cached across machines. */
+			WarEvaluator::isUIContext()) ||
 			we->isHuman() || they->isHuman())
 		initiativeFactor = 0.5;
 	double uPlus = (4.0 * (initiativeFactor * theirExposed -